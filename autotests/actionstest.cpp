@@ -6,6 +6,8 @@
 #include <QSignalSpy>
 #include <QVariantList>
 
+#include <Quotient/events/reactionevent.h>
+
 #include "accountmanager.h"
 #include "blockcache.h"
 #include "enums/blocktype.h"
@@ -36,6 +38,8 @@ private Q_SLOTS:
     void testActions();
     void testActions_data();
     void testInvite();
+    void testParseCommand();
+    void testReact();
 };
 
 void ActionsTest::initTestCase()
@@ -80,6 +84,12 @@ void ActionsTest::testActions_data()
     QTest::newRow("notice") << u"/notice Hello"_s << std::make_optional(u"Hello"_s) << std::make_optional(Quotient::RoomMessageEvent::MsgType::Notice);
     QTest::newRow("message") << u"Hello"_s << std::make_optional(u"Hello"_s) << std::make_optional(Quotient::RoomMessageEvent::MsgType::Text);
     QTest::newRow("invite") << u"/invite @foo:example.com"_s << std::optional<QString>() << std::optional<Quotient::RoomMessageEvent::MsgType>();
+    QTest::newRow("unknown") << u"/foo Hello"_s << std::make_optional(u"/foo Hello"_s) << std::make_optional(Quotient::RoomMessageEvent::MsgType::Text);
+    QTest::newRow("prefix of an action") << u"/shr Hello"_s << std::make_optional(u"/shr Hello"_s)
+                                         << std::make_optional(Quotient::RoomMessageEvent::MsgType::Text);
+    // Only the first action is run, even if its result starts with another one.
+    QTest::newRow("me invite") << u"/me /invite @foo:example.com"_s << std::make_optional(u"/invite @foo:example.com"_s)
+                               << std::make_optional(Quotient::RoomMessageEvent::MsgType::Emote);
 
     //TODO: join, knock, j, part, leave, nick, roomnick, myroomnick, ignore, unignore, react, ban, unban, kick
 }
@@ -151,5 +161,76 @@ void ActionsTest::testInvite()
     QCOMPARE(room->memberState(u"@user:example.com"_s), Membership::Invite);
 }
 
+void ActionsTest::testParseCommand()
+{
+    QSet<QString> prefixes;
+    for (const auto &action : ActionsModel::allActions()) {
+        QVERIFY(!prefixes.contains(action.prefix));
+        prefixes += action.prefix;
+
+        auto command = ActionsModel::parseCommand(u"/%1 some  arguments "_s.arg(action.prefix));
+        QVERIFY(command);
+        QCOMPARE(command->action, &action);
+        QCOMPARE(command->arguments, u"some  arguments"_s);
+
+        command = ActionsModel::parseCommand(u"/%1"_s.arg(action.prefix));
+        QVERIFY(command);
+        QCOMPARE(command->action, &action);
+        QVERIFY(command->arguments.isEmpty());
+
+        QVERIFY(!ActionsModel::parseCommand(action.prefix));
+        QVERIFY(!ActionsModel::parseCommand(u"/%1x"_s.arg(action.prefix)));
+        QVERIFY(!ActionsModel::parseCommand(u" /%1"_s.arg(action.prefix)));
+    }
+    QCOMPARE(ActionsModel::instance().rowCount(), prefixes.size());
+
+    QVERIFY(!ActionsModel::parseCommand(QString()));
+    QVERIFY(!ActionsModel::parseCommand(u"/"_s));
+    QVERIFY(!ActionsModel::parseCommand(u"/ me"_s));
+}
+
+void ActionsTest::testReact()
+{
+    QSignalSpy syncSpy(connection, &Connection::syncDone);
+    const auto eventId = server.sendEvent(room->id(),
+                                          u"m.room.message"_s,
+                                          QJsonObject{
+                                              {u"body"_s, u"foo"_s},
+                                              {u"msgtype"_s, u"m.text"_s},
+                                          });
+    QTRY_VERIFY(room->lastMessageEvent() && room->lastMessageEvent()->id() == eventId);
+
+    // Other events don't replace the last message event.
+    server.sendEvent(room->id(), u"org.kde.neochat.test"_s, QJsonObject{});
+    QVERIFY(syncSpy.wait());
+    QVERIFY(syncSpy.wait());
+    QCOMPARE(room->lastMessageEvent()->id(), eventId);
+
+    // Neither do edits, the message they edit is still the last one shown.
+    server.sendEvent(room->id(),
+                     u"m.room.message"_s,
+                     QJsonObject{
+                         {u"body"_s, u"* bar"_s},
+                         {u"msgtype"_s, u"m.text"_s},
+                         {u"m.new_content"_s, QJsonObject{{u"body"_s, u"bar"_s}, {u"msgtype"_s, u"m.text"_s}}},
+                         {u"m.relates_to"_s, QJsonObject{{u"rel_type"_s, u"m.replace"_s}, {u"event_id"_s, eventId}}},
+                     });
+    QVERIFY(syncSpy.wait());
+    QVERIFY(syncSpy.wait());
+    QCOMPARE(room->lastMessageEvent()->id(), eventId);
+
+    auto cache = Blocks::Cache();
+    auto helper = PostMessageHelper();
+    cache.append(std::make_unique<Blocks::TextCacheItem>(Blocks::Text, QTextDocumentFragment::fromMarkdown(u"/react 👍"_s)));
+    helper.setCache(&cache);
+    const auto pendingCount = room->pendingEvents().size();
+    ActionsModel::handleAction(room, &helper);
+    QCOMPARE(room->pendingEvents().size(), pendingCount + 1);
+    const auto reaction = room->pendingEvents().back().viewAs<ReactionEvent>();
+    QVERIFY(reaction);
+    QCOMPARE(reaction->eventId(), eventId);
+    QCOMPARE(reaction->key(), u"👍"_s);
+}
+
 QTEST_MAIN(ActionsTest)
 #include "actionstest.moc"
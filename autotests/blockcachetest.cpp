@@ -1,7 +1,9 @@
 // SPDX-FileCopyrightText: 2026 James Graham <james.h.graham@protonmail.com>
 // SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 
+#include <QMimeDatabase>
 #include <QObject>
+#include <QSignalSpy>
 #include <QTest>
 #include <QTextCursor>
 #include <QTextList>
@@ -23,6 +25,9 @@ private Q_SLOTS:
     void listTest();
 
     void disabledRichTextMention();
+
+    void serializeTest();
+    void deserializeInvalid();
 };
 
 void BlockCacheTest::toStringTest_data()
@@ -139,5 +144,169 @@ void BlockCacheTest::disabledRichTextMention()
     Blocks::CacheItem::richTextActive = true;
 }
 
+void BlockCacheTest::serializeTest()
+{
+    const QMimeDatabase mimeDatabase;
+
+    FileInfo fileInfo;
+    fileInfo.size = 1024;
+    fileInfo.mimeType = mimeDatabase.mimeTypeForName(u"text/plain"_s);
+
+    ImageInfo imageInfo;
+    imageInfo.size = 2048;
+    imageInfo.mimeType = mimeDatabase.mimeTypeForName(u"image/png"_s);
+    imageInfo.pixelSize = QSize(640, 480);
+    imageInfo.isAnimated = true;
+    imageInfo.isSticker = true;
+
+    ImageInfo thumbnailInfo;
+    thumbnailInfo.size = 128;
+    thumbnailInfo.mimeType = mimeDatabase.mimeTypeForName(u"image/jpeg"_s);
+    thumbnailInfo.pixelSize = QSize(64, 48);
+
+    VideoInfo videoInfo;
+    videoInfo.size = 4096;
+    videoInfo.mimeType = mimeDatabase.mimeTypeForName(u"video/mp4"_s);
+    videoInfo.pixelSize = QSize(1920, 1080);
+    videoInfo.duration = 5000;
+
+    AudioInfo audioInfo;
+    audioInfo.size = 512;
+    audioInfo.mimeType = mimeDatabase.mimeTypeForName(u"audio/ogg"_s);
+    audioInfo.duration = 3000;
+
+    const auto richText = QTextDocumentFragment::fromHtml(
+        u"<p>Hi <a href=\"https://matrix.to/#/@alice:kde.org\">Alice</a>, <b>bold</b> and <i>ünïcödé</i></p><ol><li>one</li><li>two</li></ol>"_s);
+
+    Cache cache;
+    cache.append(std::make_unique<ReplyCacheItem>(Reply, u"$reply:kde.org"_s));
+    cache.append(std::make_unique<TextCacheItem>(Text, richText, true));
+    cache.append(std::make_unique<TextCacheItem>(Quote, QTextDocumentFragment::fromPlainText(u"“a quote”"_s)));
+    cache.append(std::make_unique<CodeCacheItem>(Code, QTextDocumentFragment::fromPlainText(u"int main()\n{\n}"_s), u"cpp"_s, true));
+    cache.append(std::make_unique<FileCacheItem>(File, QUrl(u"file:///tmp/my notes.txt"_s), u"my notes.txt"_s, fileInfo));
+    cache.append(std::make_unique<ImageCacheItem>(Image,
+                                                  QUrl(u"file:///tmp/image.png"_s),
+                                                  u"image.png"_s,
+                                                  imageInfo,
+                                                  QUrl(u"mxc://kde.org/thumbnail"_s),
+                                                  thumbnailInfo,
+                                                  false));
+    cache.append(std::make_unique<VideoCacheItem>(Video, QUrl(u"file:///tmp/video.mp4"_s), u"video.mp4"_s, videoInfo, QUrl(), thumbnailInfo));
+    cache.append(std::make_unique<AudioCacheItem>(Audio, QUrl(u"file:///tmp/audio.ogg"_s), u"audio.ogg"_s, audioInfo));
+    cache.append(std::make_unique<LocationCacheItem>(Location, 51.606, 0.046, u"m.pin"_s));
+    cache.append(std::make_unique<BasicTextCacheItem>(Other, u"basic text"_s));
+    cache.append(std::make_unique<UrlCacheItem>(Pdf, QUrl(u"file:///tmp/document.pdf"_s)));
+    cache.append(std::make_unique<CacheItem>(Separator));
+    cache.setCursor(1, 7);
+    cache.setEventId(u"$edited:kde.org"_s);
+
+    Cache restored;
+    restored.append(std::make_unique<TextCacheItem>(Text, QTextDocumentFragment::fromPlainText(u"replaced"_s)));
+    QSignalSpy changedSpy(&restored, &Cache::changed);
+    QVERIFY(restored.deserialize(cache.serialize()));
+    QCOMPARE(changedSpy.count(), 1);
+
+    QCOMPARE(restored.focusRow(), 1);
+    QCOMPARE(restored.cursorPosition(), 7);
+    QCOMPARE(restored.eventId(), u"$edited:kde.org"_s);
+    QCOMPARE(std::distance(restored.cbegin(), restored.cend()), std::distance(cache.cbegin(), cache.cend()));
+    for (qsizetype i = 0; restored.at(i); ++i) {
+        QCOMPARE(restored.at(i)->type, cache.at(i)->type);
+    }
+    QCOMPARE(restored.toString(), cache.toString());
+
+    QCOMPARE(restored.at<ReplyCacheItem>(0)->id, u"$reply:kde.org"_s);
+
+    const auto text = restored.at<TextCacheItem>(1);
+    QVERIFY(text->hasSpoiler);
+    QCOMPARE(text->content.toMarkdown(), richText.toMarkdown());
+
+    const auto quote = restored.at<TextCacheItem>(2);
+    QVERIFY(!quote->hasSpoiler);
+    QCOMPARE(quote->content.toPlainText(), u"“a quote”"_s);
+
+    const auto code = restored.at<CodeCacheItem>(3);
+    QCOMPARE(code->content.toPlainText(), u"int main()\n{\n}"_s);
+    QCOMPARE(code->language, u"cpp"_s);
+    QVERIFY(code->highlighted);
+
+    const auto file = restored.at<FileCacheItem>(4);
+    QCOMPARE(file->source, QUrl(u"file:///tmp/my notes.txt"_s));
+    QCOMPARE(file->filename, u"my notes.txt"_s);
+    QCOMPARE(file->info.size, 1024);
+    QCOMPARE(file->info.mimeType.name(), u"text/plain"_s);
+
+    const auto image = restored.at<ImageCacheItem>(5);
+    QCOMPARE(image->source, QUrl(u"file:///tmp/image.png"_s));
+    QCOMPARE(image->filename, u"image.png"_s);
+    QCOMPARE(image->info.size, 2048);
+    QCOMPARE(image->info.mimeType.name(), u"image/png"_s);
+    QCOMPARE(image->info.pixelSize, QSize(640, 480));
+    QVERIFY(image->info.isAnimated);
+    QVERIFY(image->info.isSticker);
+    QCOMPARE(image->thumbnailSource, QUrl(u"mxc://kde.org/thumbnail"_s));
+    QCOMPARE(image->thumbnailInfo.mimeType.name(), u"image/jpeg"_s);
+    QCOMPARE(image->thumbnailInfo.pixelSize, QSize(64, 48));
+    QVERIFY(!image->optimize);
+
+    const auto video = restored.at<VideoCacheItem>(6);
+    QCOMPARE(video->source, QUrl(u"file:///tmp/video.mp4"_s));
+    QCOMPARE(video->filename, u"video.mp4"_s);
+    QCOMPARE(video->info.size, 4096);
+    QCOMPARE(video->info.mimeType.name(), u"video/mp4"_s);
+    QCOMPARE(video->info.pixelSize, QSize(1920, 1080));
+    QCOMPARE(video->info.duration, 5000);
+    QVERIFY(video->thumbnailSource.isEmpty());
+    QCOMPARE(video->thumbnailInfo.size, 128);
+
+    const auto audio = restored.at<AudioCacheItem>(7);
+    QCOMPARE(audio->source, QUrl(u"file:///tmp/audio.ogg"_s));
+    QCOMPARE(audio->filename, u"audio.ogg"_s);
+    QCOMPARE(audio->info.mimeType.name(), u"audio/ogg"_s);
+    QCOMPARE(audio->info.duration, 3000);
+
+    const auto location = restored.at<LocationCacheItem>(8);
+    QCOMPARE(location->latitude, 51.606);
+    QCOMPARE(location->longitude, 0.046);
+    QCOMPARE(location->asset, u"m.pin"_s);
+
+    QCOMPARE(restored.at<BasicTextCacheItem>(9)->display, u"basic text"_s);
+    QCOMPARE(restored.at<UrlCacheItem>(10)->source, QUrl(u"file:///tmp/document.pdf"_s));
+    QVERIFY(!dynamic_cast<const UrlCacheItem *>(restored.at(11)));
+    QVERIFY(!dynamic_cast<const TextCacheItem *>(restored.at(11)));
+
+    // An empty cache round trips too.
+    QVERIFY(restored.deserialize(Cache().serialize()));
+    QVERIFY(restored.empty());
+    QCOMPARE(restored.focusRow(), -1);
+}
+
+void BlockCacheTest::deserializeInvalid()
+{
+    Cache cache;
+    cache.append(std::make_unique<TextCacheItem>(Text, QTextDocumentFragment::fromPlainText(u"some draft"_s)));
+    cache.append(std::make_unique<ReplyCacheItem>(Reply, u"$reply:kde.org"_s));
+    cache.setCursor(0, 4);
+    const auto data = cache.serialize();
+
+    Cache restored;
+    QVERIFY(!restored.deserialize(QByteArray()));
+    QVERIFY(restored.empty());
+
+    // Cut off in the middle of an item.
+    QVERIFY(!restored.deserialize(data.first(data.size() - 3)));
+    QVERIFY(restored.empty());
+    QCOMPARE(restored.cursorPosition(), -1);
+
+    // Another format version.
+    auto otherVersion = data;
+    otherVersion[0] = char(otherVersion[0] + 1);
+    QVERIFY(!restored.deserialize(otherVersion));
+    QVERIFY(restored.empty());
+
+    QVERIFY(restored.deserialize(data));
+    QCOMPARE(restored.toString(), u"some draft"_s);
+}
+
 QTEST_MAIN(BlockCacheTest)
 #include "blockcachetest.moc"
@@ -0,0 +1,382 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QColorSpace>
+#include <QObject>
+#include <QSignalSpy>
+#include <QTest>
+
+#include <array>
+#include <numbers>
+
+#include "blurhash.h"
+#include "blurhashimageprovider.h"
+
+using namespace Qt::StringLiterals;
+using namespace Quotient;
+
+namespace
+{
+const QString b83Characters = u"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz#$%*+,-.:;=?@[]^_{|}~"_s;
+
+int decode83(const QString &encodedString)
+{
+    int temp = 0;
+    for (const QChar c : encodedString) {
+        temp = temp * 83 + static_cast<int>(b83Characters.indexOf(c));
+    }
+    return temp;
+}
+
+float signPow(const float value, const float exp)
+{
+    return std::copysign(std::pow(std::abs(value), exp), value);
+}
+
+/*
+ * The straightforward per pixel decoder that BlurHash::decode used to be, kept as the
+ * reference for the parity test and the benchmark. Expects a valid blurhash.
+ */
+QImage referenceDecode(const QString &blurhash, const QSize &size)
+{
+    const auto toLinearSRGB = QColorSpace(QColorSpace::SRgb).transformationToColorSpace(QColorSpace::SRgbLinear);
+    const auto fromLinearSRGB = QColorSpace(QColorSpace::SRgbLinear).transformationToColorSpace(QColorSpace::SRgb);
+
+    const auto components = decode83(blurhash.first(1));
+    const auto componentX = components % 9 + 1;
+    const auto componentY = components / 9 + 1;
+    const auto maxAC = static_cast<float>(decode83(blurhash.mid(1, 1)) + 1) / 166.f;
+    const auto averageColor = decode83(blurhash.mid(2, 4));
+
+    QList<QColor> values = {toLinearSRGB.map(QColor::fromRgb(averageColor >> 16, (averageColor >> 8) & 255, averageColor & 255))};
+    for (qsizetype c = 6; c < blurhash.size(); c += 2) {
+        const auto value = decode83(blurhash.mid(c, 2));
+        values.append(QColor::fromRgbF(signPow((static_cast<float>(value / (19 * 19)) - 9) / 9, 2) * maxAC,
+                                       signPow((static_cast<float>((value / 19) % 19) - 9) / 9, 2) * maxAC,
+                                       signPow((static_cast<float>(value % 19) - 9) / 9, 2) * maxAC));
+    }
+
+    const auto weights = [](const int dimension, const int components) {
+        QList<float> bases(dimension * components);
+        const auto scale = static_cast<float>(std::numbers::pi) / static_cast<float>(dimension);
+        for (int x = 0; x < dimension; x++) {
+            for (int n = 0; n < components; n++) {
+                bases[x * components + n] = std::cos(scale * static_cast<float>(n * x));
+            }
+        }
+        return bases;
+    };
+    const auto basisX = weights(size.width(), componentX);
+    const auto basisY = weights(size.height(), componentY);
+
+    QImage image(size, QImage::Format_RGB888);
+    image.setColorSpace(QColorSpace::SRgb);
+    for (int y = 0; y < size.height(); y++) {
+        for (int x = 0; x < size.width(); x++) {
+            float r = 0.0f;
+            float g = 0.0f;
+            float b = 0.0f;
+            for (int nx = 0; nx < componentX; nx++) {
+                for (int ny = 0; ny < componentY; ny++) {
+                    const float basis = basisX[x * componentX + nx] * basisY[y * componentY + ny];
+                    r += values[nx + ny * componentX].redF() * basis;
+                    g += values[nx + ny * componentX].greenF() * basis;
+                    b += values[nx + ny * componentX].blueF() * basis;
+                }
+            }
+            image.setPixelColor(x, y, fromLinearSRGB.map(QColor::fromRgbF(r, g, b)));
+        }
+    }
+    return image;
+}
+
+QString encode83(int value, const qsizetype length)
+{
+    QString buffer;
+    do {
+        buffer.prepend(b83Characters[value % 83]);
+    } while ((value /= 83));
+    return buffer.rightJustified(length, u'0');
+}
+
+/*
+ * A direct implementation of the encoder from the specification, working on every pixel
+ * of the image through QColor.
+ */
+QString referenceEncode(const QImage &image, const int componentsX, const int componentsY)
+{
+    const auto toLinearSRGB = QColorSpace(QColorSpace::SRgb).transformationToColorSpace(QColorSpace::SRgbLinear);
+    const auto fromLinearSRGB = QColorSpace(QColorSpace::SRgbLinear).transformationToColorSpace(QColorSpace::SRgb);
+
+    QList<std::array<double, 3>> factors(componentsX * componentsY, {0, 0, 0});
+    for (int y = 0; y < image.height(); y++) {
+        for (int x = 0; x < image.width(); x++) {
+            const auto color = toLinearSRGB.map(image.pixelColor(x, y));
+            for (int ny = 0; ny < componentsY; ny++) {
+                for (int nx = 0; nx < componentsX; nx++) {
+                    const auto basis = std::cos(std::numbers::pi * nx * x / image.width()) * std::cos(std::numbers::pi * ny * y / image.height());
+                    auto &factor = factors[ny * componentsX + nx];
+                    factor[0] += basis * color.redF();
+                    factor[1] += basis * color.greenF();
+                    factor[2] += basis * color.blueF();
+                }
+            }
+        }
+    }
+    for (qsizetype i = 0; i < factors.size(); i++) {
+        for (auto &channel : factors[i]) {
+            channel *= (i == 0 ? 1. : 2.) / (image.width() * image.height());
+        }
+    }
+
+    QString hash = encode83((componentsX - 1) + (componentsY - 1) * 9, 1);
+    double maximumValue = 1;
+    if (factors.size() > 1) {
+        double actualMaximumValue = 0;
+        for (qsizetype i = 1; i < factors.size(); i++) {
+            for (const auto channel : factors[i]) {
+                actualMaximumValue = std::max(actualMaximumValue, std::abs(channel));
+            }
+        }
+        const auto quantisedMaximumValue = std::clamp(static_cast<int>(actualMaximumValue * 166 - 0.5), 0, 82);
+        maximumValue = (quantisedMaximumValue + 1) / 166.;
+        hash += encode83(quantisedMaximumValue, 1);
+    } else {
+        hash += encode83(0, 1);
+    }
+
+    const auto average = fromLinearSRGB.map(QColor::fromRgbF(factors[0][0], factors[0][1], factors[0][2]));
+    hash += encode83((average.red() << 16) + (average.green() << 8) + average.blue(), 4);
+    for (qsizetype i = 1; i < factors.size(); i++) {
+        int value = 0;
+        for (const auto channel : factors[i]) {
+            const auto quantised = std::clamp(std::floor(signPow(channel / maximumValue, 0.5) * 9 + 9.5), 0., 18.);
+            value = value * 19 + static_cast<int>(quantised);
+        }
+        hash += encode83(value, 2);
+    }
+    return hash;
+}
+
+QImage testImage(const QSize &size)
+{
+    QImage image(size, QImage::Format_RGB888);
+    for (int y = 0; y < image.height(); y++) {
+        auto line = image.scanLine(y);
+        for (int x = 0; x < image.width(); x++) {
+            line[x * 3] = (x * 255) / std::max(1, image.width() - 1);
+            line[x * 3 + 1] = (y * 255) / std::max(1, image.height() - 1);
+            line[x * 3 + 2] = ((x / 8 + y / 8) % 2) * 200;
+        }
+    }
+    return image;
+}
+
+int maxDifference(const QImage &first, const QImage &second)
+{
+    int difference = 0;
+    for (int y = 0; y < first.height(); y++) {
+        const auto firstLine = first.constScanLine(y);
+        const auto secondLine = second.constScanLine(y);
+        for (int i = 0; i < first.width() * 3; i++) {
+            difference = std::max(difference, std::abs(firstLine[i] - secondLine[i]));
+        }
+    }
+    return difference;
+}
+
+QString gradientBlurHash()
+{
+    QImage image(64, 48, QImage::Format_RGB888);
+    for (int y = 0; y < image.height(); y++) {
+        for (int x = 0; x < image.width(); x++) {
+            image.setPixelColor(x, y, QColor((x * 255) / 63, (y * 255) / 47, ((x + y) % 16) * 16));
+        }
+    }
+    return BlurHash::encode(image, 9, 9);
+}
+}
+
+class BlurHashTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void decodeParity_data();
+    void decodeParity();
+    void decodeInvalid();
+    void providerSharesDecodes();
+    void encodeParity_data();
+    void encodeParity();
+    void encodeLargeImage();
+
+    void benchmarkReferenceDecode_data();
+    void benchmarkReferenceDecode();
+    void benchmarkDecode_data();
+    void benchmarkDecode();
+    void benchmarkEncode();
+};
+
+void BlurHashTest::decodeParity_data()
+{
+    QTest::addColumn<QString>("blurhash");
+    QTest::addColumn<QSize>("size");
+
+    const QList<std::pair<const char *, QString>> hashes = {
+        {"4x3", u"LEHV6nWB2yk8pyo0adR*.7kCMdnj"_s},
+        {"4x3 dark", u"LGF5]+Yk^6#M@-5c,1J5@[or[Q6."_s},
+        {"9x9 gradient", gradientBlurHash()},
+    };
+    const QList<QSize> sizes = {{1, 1}, {32, 32}, {77, 13}, {200, 150}};
+
+    for (const auto &[name, hash] : hashes) {
+        for (const auto &size : sizes) {
+            QTest::addRow("%s %dx%d", name, size.width(), size.height()) << hash << size;
+        }
+    }
+}
+
+void BlurHashTest::decodeParity()
+{
+    QFETCH(QString, blurhash);
+    QFETCH(QSize, size);
+
+    const auto expected = referenceDecode(blurhash, size);
+    const auto actual = BlurHash::decode(blurhash, size);
+
+    QCOMPARE(actual.size(), size);
+    QCOMPARE(actual.format(), expected.format());
+
+    const auto difference = maxDifference(expected, actual);
+    // The lookup table and the color space transform round slightly differently.
+    QVERIFY2(difference <= 2, qPrintable(u"Maximum channel difference %1"_s.arg(difference)));
+}
+
+void BlurHashTest::decodeInvalid()
+{
+    QVERIFY(BlurHash::decode(u"tooshort"_s, {32, 32}).isNull());
+    QVERIFY(BlurHash::decode(u"LEHV6nWB2yk8pyo0adR*.7kCMdn"_s, {32, 32}).isNull());
+    QVERIFY(BlurHash::decode(u"LEHV6nWB2yk8pyo0adR*.7kCMdn\""_s, {32, 32}).isNull());
+}
+
+void BlurHashTest::providerSharesDecodes()
+{
+    BlurHashImageProvider provider;
+    const auto image = [](QQuickImageResponse *response) {
+        const std::unique_ptr<QQuickTextureFactory> factory(response->textureFactory());
+        return factory->image();
+    };
+
+    // Percent encoded the way QML hands it over.
+    const auto id = u"LEHV6nWB2yk8pyo0adR%2A.7kCMdnj"_s;
+    std::unique_ptr<QQuickImageResponse> first(provider.requestImageResponse(id, {40, 30}));
+    std::unique_ptr<QQuickImageResponse> second(provider.requestImageResponse(id, {40, 30}));
+    QSignalSpy firstSpy(first.get(), &QQuickImageResponse::finished);
+    QSignalSpy secondSpy(second.get(), &QQuickImageResponse::finished);
+    QVERIFY(firstSpy.wait() || firstSpy.count() == 1);
+    QVERIFY(secondSpy.count() == 1 || secondSpy.wait());
+
+    const auto firstImage = image(first.get());
+    QCOMPARE(firstImage.size(), QSize(40, 30));
+    QCOMPARE(firstImage, BlurHash::decode(u"LEHV6nWB2yk8pyo0adR*.7kCMdnj"_s, {40, 30}));
+    // Both requests got the very same decode.
+    QCOMPARE(image(second.get()).cacheKey(), firstImage.cacheKey());
+
+    // Later requests are answered from the cache.
+    std::unique_ptr<QQuickImageResponse> cached(provider.requestImageResponse(id, {40, 30}));
+    QSignalSpy cachedSpy(cached.get(), &QQuickImageResponse::finished);
+    QVERIFY(cachedSpy.wait());
+    QCOMPARE(image(cached.get()).cacheKey(), firstImage.cacheKey());
+
+    // A different size is a different entry.
+    std::unique_ptr<QQuickImageResponse> resized(provider.requestImageResponse(id, {20, 20}));
+    QSignalSpy resizedSpy(resized.get(), &QQuickImageResponse::finished);
+    QVERIFY(resizedSpy.wait());
+    QCOMPARE(image(resized.get()).size(), QSize(20, 20));
+}
+
+void BlurHashTest::encodeParity_data()
+{
+    QTest::addColumn<QSize>("size");
+    QTest::addColumn<int>("componentsX");
+    QTest::addColumn<int>("componentsY");
+
+    QTest::newRow("1x1 components") << QSize(48, 32) << 1 << 1;
+    QTest::newRow("4x3 components") << QSize(48, 32) << 4 << 3;
+    QTest::newRow("9x9 components") << QSize(64, 64) << 9 << 9;
+    QTest::newRow("odd size") << QSize(37, 13) << 5 << 2;
+}
+
+void BlurHashTest::encodeParity()
+{
+    QFETCH(QSize, size);
+    QFETCH(int, componentsX);
+    QFETCH(int, componentsY);
+
+    // Small enough that the encoder works on the image as is.
+    const auto image = testImage(size);
+    const auto expected = referenceEncode(image, componentsX, componentsY);
+    const auto actual = BlurHash::encode(image, componentsX, componentsY);
+
+    QCOMPARE(actual.size(), expected.size());
+    // Rounding can tip a component over a quantisation step, so compare what the hashes look like.
+    QVERIFY(maxDifference(BlurHash::decode(actual, {32, 32}), BlurHash::decode(expected, {32, 32})) <= 3);
+}
+
+void BlurHashTest::encodeLargeImage()
+{
+    const auto image = testImage({1200, 800});
+    const auto hash = BlurHash::encode(image, 4, 3);
+    QCOMPARE(hash.size(), 28);
+
+    // Downscaling first has to give the same placeholder as encoding every pixel.
+    const auto expected = referenceEncode(image.scaled(300, 200, Qt::IgnoreAspectRatio, Qt::SmoothTransformation), 4, 3);
+    QVERIFY(maxDifference(BlurHash::decode(hash, {32, 32}), BlurHash::decode(expected, {32, 32})) <= 6);
+}
+
+void BlurHashTest::benchmarkReferenceDecode_data()
+{
+    QTest::addColumn<QSize>("size");
+
+    QTest::newRow("32x32") << QSize(32, 32);
+    QTest::newRow("256x256") << QSize(256, 256);
+    QTest::newRow("1024x768") << QSize(1024, 768);
+}
+
+void BlurHashTest::benchmarkReferenceDecode()
+{
+    QFETCH(QSize, size);
+    const auto blurhash = u"LEHV6nWB2yk8pyo0adR*.7kCMdnj"_s;
+
+    QBENCHMARK {
+        referenceDecode(blurhash, size);
+    }
+}
+
+void BlurHashTest::benchmarkDecode_data()
+{
+    benchmarkReferenceDecode_data();
+}
+
+void BlurHashTest::benchmarkDecode()
+{
+    QFETCH(QSize, size);
+    const auto blurhash = u"LEHV6nWB2yk8pyo0adR*.7kCMdnj"_s;
+
+    QBENCHMARK {
+        BlurHash::decode(blurhash, size);
+    }
+}
+
+void BlurHashTest::benchmarkEncode()
+{
+    // 24 megapixels, the size of a photo straight from a camera.
+    const auto image = testImage({6000, 4000});
+
+    QBENCHMARK {
+        BlurHash::encode(image, 4, 3);
+    }
+}
+
+QTEST_GUILESS_MAIN(BlurHashTest)
+#include "blurhashtest.moc"
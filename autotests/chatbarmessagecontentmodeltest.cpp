@@ -32,6 +32,7 @@ private Q_SLOTS:
     void missingEvent();
     void addLocationTest();
     void addAttachmentToReply();
+    void restoreFocusFromCache();
 };
 
 void ChatBarMessageContentModelTest::checkEmptyChatbar(const ChatBarMessageContentModel &model)
@@ -86,6 +87,31 @@ void ChatBarMessageContentModelTest::addAttachmentToReply()
     QCOMPARE(model.rowCount(), 3);
 }
 
+void ChatBarMessageContentModelTest::restoreFocusFromCache()
+{
+    Blocks::Cache cache;
+    cache.append(std::make_unique<Blocks::TextCacheItem>(Blocks::Text, QTextDocumentFragment::fromPlainText(u"first"_s)));
+    cache.append(std::make_unique<Blocks::CodeCacheItem>(Blocks::Code, QTextDocumentFragment::fromPlainText(u"code"_s)));
+    cache.append(std::make_unique<Blocks::TextCacheItem>(Blocks::Text, QTextDocumentFragment::fromPlainText(u"last"_s)));
+    cache.setCursor(1, 2);
+
+    auto model = ChatBarMessageContentModel(this);
+    model.setRoom(room.get());
+    model.setCache(&cache);
+    QCOMPARE(model.rowCount(), 3);
+    QCOMPARE(model.focusRow(), 1);
+    QCOMPARE(model.focusType(), Blocks::Code);
+    // The text items aren't shown, so the cached cursor position is kept.
+    QCOMPARE(cache.cursorPosition(), 2);
+
+    // A row that no longer exists falls back to the last one.
+    cache.setCursor(7, 0);
+    auto otherModel = ChatBarMessageContentModel(this);
+    otherModel.setRoom(room.get());
+    otherModel.setCache(&cache);
+    QCOMPARE(otherModel.focusRow(), 2);
+}
+
 QTEST_MAIN(ChatBarMessageContentModelTest)
 
 #include "chatbarmessagecontentmodeltest.moc"
@@ -118,6 +118,39 @@ TestCase {
         compare(spyUnhandledFormat.count, 1);
     }
 
+    function test_corpus(): void {
+        // A long message mixing every inline format, typed one character at a time.
+        const segments = [
+            {input: "**bold** ", text: "bold ", formats: [RichFormat.Bold]},
+            {input: "*italic* ", text: "italic ", formats: [RichFormat.Italic]},
+            {input: "`code` ", text: "code ", formats: [RichFormat.InlineCode]},
+            {input: "~~strike~~ ", text: "strike ", formats: [RichFormat.Strikethrough]},
+            {input: "_under_ ", text: "under ", formats: [RichFormat.Underline]},
+            {input: "plain 1) # > - text ", text: "plain 1) # > - text ", formats: []},
+        ];
+        spyUnhandledFormat.clear();
+
+        let expectedText = "";
+        for (let i = 0; i < 40; i++) {
+            for (const segment of segments) {
+                // Type everything but the closing sequence and the space.
+                const content = segment.input.indexOf(segment.text[0]) + segment.text.length - 1;
+                for (let j = 0; j < content; j++) {
+                    keyClick(segment.input[j]);
+                }
+                compare(chatMarkdownHelper.checkFormats(segment.formats), true);
+                for (let j = content; j < segment.input.length; j++) {
+                    keyClick(segment.input[j]);
+                }
+                expectedText += segment.text;
+                compare(chatMarkdownHelper.checkText(expectedText), true);
+                compare(chatMarkdownHelper.checkFormats([]), true);
+            }
+        }
+
+        compare(spyUnhandledFormat.count, 0);
+    }
+
     function test_backspace(): void {
         keyClick("*");
         compare(chatMarkdownHelper.checkText("*"), true);
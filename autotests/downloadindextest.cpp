@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QFileInfo>
+#include <QObject>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include "downloadindex.h"
+
+using namespace Qt::StringLiterals;
+
+class DownloadIndexTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    QTemporaryDir m_dir;
+    KSharedConfig::Ptr config() const;
+    QString writeFile(const QString &name, const QByteArray &content);
+
+private Q_SLOTS:
+    void init();
+
+    void insertAndFind();
+    void persisted();
+    void staleEntriesForgotten();
+    void deletedFileNoticed();
+    void remove();
+};
+
+KSharedConfig::Ptr DownloadIndexTest::config() const
+{
+    return KSharedConfig::openConfig(m_dir.filePath(u"neochatdownloads"_s), KConfig::SimpleConfig);
+}
+
+QString DownloadIndexTest::writeFile(const QString &name, const QByteArray &content)
+{
+    const auto path = m_dir.filePath(name);
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return {};
+    }
+    file.write(content);
+    return path;
+}
+
+void DownloadIndexTest::init()
+{
+    QVERIFY(m_dir.isValid());
+    config()->deleteGroup(u"downloads"_s);
+    config()->sync();
+}
+
+void DownloadIndexTest::insertAndFind()
+{
+    DownloadIndex index(config());
+    QVERIFY(!index.find(u"example.org/media"_s));
+
+    const auto path = writeFile(u"media.png"_s, "12345");
+    index.insert(u"example.org/media"_s, path);
+
+    const auto entry = index.find(u"example.org/media"_s);
+    QVERIFY(entry);
+    QCOMPARE(entry->path, path);
+    QCOMPARE(entry->directory, m_dir.path());
+    QCOMPARE(entry->size, qint64(5));
+    QCOMPARE(entry->lastModified, QFileInfo(path).lastModified());
+}
+
+void DownloadIndexTest::persisted()
+{
+    const auto path = writeFile(u"media.png"_s, "12345");
+    {
+        DownloadIndex index(config());
+        index.insert(u"example.org/media"_s, path);
+    }
+
+    DownloadIndex index(config());
+    const auto entry = index.find(u"example.org/media"_s);
+    QVERIFY(entry);
+    QCOMPARE(entry->path, path);
+}
+
+void DownloadIndexTest::staleEntriesForgotten()
+{
+    config()->group(u"downloads"_s).writePathEntry(u"example.org/gone"_s, m_dir.filePath(u"gone.png"_s));
+    config()->sync();
+
+    DownloadIndex index(config());
+    QVERIFY(!index.find(u"example.org/gone"_s));
+    QVERIFY(!config()->group(u"downloads"_s).hasKey(u"example.org/gone"_s));
+}
+
+void DownloadIndexTest::deletedFileNoticed()
+{
+    const auto path = writeFile(u"media.png"_s, "12345");
+    DownloadIndex index(config());
+    index.insert(u"example.org/media"_s, path);
+    QVERIFY(index.find(u"example.org/media"_s));
+
+    QVERIFY(QFile::remove(path));
+    QTRY_VERIFY(!index.find(u"example.org/media"_s));
+}
+
+void DownloadIndexTest::remove()
+{
+    const auto path = writeFile(u"media.png"_s, "12345");
+    DownloadIndex index(config());
+    index.insert(u"example.org/media"_s, path);
+    index.remove(u"example.org/media"_s);
+
+    QVERIFY(!index.find(u"example.org/media"_s));
+    QVERIFY(!config()->group(u"downloads"_s).hasKey(u"example.org/media"_s));
+    QVERIFY(QFile::exists(path));
+}
+
+QTEST_GUILESS_MAIN(DownloadIndexTest)
+#include "downloadindextest.moc"
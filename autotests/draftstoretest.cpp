@@ -0,0 +1,321 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QFile>
+#include <QJsonArray>
+#include <QObject>
+#include <QStandardPaths>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <Quotient/connection.h>
+#include <Quotient/syncdata.h>
+
+#include "blockcache.h"
+#include "draftstore.h"
+#include "testutils.h"
+
+using namespace Quotient;
+using namespace Qt::StringLiterals;
+
+class DraftStoreTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    QTemporaryDir m_dir;
+    int m_fileCount = 0;
+
+    QString newFileName();
+    static Blocks::CacheItemPtr textItem(const QString &text);
+    static void enableEncryption(TestUtils::TestRoom *room);
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void debouncedSave();
+    void restart();
+    void emptyDrafts();
+    void saveOnDestruction();
+    void invalidFile();
+    void roomCaches();
+    void roomDestroyed();
+    void prune();
+    void discard();
+    void encryptedRoom();
+};
+
+void DraftStoreTest::enableEncryption(TestUtils::TestRoom *room)
+{
+    const QJsonObject encryptionEvent{
+        {u"type"_s, u"m.room.encryption"_s},
+        {u"event_id"_s, u"$encryption"_s},
+        {u"sender"_s, u"@carol:kde.org"_s},
+        {u"state_key"_s, QString()},
+        {u"origin_server_ts"_s, 1432735824653},
+        {u"content"_s, QJsonObject{{u"algorithm"_s, u"m.megolm.v1.aes-sha2"_s}}},
+    };
+    room->update(SyncRoomData(room->id(), JoinState::Join, QJsonObject{{u"state"_s, QJsonObject{{u"events"_s, QJsonArray{encryptionEvent}}}}}));
+}
+
+QString DraftStoreTest::newFileName()
+{
+    return m_dir.filePath(u"drafts%1"_s.arg(++m_fileCount));
+}
+
+Blocks::CacheItemPtr DraftStoreTest::textItem(const QString &text)
+{
+    return std::make_unique<Blocks::TextCacheItem>(Blocks::Text, QTextDocumentFragment::fromPlainText(text));
+}
+
+void DraftStoreTest::initTestCase()
+{
+    QStandardPaths::setTestModeEnabled(true);
+    QVERIFY(m_dir.isValid());
+}
+
+void DraftStoreTest::debouncedSave()
+{
+    const auto fileName = newFileName();
+    DraftStore store(fileName);
+    Blocks::Cache mainCache;
+    Blocks::Cache editCache;
+    Blocks::Cache threadCache;
+    store.track(u"!room:kde.org"_s, &mainCache, &editCache, &threadCache);
+
+    mainCache.append(textItem(u"draft"_s));
+    mainCache.setCursor(0, 3);
+    // Nothing is written until there are no changes for a while.
+    QVERIFY(!QFile::exists(fileName));
+    QVERIFY(!store.contains(u"!room:kde.org"_s));
+
+    QTRY_VERIFY(QFile::exists(fileName));
+    QVERIFY(store.contains(u"!room:kde.org"_s));
+}
+
+void DraftStoreTest::restart()
+{
+    const auto fileName = newFileName();
+    {
+        DraftStore store(fileName);
+        Blocks::Cache mainCache;
+        Blocks::Cache editCache;
+        Blocks::Cache threadCache;
+        store.track(u"!first:kde.org"_s, &mainCache, &editCache, &threadCache);
+        mainCache.append(std::make_unique<Blocks::ReplyCacheItem>(Blocks::Reply, u"$reply:kde.org"_s));
+        mainCache.append(textItem(u"main draft"_s));
+        mainCache.setCursor(1, 4);
+        editCache.append(textItem(u"edited message"_s));
+        editCache.setEventId(u"$edited:kde.org"_s);
+
+        Blocks::Cache otherMainCache;
+        Blocks::Cache otherEditCache;
+        Blocks::Cache otherThreadCache;
+        store.track(u"!second:kde.org"_s, &otherMainCache, &otherEditCache, &otherThreadCache);
+        otherThreadCache.append(textItem(u"thread draft"_s));
+
+        store.save();
+    }
+
+    DraftStore store(fileName);
+    QVERIFY(store.contains(u"!first:kde.org"_s));
+    QVERIFY(store.contains(u"!second:kde.org"_s));
+
+    // Only the rooms that ask for their drafts get them.
+    Blocks::Cache mainCache;
+    Blocks::Cache editCache;
+    Blocks::Cache threadCache;
+    store.track(u"!first:kde.org"_s, &mainCache, &editCache, &threadCache);
+    QCOMPARE(mainCache.at<Blocks::ReplyCacheItem>(0)->id, u"$reply:kde.org"_s);
+    QCOMPARE(mainCache.toString(), u"main draft"_s);
+    QCOMPARE(mainCache.focusRow(), 1);
+    QCOMPARE(mainCache.cursorPosition(), 4);
+    QCOMPARE(editCache.toString(), u"edited message"_s);
+    QCOMPARE(editCache.eventId(), u"$edited:kde.org"_s);
+    QVERIFY(threadCache.empty());
+
+    Blocks::Cache otherMainCache;
+    Blocks::Cache otherEditCache;
+    Blocks::Cache otherThreadCache;
+    store.track(u"!second:kde.org"_s, &otherMainCache, &otherEditCache, &otherThreadCache);
+    QVERIFY(otherMainCache.empty());
+    QCOMPARE(otherThreadCache.toString(), u"thread draft"_s);
+}
+
+void DraftStoreTest::emptyDrafts()
+{
+    const auto fileName = newFileName();
+    DraftStore store(fileName);
+    Blocks::Cache mainCache;
+    Blocks::Cache editCache;
+    Blocks::Cache threadCache;
+    store.track(u"!room:kde.org"_s, &mainCache, &editCache, &threadCache);
+
+    // Empty text isn't worth keeping.
+    mainCache.append(textItem(u"  "_s));
+    store.save();
+    QVERIFY(!store.contains(u"!room:kde.org"_s));
+
+    mainCache.append(textItem(u"draft"_s));
+    store.save();
+    QVERIFY(store.contains(u"!room:kde.org"_s));
+
+    // Sending the message clears the cache.
+    mainCache.clear();
+    store.save();
+    QVERIFY(!store.contains(u"!room:kde.org"_s));
+    QVERIFY(!DraftStore(fileName).contains(u"!room:kde.org"_s));
+}
+
+void DraftStoreTest::saveOnDestruction()
+{
+    const auto fileName = newFileName();
+    Blocks::Cache mainCache;
+    Blocks::Cache editCache;
+    Blocks::Cache threadCache;
+
+    auto store = std::make_unique<DraftStore>(fileName);
+    store->track(u"!room:kde.org"_s, &mainCache, &editCache, &threadCache);
+    mainCache.append(textItem(u"draft"_s));
+    store.reset();
+
+    QVERIFY(DraftStore(fileName).contains(u"!room:kde.org"_s));
+}
+
+void DraftStoreTest::invalidFile()
+{
+    const auto fileName = newFileName();
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write("not a drafts file");
+    file.close();
+
+    DraftStore store(fileName);
+    QVERIFY(!store.contains(u"!room:kde.org"_s));
+
+    Blocks::Cache mainCache;
+    Blocks::Cache editCache;
+    Blocks::Cache threadCache;
+    store.track(u"!room:kde.org"_s, &mainCache, &editCache, &threadCache);
+    QVERIFY(mainCache.empty());
+
+    // The broken file is replaced on the next save.
+    mainCache.append(textItem(u"draft"_s));
+    store.save();
+    QVERIFY(DraftStore(fileName).contains(u"!room:kde.org"_s));
+}
+
+void DraftStoreTest::roomCaches()
+{
+    auto connection = Connection::makeMockConnection(u"@bob:kde.org"_s);
+    auto room = new TestUtils::TestRoom(connection, u"!drafts:kde.org"_s);
+
+    room->mainCache()->append(textItem(u"room draft"_s));
+    const auto store = DraftStore::forConnection(connection);
+    QCOMPARE(DraftStore::forConnection(connection), store);
+    store->save();
+    QVERIFY(store->contains(u"!drafts:kde.org"_s));
+}
+
+void DraftStoreTest::roomDestroyed()
+{
+    auto connection = Connection::makeMockConnection(u"@alice:kde.org"_s);
+    const auto room = new TestUtils::TestRoom(connection, u"!destroyed:kde.org"_s);
+    const auto store = DraftStore::forConnection(connection);
+
+    // The change is still waiting for SaveDelay when the room goes away.
+    room->mainCache()->append(textItem(u"room draft"_s));
+    delete room;
+    store->save();
+    QVERIFY(store->contains(u"!destroyed:kde.org"_s));
+}
+
+void DraftStoreTest::prune()
+{
+    const auto fileName = newFileName();
+    {
+        DraftStore store(fileName);
+        for (const auto &roomId : {u"!joined:kde.org"_s, u"!left:kde.org"_s, u"!tracked:kde.org"_s}) {
+            Blocks::Cache mainCache;
+            Blocks::Cache editCache;
+            Blocks::Cache threadCache;
+            store.track(roomId, &mainCache, &editCache, &threadCache);
+            mainCache.append(textItem(u"draft"_s));
+            store.save();
+            store.untrack(roomId);
+        }
+    }
+
+    DraftStore store(fileName);
+    Blocks::Cache mainCache;
+    Blocks::Cache editCache;
+    Blocks::Cache threadCache;
+    store.track(u"!tracked:kde.org"_s, &mainCache, &editCache, &threadCache);
+    QCOMPARE(mainCache.toString(), u"draft"_s);
+
+    store.prune([](const QString &roomId) {
+        return roomId == u"!joined:kde.org"_s;
+    });
+    QVERIFY(store.contains(u"!joined:kde.org"_s));
+    QVERIFY(!store.contains(u"!left:kde.org"_s));
+    QVERIFY(!store.contains(u"!tracked:kde.org"_s));
+
+    // Removed rooms aren't saved again when their caches change.
+    mainCache.append(textItem(u"more"_s));
+    store.save();
+    QVERIFY(!store.contains(u"!tracked:kde.org"_s));
+
+    const DraftStore restarted(fileName);
+    QVERIFY(restarted.contains(u"!joined:kde.org"_s));
+    QVERIFY(!restarted.contains(u"!left:kde.org"_s));
+    QVERIFY(!restarted.contains(u"!tracked:kde.org"_s));
+}
+
+void DraftStoreTest::discard()
+{
+    const auto fileName = newFileName();
+    DraftStore store(fileName);
+    Blocks::Cache mainCache;
+    Blocks::Cache editCache;
+    Blocks::Cache threadCache;
+    store.track(u"!room:kde.org"_s, &mainCache, &editCache, &threadCache);
+    mainCache.append(textItem(u"draft"_s));
+    store.save();
+    QVERIFY(QFile::exists(fileName));
+
+    mainCache.append(textItem(u"pending"_s));
+    store.discard();
+    QVERIFY(!QFile::exists(fileName));
+    QVERIFY(!store.contains(u"!room:kde.org"_s));
+
+    mainCache.append(textItem(u"after logout"_s));
+    store.save();
+    QVERIFY(!QFile::exists(fileName));
+}
+
+void DraftStoreTest::encryptedRoom()
+{
+    auto connection = Connection::makeMockConnection(u"@carol:kde.org"_s);
+    const auto store = DraftStore::forConnection(connection);
+    const auto room = new TestUtils::TestRoom(connection, u"!encrypted:kde.org"_s);
+    room->mainCache()->append(textItem(u"secret draft"_s));
+    store->save();
+    QVERIFY(store->contains(u"!encrypted:kde.org"_s));
+
+    // Turning on encryption drops what was saved.
+    enableEncryption(room);
+    QVERIFY(room->usesEncryption());
+    room->mainCache()->append(textItem(u"more secrets"_s));
+    store->save();
+    QVERIFY(!store->contains(u"!encrypted:kde.org"_s));
+
+    // Rooms that are encrypted from the start are never tracked.
+    const auto encryptedRoom = new TestUtils::TestRoom(connection, u"!alreadyencrypted:kde.org"_s);
+    enableEncryption(encryptedRoom);
+    encryptedRoom->mainCache()->append(textItem(u"secret draft"_s));
+    store->save();
+    QVERIFY(!store->contains(u"!alreadyencrypted:kde.org"_s));
+}
+
+QTEST_MAIN(DraftStoreTest)
+#include "draftstoretest.moc"
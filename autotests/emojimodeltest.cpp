@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QMetaEnum>
+#include <QMultiHash>
+#include <QObject>
+#include <QStandardPaths>
+#include <QTest>
+
+#include "models/emojimodel.h"
+
+using namespace Qt::StringLiterals;
+
+namespace
+{
+struct {
+    EmojiModel::Category category;
+    const char8_t *escaped_sequence;
+    const char8_t *shortcode;
+    const char8_t *description;
+} constexpr const emoji_data[] = {
+#include "emojis.h"
+};
+
+struct {
+    const char8_t *name;
+    const char8_t *escaped_sequence;
+    const char8_t *shortcode;
+    const char8_t *description;
+} constexpr const tones_data[] = {
+#include "emojitones_data.h"
+};
+
+bool operator==(const Emoji &left, const Emoji &right)
+{
+    return left.unicode == right.unicode && left.shortName == right.shortName && left.description == right.description && left.isCustom == right.isCustom;
+}
+}
+
+// Checks EmojiModel against the tables the way it used to build them, a QVariantList per category and a QMultiHash of tones.
+class EmojiModelTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void rows();
+    void categories_data();
+    void categories();
+    void tones();
+    void quickReactions();
+};
+
+void EmojiModelTest::initTestCase()
+{
+    QStandardPaths::setTestModeEnabled(true);
+}
+
+void EmojiModelTest::rows()
+{
+    const auto &model = EmojiModel::instance();
+    QCOMPARE(model.rowCount(), int(std::size(emoji_data)));
+
+    for (int row = 0; row < model.rowCount(); ++row) {
+        const auto index = model.index(row, 0);
+        const auto shortName = u":%1:"_s.arg(QString::fromUtf8(emoji_data[row].shortcode));
+        const auto unicode = QString::fromUtf8(emoji_data[row].escaped_sequence);
+        QCOMPARE(model.data(index, EmojiModel::ShortNameRole).toString(), shortName);
+        QCOMPARE(model.data(index, EmojiModel::UnicodeRole).toString(), unicode);
+        QCOMPARE(model.data(index, EmojiModel::ReplacedTextRole).toString(), unicode);
+        QCOMPARE(model.data(index, EmojiModel::DescriptionRole).toString(), QString::fromUtf8(emoji_data[row].description));
+        QCOMPARE(model.data(index, EmojiModel::DisplayRole).toString(), u"%2   %1"_s.arg(shortName, unicode));
+    }
+    QVERIFY(!model.data(model.index(model.rowCount(), 0), EmojiModel::ShortNameRole).isValid());
+}
+
+void EmojiModelTest::categories_data()
+{
+    QTest::addColumn<EmojiModel::Category>("category");
+
+    for (const auto category : {EmojiModel::Smileys,
+                                EmojiModel::People,
+                                EmojiModel::Nature,
+                                EmojiModel::Food,
+                                EmojiModel::Activities,
+                                EmojiModel::Travel,
+                                EmojiModel::Objects,
+                                EmojiModel::Symbols,
+                                EmojiModel::Flags,
+                                EmojiModel::Component}) {
+        QTest::newRow(QMetaEnum::fromType<EmojiModel::Category>().valueToKey(category)) << category;
+    }
+}
+
+void EmojiModelTest::categories()
+{
+    QFETCH(EmojiModel::Category, category);
+
+    QList<Emoji> expected;
+    for (const auto &emoji : emoji_data) {
+        if (emoji.category == category) {
+            expected += Emoji(QString::fromUtf8(emoji.escaped_sequence),
+                              u":%1:"_s.arg(QString::fromUtf8(emoji.shortcode)),
+                              QString::fromUtf8(emoji.description));
+        }
+    }
+    QVERIFY(!expected.isEmpty());
+
+    const auto emojis = EmojiModel::instance().emojis(category);
+    QCOMPARE(emojis.size(), expected.size());
+    for (qsizetype i = 0; i < emojis.size(); ++i) {
+        QVERIFY(emojis[i].value<Emoji>() == expected[i]);
+    }
+}
+
+void EmojiModelTest::tones()
+{
+    QMultiHash<QString, Emoji> expected;
+    for (const auto &tone : tones_data) {
+        expected.insert(QString::fromUtf8(tone.name),
+                        Emoji(QString::fromUtf8(tone.escaped_sequence), QString::fromUtf8(tone.shortcode), QString::fromUtf8(tone.description)));
+    }
+
+    const auto &model = EmojiModel::instance();
+    for (const auto &name : expected.uniqueKeys()) {
+        const auto tones = model.tones(name);
+        const auto expectedTones = expected.values(name);
+        QCOMPARE(tones.size(), expectedTones.size());
+        for (qsizetype i = 0; i < tones.size(); ++i) {
+            QVERIFY(tones[i] == expectedTones[i]);
+        }
+    }
+
+    // Tone variants are looked up by their base emoji.
+    QCOMPARE(model.tones(u"waving hand: light skin tone"_s).size(), expected.count(u"waving hand"_s));
+    QVERIFY(model.tones(u"no such emoji"_s).isEmpty());
+}
+
+void EmojiModelTest::quickReactions()
+{
+    QStringList shortNames;
+    for (const auto &reaction : EmojiModel::instance().quickReactions()) {
+        const auto emoji = reaction.value<Emoji>();
+        QVERIFY(!emoji.isCustom);
+        shortNames += emoji.shortName;
+    }
+    QCOMPARE(shortNames, (QStringList{u":thumbsup:"_s, u":thumbsdown:"_s, u":smile:"_s, u":tada:"_s, u":red heart:"_s}));
+}
+
+QTEST_GUILESS_MAIN(EmojiModelTest)
+#include "emojimodeltest.moc"
@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QObject>
+#include <QStandardPaths>
+#include <QTest>
+
+#include "emojisearchindex.h"
+#include "models/emojimodel.h"
+
+using namespace Qt::StringLiterals;
+
+class EmojiSearchIndexTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    static EmojiSearchIndex smallIndex();
+    static QList<EmojiSearchIndex::Entry> allEmojis();
+    static const QStringList &typedQueries();
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void find();
+    void ranking();
+    void colonsAndCase();
+    void recentFirst();
+    void limit();
+    void noMatch();
+    void emojiModelSearch();
+
+    void benchmarkBuild();
+    void benchmarkSearch();
+    void benchmarkLinearScan();
+};
+
+EmojiSearchIndex EmojiSearchIndexTest::smallIndex()
+{
+    return EmojiSearchIndex({
+        {u":smiley:"_s, u"grinning face with big eyes"_s},
+        {u":smile:"_s, u"grinning face with smiling eyes"_s},
+        {u":sweat_smile:"_s, u"grinning face with sweat"_s},
+        {u":smiling_imp:"_s, u"smiling face with horns"_s},
+        {u":thumbsup:"_s, u"thumbs up"_s},
+    });
+}
+
+QList<EmojiSearchIndex::Entry> EmojiSearchIndexTest::allEmojis()
+{
+    const auto &model = EmojiModel::instance();
+    QList<EmojiSearchIndex::Entry> entries;
+    for (int row = 0; row < model.rowCount(); ++row) {
+        const auto index = model.index(row, 0);
+        entries += {model.data(index, EmojiModel::ShortNameRole).toString(), model.data(index, EmojiModel::DescriptionRole).toString()};
+    }
+    return entries;
+}
+
+// What gets searched while typing a few shortcodes, one character at a time.
+const QStringList &EmojiSearchIndexTest::typedQueries()
+{
+    static const QStringList queries = [] {
+        QStringList queries;
+        for (const auto &shortName : {u":thumbsup"_s, u":smiling_imp"_s, u":heart_eyes"_s, u":flag_"_s, u":rocket"_s}) {
+            for (qsizetype length = 2; length <= shortName.size(); ++length) {
+                queries += shortName.first(length);
+            }
+        }
+        return queries;
+    }();
+    return queries;
+}
+
+void EmojiSearchIndexTest::initTestCase()
+{
+    QStandardPaths::setTestModeEnabled(true);
+}
+
+void EmojiSearchIndexTest::find()
+{
+    const auto index = smallIndex();
+    QCOMPARE(index.size(), qsizetype(5));
+    QCOMPARE(index.find(u":smile:"), 1);
+    QCOMPARE(index.find(u"smile"), 1);
+    QCOMPARE(index.find(u":smil:"), -1);
+}
+
+void EmojiSearchIndexTest::ranking()
+{
+    const auto index = smallIndex();
+
+    // The exact shortcode, then the shortcodes starting with it, then the ones with a word starting with it.
+    QCOMPARE(index.search(u"smile"), (QList<int>{1, 0, 2}));
+    QCOMPARE(index.search(u"smil"), (QList<int>{0, 1, 3, 2}));
+
+    // Words of the description match as well.
+    QCOMPARE(index.search(u"horn"), QList<int>{3});
+    QCOMPARE(index.search(u"grinning"), (QList<int>{0, 1, 2}));
+}
+
+void EmojiSearchIndexTest::colonsAndCase()
+{
+    const auto index = smallIndex();
+    QCOMPARE(index.search(u":SMILE:"), index.search(u"smile"));
+    QCOMPARE(index.search(u":Thumbs"), QList<int>{4});
+}
+
+void EmojiSearchIndexTest::recentFirst()
+{
+    auto index = smallIndex();
+    index.setRecent({u":sweat_smile:"_s, u":smiling_imp:"_s, u":unknown:"_s});
+
+    // Recent use reorders the matches within a kind of match, but never across them.
+    QCOMPARE(index.search(u"smil"), (QList<int>{3, 0, 1, 2}));
+    QCOMPARE(index.search(u"smile"), (QList<int>{1, 0, 2}));
+
+    index.setRecent({});
+    QCOMPARE(index.search(u"smil"), (QList<int>{0, 1, 3, 2}));
+}
+
+void EmojiSearchIndexTest::limit()
+{
+    const auto index = smallIndex();
+    QCOMPARE(index.search(u"smil", 2), (QList<int>{0, 1}));
+    QCOMPARE(index.search(u"smil", 10), (QList<int>{0, 1, 3, 2}));
+    QVERIFY(index.search(u"smil", 0).isEmpty());
+}
+
+void EmojiSearchIndexTest::noMatch()
+{
+    const auto index = smallIndex();
+    QVERIFY(index.search(u"").isEmpty());
+    QVERIFY(index.search(u"::").isEmpty());
+    QVERIFY(index.search(u"frown").isEmpty());
+    // Only the start of words matches.
+    QVERIFY(index.search(u"mile").isEmpty());
+}
+
+void EmojiSearchIndexTest::emojiModelSearch()
+{
+    const auto results = EmojiModel::filterModelNoCustom(u":thumbsup:"_s);
+    QVERIFY(!results.isEmpty());
+    QCOMPARE(results.first().value<Emoji>().shortName, u":thumbsup:"_s);
+    QVERIFY(results.size() <= 11);
+
+    const auto all = EmojiModel::instance().search(u":smil"_s);
+    QVERIFY(all.size() > 11);
+    for (const auto &emoji : all) {
+        QVERIFY(emoji.shortName.contains(u"smil"_s, Qt::CaseInsensitive) || emoji.description.contains(u"smil"_s, Qt::CaseInsensitive));
+    }
+}
+
+void EmojiSearchIndexTest::benchmarkBuild()
+{
+    const auto entries = allEmojis();
+    QVERIFY(entries.size() > 1000);
+
+    QBENCHMARK {
+        EmojiSearchIndex index(entries);
+        QCOMPARE(index.size(), entries.size());
+    }
+}
+
+void EmojiSearchIndexTest::benchmarkSearch()
+{
+    const EmojiSearchIndex index(allEmojis());
+
+    QBENCHMARK {
+        for (const auto &query : typedQueries()) {
+            index.search(query);
+        }
+    }
+}
+
+// How completion used to filter: every shortcode and description, for every keystroke.
+void EmojiSearchIndexTest::benchmarkLinearScan()
+{
+    const auto entries = allEmojis();
+
+    QBENCHMARK {
+        for (const auto &query : typedQueries()) {
+            QList<int> results;
+            for (int id = 0; id < entries.size(); ++id) {
+                if (entries[id].shortName.startsWith(query, Qt::CaseInsensitive)
+                    || entries[id].description.startsWith(QStringView(query).sliced(1), Qt::CaseInsensitive)) {
+                    results += id;
+                }
+            }
+        }
+    }
+}
+
+QTEST_GUILESS_MAIN(EmojiSearchIndexTest)
+#include "emojisearchindextest.moc"
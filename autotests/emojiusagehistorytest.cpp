@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QObject>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <KConfig>
+#include <KConfigGroup>
+#include <KSharedConfig>
+
+#include <memory>
+
+#include "emojiusagehistory.h"
+
+using namespace Qt::StringLiterals;
+
+class EmojiUsageHistoryTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    QTemporaryDir m_dir;
+    QString m_path;
+
+    std::unique_ptr<EmojiUsageHistory> makeHistory() const;
+    // What another process would read from the config file.
+    QStringList savedShortNames() const;
+
+private Q_SLOTS:
+    void init();
+
+    void decay();
+    void ranking();
+    void maxEntries();
+    void debouncedSave();
+    void saveOnDestruction();
+    void restart();
+    void migration();
+};
+
+std::unique_ptr<EmojiUsageHistory> EmojiUsageHistoryTest::makeHistory() const
+{
+    return std::make_unique<EmojiUsageHistory>(KSharedConfig::openConfig(m_path, KConfig::SimpleConfig));
+}
+
+QStringList EmojiUsageHistoryTest::savedShortNames() const
+{
+    return KConfig(m_path, KConfig::SimpleConfig).group(u"Editor"_s).readEntry(u"lastUsedEmojis"_s, QStringList());
+}
+
+void EmojiUsageHistoryTest::init()
+{
+    static int count = 0;
+    m_path = m_dir.filePath(u"emojistaterc%1"_s.arg(++count));
+}
+
+void EmojiUsageHistoryTest::decay()
+{
+    auto history = makeHistory();
+    const qint64 start = 1700000000000;
+    QCOMPARE(history->score(u":tada:"_s, start), 0.0);
+
+    history->recordUse(u":tada:"_s, start);
+    history->recordUse(u":tada:"_s, start);
+    QCOMPARE(history->score(u":tada:"_s, start), 2.0);
+    QCOMPARE(history->score(u":tada:"_s, start + EmojiUsageHistory::HalfLife), 1.0);
+    QCOMPARE(history->score(u":tada:"_s, start + 2 * EmojiUsageHistory::HalfLife), 0.5);
+
+    // A later use adds to the decayed score.
+    history->recordUse(u":tada:"_s, start + EmojiUsageHistory::HalfLife);
+    QCOMPARE(history->score(u":tada:"_s, start + EmojiUsageHistory::HalfLife), 2.0);
+}
+
+void EmojiUsageHistoryTest::ranking()
+{
+    auto history = makeHistory();
+    const qint64 start = 1700000000000;
+    for (int i = 0; i < 3; ++i) {
+        history->recordUse(u":smile:"_s, start);
+    }
+    history->recordUse(u":wave:"_s, start + 1000);
+    // Used more often beats used more recently...
+    QCOMPARE(history->shortNames(), (QStringList{u":smile:"_s, u":wave:"_s}));
+
+    // ...until the uses are old enough.
+    history->recordUse(u":heart:"_s, start + 2 * EmojiUsageHistory::HalfLife);
+    QCOMPARE(history->shortNames(), (QStringList{u":heart:"_s, u":smile:"_s, u":wave:"_s}));
+
+    history->recordUse(u":heart:"_s, start + 2 * EmojiUsageHistory::HalfLife);
+    history->recordUse(u":wave:"_s, start + 3 * EmojiUsageHistory::HalfLife);
+    QCOMPARE(history->shortNames(), (QStringList{u":wave:"_s, u":heart:"_s, u":smile:"_s}));
+}
+
+void EmojiUsageHistoryTest::maxEntries()
+{
+    auto history = makeHistory();
+    const qint64 start = 1700000000000;
+    for (int i = 0; i < EmojiUsageHistory::MaxEntries + 20; ++i) {
+        history->recordUse(u":emoji%1:"_s.arg(i), start + i * 1000);
+    }
+    QCOMPARE(history->shortNames().size(), EmojiUsageHistory::MaxEntries);
+    QCOMPARE(history->shortNames().first(), u":emoji%1:"_s.arg(EmojiUsageHistory::MaxEntries + 19));
+    QCOMPARE(history->shortNames().last(), u":emoji20:"_s);
+    QCOMPARE(history->score(u":emoji0:"_s), 0.0);
+}
+
+void EmojiUsageHistoryTest::debouncedSave()
+{
+    auto history = makeHistory();
+    history->recordUse(u":smile:"_s);
+    history->recordUse(u":wave:"_s);
+    history->recordUse(u":wave:"_s);
+
+    // Nothing is written right away...
+    QVERIFY(savedShortNames().isEmpty());
+
+    // ...but shortly after the last use.
+    QTRY_COMPARE_WITH_TIMEOUT(savedShortNames(), (QStringList{u":wave:"_s, u":smile:"_s}), 5 * EmojiUsageHistory::SaveDelay);
+}
+
+void EmojiUsageHistoryTest::saveOnDestruction()
+{
+    auto history = makeHistory();
+    history->recordUse(u":smile:"_s);
+    QVERIFY(savedShortNames().isEmpty());
+
+    history.reset();
+    QCOMPARE(savedShortNames(), QStringList{u":smile:"_s});
+}
+
+void EmojiUsageHistoryTest::restart()
+{
+    const qint64 start = QDateTime::currentMSecsSinceEpoch() - 3 * EmojiUsageHistory::HalfLife;
+    QStringList shortNames;
+    QList<double> scores;
+    {
+        auto history = makeHistory();
+        for (int i = 0; i < 4; ++i) {
+            history->recordUse(u":smile:"_s, start);
+        }
+        history->recordUse(u":wave:"_s, start + EmojiUsageHistory::HalfLife);
+        history->recordUse(u":heart:"_s, start + 3 * EmojiUsageHistory::HalfLife);
+        history->recordUse(u":smile:"_s, start + 3 * EmojiUsageHistory::HalfLife);
+        shortNames = history->shortNames();
+        for (const auto &shortName : std::as_const(shortNames)) {
+            scores += history->score(shortName, start + 3 * EmojiUsageHistory::HalfLife);
+        }
+        QCOMPARE(shortNames, (QStringList{u":smile:"_s, u":heart:"_s, u":wave:"_s}));
+    }
+
+    for (int restart = 0; restart < 2; ++restart) {
+        auto history = makeHistory();
+        QCOMPARE(history->shortNames(), shortNames);
+        for (qsizetype i = 0; i < shortNames.size(); ++i) {
+            QCOMPARE(history->score(shortNames[i], start + 3 * EmojiUsageHistory::HalfLife), scores[i]);
+        }
+    }
+
+    // Uses after a restart build on the saved scores.
+    {
+        auto history = makeHistory();
+        history->recordUse(u":wave:"_s, start + 3 * EmojiUsageHistory::HalfLife);
+        QCOMPARE(history->score(u":wave:"_s, start + 3 * EmojiUsageHistory::HalfLife), scores[2] + 1);
+    }
+    QCOMPARE(makeHistory()->score(u":wave:"_s, start + 3 * EmojiUsageHistory::HalfLife), scores[2] + 1);
+}
+
+void EmojiUsageHistoryTest::migration()
+{
+    {
+        KConfig config(m_path, KConfig::SimpleConfig);
+        config.group(u"Editor"_s).writeEntry(u"lastUsedEmojis"_s, QStringList{u":wave:"_s, u":smile:"_s, u":wave:"_s, u":heart:"_s});
+    }
+
+    // The list written by older versions keeps its order.
+    auto history = makeHistory();
+    QCOMPARE(history->shortNames(), (QStringList{u":wave:"_s, u":smile:"_s, u":heart:"_s}));
+    const auto score = history->score(u":smile:"_s);
+    QVERIFY(score > 0.99 && score <= 1);
+}
+
+QTEST_GUILESS_MAIN(EmojiUsageHistoryTest)
+#include "emojiusagehistorytest.moc"
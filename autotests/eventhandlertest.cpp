@@ -16,6 +16,7 @@
 
 #include "block.h"
 #include "enums/blocktype.h"
+#include "mediathumbnailcache.h"
 
 #include "testutils.h"
 
@@ -315,7 +316,7 @@ void EventHandlerTest::mediaInfo()
     QCOMPARE(videoBlock->info().duration, 10);
     QCOMPARE(videoBlock->info().pixelSize.width(), 1920);
     QCOMPARE(videoBlock->info().pixelSize.height(), 1080);
-    QCOMPARE(videoBlock->thumbnailSource(), room->makeMediaUrl(event->id(), QUrl("mxc://kde.org/2234567"_L1)));
+    QCOMPARE(videoBlock->thumbnailSource(), MediaThumbnailCache::imageUrl(room->makeMediaUrl(event->id(), QUrl("mxc://kde.org/2234567"_L1))));
     QCOMPARE(videoBlock->thumbnailInfo().mimeType.name(), u"image/jpeg"_s);
     QCOMPARE(videoBlock->thumbnailInfo().mimeType.iconName(), u"image-jpeg"_s);
     QCOMPARE(videoBlock->thumbnailInfo().size, 382249);
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+// Stands in for kitinerary-extractor in tests.
+//
+// Every run is appended to the file named by FAKE_EXTRACTOR_LOG and sleeps for
+// FAKE_EXTRACTOR_DELAY milliseconds before answering. Files containing
+// "TrainReservation" produce one train reservation, all other files none.
+
+#include <QFile>
+#include <QThread>
+
+#include <cstdio>
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        return 1;
+    }
+    const auto path = QString::fromLocal8Bit(argv[1]);
+
+    if (const auto logPath = qEnvironmentVariable("FAKE_EXTRACTOR_LOG"); !logPath.isEmpty()) {
+        QFile log(logPath);
+        if (log.open(QIODevice::Append)) {
+            log.write(path.toUtf8() + '\n');
+        }
+    }
+    if (const auto delay = qEnvironmentVariableIntValue("FAKE_EXTRACTOR_DELAY"); delay > 0) {
+        QThread::msleep(delay);
+    }
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return 1;
+    }
+    if (file.readAll().contains("TrainReservation")) {
+        std::fputs(R"([{"@type":"TrainReservation","reservationFor":{"trainName":"ICE","trainNumber":"123"}}])", stdout);
+    } else {
+        std::fputs("[]", stdout);
+    }
+    return 0;
+}
@@ -4,10 +4,13 @@
 #include <QObject>
 #include <QProcess>
 #include <QSignalSpy>
+#include <QTemporaryDir>
 #include <QTest>
 
 #include "config-neochat.h"
 #include "enums/blocktype.h"
+#include "block.h"
+#include "chattextitemhelper.h"
 #include "filepreview.h"
 
 using namespace Qt::StringLiterals;
@@ -20,11 +23,17 @@ class FilePreviewTest : public QObject
 private:
     bool m_extractorAvailable = false;
 
+    QTemporaryDir m_dir;
+    QString writeLog(const QString &name, qint64 size);
+
 private Q_SLOTS:
     void initTestCase();
 
     void fileTest_data();
     void fileTest();
+    void largeTextTest();
+
+    void benchmarkLargeLog();
 };
 
 void FilePreviewTest::initTestCase()
@@ -86,5 +95,72 @@ void FilePreviewTest::fileTest()
     }
 }
 
+namespace
+{
+// Every line is the same length so the number that fit in the preview is known.
+const auto logLine = "2026-10-19T12:00:00.000Z INFO  neochat.sync: received 42 events for !room:example.org\n"_ba;
+}
+
+QString FilePreviewTest::writeLog(const QString &name, qint64 size)
+{
+    const auto path = m_dir.filePath(name);
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return {};
+    }
+    for (qint64 written = 0; written < size; written += logLine.size()) {
+        file.write(logLine);
+    }
+    return path;
+}
+
+void FilePreviewTest::largeTextTest()
+{
+    const auto path = writeLog(u"large.log"_s, FilePreviewBlockLoader::MaxPreviewBytes * 4);
+    QVERIFY(!path.isEmpty());
+
+    const auto loader = new FilePreviewBlockLoader(this, QUrl::fromLocalFile(path));
+    QSignalSpy spyAvailable(loader, &FilePreviewBlockLoader::blockAvailable);
+    QCOMPARE(loader->state(), FilePreviewBlockLoader::Loading);
+    QVERIFY(spyAvailable.wait(30000));
+    QCOMPARE(spyAvailable.count(), 1);
+    QCOMPARE(loader->state(), FilePreviewBlockLoader::Available);
+
+    const auto block = qobject_cast<CodeBlock *>(loader->previewBlock());
+    QVERIFY(block);
+    QVERIFY(block->highlighted());
+
+    // A block restored from the cache still skips its own highlighter.
+    const auto cacheItem = block->toCacheItem();
+    const auto codeItem = dynamic_cast<CodeCacheItem *>(cacheItem.get());
+    QVERIFY(codeItem);
+    QVERIFY(codeItem->highlighted);
+    QVERIFY(CodeBlock(codeItem, this).highlighted());
+
+    // Only whole lines from the start of the file are shown and the rest arrive after the block.
+    const qsizetype expectedLines = FilePreviewBlockLoader::MaxPreviewBytes / logLine.size();
+    QVERIFY(expectedLines > FilePreviewBlockLoader::ChunkLines);
+    QTRY_COMPARE_WITH_TIMEOUT(block->item()->toFragment().toPlainText().count(u'\n') + 1, expectedLines, 30000);
+    const auto text = block->item()->toFragment().toPlainText();
+    QVERIFY(text.startsWith(QString::fromLatin1(logLine.chopped(1))));
+    QVERIFY(text.endsWith(QString::fromLatin1(logLine.chopped(1))));
+}
+
+void FilePreviewTest::benchmarkLargeLog()
+{
+    const auto path = writeLog(u"benchmark.log"_s, 10 * 1024 * 1024);
+    QVERIFY(!path.isEmpty());
+
+    QBENCHMARK {
+        const auto loader = new FilePreviewBlockLoader(this, QUrl::fromLocalFile(path));
+        if (loader->state() == FilePreviewBlockLoader::Loading) {
+            QSignalSpy spyAvailable(loader, &FilePreviewBlockLoader::blockAvailable);
+            QVERIFY(spyAvailable.wait(30000));
+        }
+        delete loader->previewBlock();
+        delete loader;
+    }
+}
+
 QTEST_MAIN(FilePreviewTest)
 #include "filepreviewtest.moc"
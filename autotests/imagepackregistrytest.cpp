@@ -0,0 +1,270 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QJsonArray>
+#include <QObject>
+#include <QSignalSpy>
+#include <QTest>
+
+#include <Quotient/connection.h>
+#include <Quotient/syncdata.h>
+
+#include "imagepackregistry.h"
+#include "models/customemojimodel.h"
+#include "models/imagepacksmodel.h"
+#include "testutils.h"
+
+using namespace Quotient;
+using namespace Qt::StringLiterals;
+
+class ImagePackRegistryTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    Connection *connection = nullptr;
+    int m_eventCount = 0;
+
+    QJsonObject packEvent(const QString &stateKey, const QString &displayName, const QJsonArray &usage, const QStringList &shortcodes);
+    static QJsonObject images(const QStringList &shortcodes, const QJsonArray &usage = {});
+    static void sync(TestUtils::TestRoom *room, const QString &section, const QJsonArray &events);
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void usages();
+    void accountPack();
+    void roomPacks();
+    void subscribedPacks();
+    void imagePacksModel();
+    void customEmojiSearch();
+};
+
+QJsonObject ImagePackRegistryTest::images(const QStringList &shortcodes, const QJsonArray &usage)
+{
+    QJsonObject images;
+    for (const auto &shortcode : shortcodes) {
+        QJsonObject image{{u"url"_s, u"mxc://example.org/%1"_s.arg(shortcode)}};
+        if (!usage.isEmpty()) {
+            image[u"usage"_s] = usage;
+        }
+        images[shortcode] = image;
+    }
+    return images;
+}
+
+QJsonObject ImagePackRegistryTest::packEvent(const QString &stateKey, const QString &displayName, const QJsonArray &usage, const QStringList &shortcodes)
+{
+    QJsonObject pack{{u"display_name"_s, displayName}};
+    if (!usage.isEmpty()) {
+        pack[u"usage"_s] = usage;
+    }
+    return QJsonObject{
+        {u"type"_s, u"im.ponies.room_emotes"_s},
+        {u"event_id"_s, u"$pack%1"_s.arg(++m_eventCount)},
+        {u"sender"_s, u"@bob:kde.org"_s},
+        {u"state_key"_s, stateKey},
+        {u"origin_server_ts"_s, 1432735824653 + m_eventCount},
+        {u"content"_s,
+         QJsonObject{
+             {u"pack"_s, pack},
+             {u"images"_s, images(shortcodes)},
+         }},
+    };
+}
+
+void ImagePackRegistryTest::sync(TestUtils::TestRoom *room, const QString &section, const QJsonArray &events)
+{
+    room->update(SyncRoomData(room->id(), JoinState::Join, QJsonObject{{section, QJsonObject{{u"events"_s, events}}}}));
+}
+
+void ImagePackRegistryTest::initTestCase()
+{
+    connection = Connection::makeMockConnection(u"@bob:kde.org"_s);
+}
+
+void ImagePackRegistryTest::usages()
+{
+    QCOMPARE(ImagePackRegistry::usages(std::nullopt), ImagePackRegistry::Emoticon | ImagePackRegistry::Sticker);
+    QCOMPARE(ImagePackRegistry::usages(QStringList()), ImagePackRegistry::Usages());
+    QCOMPARE(ImagePackRegistry::usages(QStringList{u"sticker"_s}), ImagePackRegistry::Usages(ImagePackRegistry::Sticker));
+    QCOMPARE(ImagePackRegistry::usages(QStringList{u"emoticon"_s, u"sticker"_s}), ImagePackRegistry::Emoticon | ImagePackRegistry::Sticker);
+}
+
+void ImagePackRegistryTest::accountPack()
+{
+    const auto registry = ImagePackRegistry::forConnection(connection);
+    QCOMPARE(ImagePackRegistry::forConnection(connection), registry);
+    QVERIFY(!registry->accountPack());
+
+    QSignalSpy spy(registry, &ImagePackRegistry::accountPackChanged);
+    connection->setAccountData(u"im.ponies.user_emotes"_s,
+                               QJsonObject{
+                                   {u"images"_s, images({u"blobcat"_s, u"blobfox"_s}, {u"emoticon"_s})},
+                                   {u"emoticons"_s, images({u"blobfox"_s, u"legacy"_s})},
+                               });
+    QCOMPARE(spy.size(), 1);
+    QVERIFY(registry->accountPack());
+    const auto &packImages = registry->accountPack()->images;
+    QCOMPARE(packImages.size(), 3);
+    QCOMPARE(packImages[0].shortcode, u"blobcat"_s);
+    // The pack takes precedence over the legacy emoticons.
+    QCOMPARE(packImages[1].shortcode, u"blobfox"_s);
+    QCOMPARE(packImages[1].usage, std::make_optional(QStringList{u"emoticon"_s}));
+    QCOMPARE(packImages[2].shortcode, u"legacy"_s);
+
+    // Other account data doesn't reload the pack.
+    connection->setAccountData(u"org.kde.neochat.test"_s, QJsonObject{});
+    QCOMPARE(spy.size(), 1);
+}
+
+void ImagePackRegistryTest::roomPacks()
+{
+    const auto registry = ImagePackRegistry::forConnection(connection);
+    auto room = new TestUtils::TestRoom(connection, u"#roompacks:kde.org"_s);
+    QVERIFY(registry->roomPacks(room).isEmpty());
+
+    QSignalSpy spy(registry, &ImagePackRegistry::packsChanged);
+    sync(room,
+         u"state"_s,
+         QJsonArray{
+             packEvent(u"stickers"_s, u"Stickers"_s, {u"sticker"_s}, {u"wave"_s}),
+             packEvent(u"emotes"_s, u"Emotes"_s, {}, {u"smile"_s, u"frown"_s}),
+         });
+    QCOMPARE(spy.size(), 1);
+
+    auto packs = registry->roomPacks(room);
+    QCOMPARE(packs.size(), 2);
+    QCOMPARE(packs[0].stateKey, u"emotes"_s);
+    QCOMPARE(packs[0].roomId, room->id());
+    QCOMPARE(packs[0].usages, ImagePackRegistry::Emoticon | ImagePackRegistry::Sticker);
+    QCOMPARE(packs[0].content.images.size(), 2);
+    QCOMPARE(packs[1].stateKey, u"stickers"_s);
+    QCOMPARE(packs[1].usages, ImagePackRegistry::Usages(ImagePackRegistry::Sticker));
+    QCOMPARE(*packs[1].content.pack->displayName, u"Stickers"_s);
+
+    // Unrelated state doesn't parse the packs again.
+    sync(room,
+         u"state"_s,
+         QJsonArray{QJsonObject{
+             {u"type"_s, u"m.room.topic"_s},
+             {u"event_id"_s, u"$topic"_s},
+             {u"sender"_s, u"@bob:kde.org"_s},
+             {u"state_key"_s, QString()},
+             {u"origin_server_ts"_s, 1432735824653},
+             {u"content"_s, QJsonObject{{u"topic"_s, u"Packs"_s}}},
+         }});
+    QCOMPARE(spy.size(), 1);
+
+    sync(room, u"timeline"_s, QJsonArray{packEvent(u"stickers"_s, u"Renamed"_s, {u"sticker"_s}, {u"wave"_s, u"hug"_s})});
+    QCOMPARE(spy.size(), 2);
+    packs = registry->roomPacks(room);
+    QCOMPARE(packs[1].stateKey, u"stickers"_s);
+    QCOMPARE(*packs[1].content.pack->displayName, u"Renamed"_s);
+    QCOMPARE(packs[1].content.images.size(), 2);
+}
+
+void ImagePackRegistryTest::subscribedPacks()
+{
+    const auto registry = ImagePackRegistry::forConnection(connection);
+    auto room = new TestUtils::TestRoom(connection, u"#subscribed:kde.org"_s);
+    sync(room,
+         u"state"_s,
+         QJsonArray{
+             packEvent(u"stickers"_s, u"Stickers"_s, {u"sticker"_s}, {u"wave"_s}),
+             packEvent(u"emotes"_s, u"Emotes"_s, {u"emoticon"_s}, {u"smile"_s}),
+             packEvent(u"empty"_s, u"Empty"_s, {}, {}),
+             packEvent(u"unsubscribed"_s, u"Unsubscribed"_s, {}, {u"hidden"_s}),
+         });
+    // The room isn't known to the mock connection, so it has to be tracked first.
+    registry->roomPacks(room);
+    QVERIFY(registry->subscribedPacks(ImagePackRegistry::Emoticon | ImagePackRegistry::Sticker).isEmpty());
+
+    QSignalSpy spy(registry, &ImagePackRegistry::packsChanged);
+    connection->setAccountData(u"im.ponies.emote_rooms"_s,
+                               QJsonObject{{u"rooms"_s,
+                                            QJsonObject{
+                                                {room->id(), QJsonObject{{u"stickers"_s, QJsonObject{}}, {u"emotes"_s, QJsonObject{}}, {u"empty"_s, QJsonObject{}}}},
+                                                {u"!unknown:kde.org"_s, QJsonObject{{u"stickers"_s, QJsonObject{}}}},
+                                            }}});
+    QCOMPARE(spy.size(), 1);
+
+    const auto stateKeys = [registry](ImagePackRegistry::Usages usages) {
+        QStringList stateKeys;
+        for (const auto &pack : registry->subscribedPacks(usages)) {
+            stateKeys += pack.stateKey;
+        }
+        return stateKeys;
+    };
+    // Ordered by state key, without the empty pack.
+    QCOMPARE(stateKeys(ImagePackRegistry::Emoticon | ImagePackRegistry::Sticker), (QStringList{u"emotes"_s, u"stickers"_s}));
+    QCOMPARE(stateKeys(ImagePackRegistry::Emoticon), QStringList{u"emotes"_s});
+    QCOMPARE(stateKeys(ImagePackRegistry::Sticker), QStringList{u"stickers"_s});
+
+    connection->setAccountData(u"im.ponies.emote_rooms"_s, QJsonObject{});
+    QCOMPARE(spy.size(), 2);
+    QVERIFY(stateKeys(ImagePackRegistry::Emoticon | ImagePackRegistry::Sticker).isEmpty());
+}
+
+void ImagePackRegistryTest::imagePacksModel()
+{
+    auto room = new TestUtils::TestRoom(connection, u"#imagepacksmodel:kde.org"_s);
+    sync(room,
+         u"state"_s,
+         QJsonArray{
+             packEvent(u"stickers"_s, u"Stickers"_s, {u"sticker"_s}, {u"wave"_s}),
+             packEvent(u"emotes"_s, u"Emotes"_s, {u"emoticon"_s}, {u"smile"_s}),
+         });
+
+    ImagePacksModel model;
+    model.setShowEmoticons(false);
+    model.setRoom(room);
+    // The account's own pack and the sticker pack of the room.
+    QCOMPARE(model.rowCount({}), 2);
+    QCOMPARE(model.data(model.index(0), ImagePacksModel::DisplayNameRole).toString(), u"Own Stickers"_s);
+    QCOMPARE(model.data(model.index(1), ImagePacksModel::DisplayNameRole).toString(), u"Stickers"_s);
+
+    model.setShowEmoticons(true);
+    QCOMPARE(model.rowCount({}), 3);
+
+    QSignalSpy spy(&model, &ImagePacksModel::imagesLoaded);
+    sync(room, u"timeline"_s, QJsonArray{packEvent(u"more"_s, u"More"_s, {u"sticker"_s}, {u"hug"_s})});
+    QCOMPARE(spy.size(), 1);
+    QCOMPARE(model.rowCount({}), 4);
+}
+
+void ImagePackRegistryTest::customEmojiSearch()
+{
+    connection->setAccountData(u"im.ponies.user_emotes"_s,
+                               QJsonObject{
+                                   {u"images"_s,
+                                    images({u"blob_cat"_s, u"blob_fox"_s, u"cat"_s, u"party_parrot"_s, u"parrot"_s, u"sleepy"_s}, {u"emoticon"_s})},
+                               });
+    auto &model = CustomEmojiModel::instance();
+    model.setConnection(static_cast<NeoChatConnection *>(connection));
+    QCOMPARE(model.rowCount(), 6);
+
+    const auto names = [&model](const QString &text) {
+        QStringList names;
+        for (const auto &emoji : model.search(text)) {
+            names += emoji.shortName;
+        }
+        return names;
+    };
+    QCOMPARE(names(u":cat"_s), (QStringList{u":cat:"_s, u":blob_cat:"_s}));
+    QCOMPARE(names(u"PARROT"_s), (QStringList{u":parrot:"_s, u":party_parrot:"_s}));
+    QCOMPARE(names(u":blob"_s), (QStringList{u":blob_cat:"_s, u":blob_fox:"_s}));
+    // Only the start of the name or one of its words matches.
+    QVERIFY(names(u"arrot"_s).isEmpty());
+
+    QCOMPARE(model.filterModel(u"blob"_s).size(), 2);
+    QCOMPARE(model.filterModel(QString()).size(), 6);
+
+    // The model follows the account data.
+    connection->setAccountData(u"im.ponies.user_emotes"_s, QJsonObject{{u"images"_s, images({u"new"_s}, {u"emoticon"_s})}});
+    QCOMPARE(model.rowCount(), 1);
+    QCOMPARE(names(u"new"_s), QStringList{u":new:"_s});
+}
+
+QTEST_GUILESS_MAIN(ImagePackRegistryTest)
+#include "imagepackregistrytest.moc"
@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QObject>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include "itineraryextractor.h"
+
+using namespace Qt::StringLiterals;
+
+class ItineraryExtractorTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    QTemporaryDir m_dir;
+    ItineraryExtractor *m_extractor = nullptr;
+
+    QString writeFile(const QString &name, const QByteArray &content);
+    QStringList invocations() const;
+    ItineraryExtractor::Result waitForResult(QFuture<ItineraryExtractor::Result> future);
+
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void extract();
+    void cachedByContent();
+    void cacheSurvivesRestart();
+    void deduplicateInFlight();
+    void boundedQueue();
+    void extractorFailure();
+    void missingFile();
+};
+
+QString ItineraryExtractorTest::writeFile(const QString &name, const QByteArray &content)
+{
+    const auto path = m_dir.filePath(name);
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return {};
+    }
+    file.write(content);
+    return path;
+}
+
+QStringList ItineraryExtractorTest::invocations() const
+{
+    QFile log(m_dir.filePath(u"extractor.log"_s));
+    if (!log.open(QIODevice::ReadOnly)) {
+        return {};
+    }
+    return QString::fromUtf8(log.readAll()).split(u'\n', Qt::SkipEmptyParts);
+}
+
+ItineraryExtractor::Result ItineraryExtractorTest::waitForResult(QFuture<ItineraryExtractor::Result> future)
+{
+    if (!QTest::qWaitFor(
+            [&future]() {
+                return future.isFinished();
+            },
+            10000)) {
+        return std::nullopt;
+    }
+    return future.result();
+}
+
+void ItineraryExtractorTest::init()
+{
+    QVERIFY(m_dir.isValid());
+    qputenv("FAKE_EXTRACTOR_LOG", m_dir.filePath(u"extractor.log"_s).toLocal8Bit());
+    qunsetenv("FAKE_EXTRACTOR_DELAY");
+
+    m_extractor = new ItineraryExtractor(m_dir.filePath(u"cache"_s), this);
+    m_extractor->setExtractorPath(QStringLiteral(FAKE_ITINERARY_EXTRACTOR));
+}
+
+void ItineraryExtractorTest::cleanup()
+{
+    m_extractor->clearCache();
+    delete m_extractor;
+    QFile::remove(m_dir.filePath(u"extractor.log"_s));
+}
+
+void ItineraryExtractorTest::extract()
+{
+    const auto ticket = writeFile(u"ticket.pdf"_s, "TrainReservation");
+    const auto result = waitForResult(m_extractor->extract(ticket));
+    QVERIFY(result);
+    QCOMPARE(result->size(), 1);
+    QCOMPARE(result->at(0)["@type"_L1].toString(), u"TrainReservation"_s);
+
+    const auto other = writeFile(u"other.pdf"_s, "Nothing to see here");
+    const auto otherResult = waitForResult(m_extractor->extract(other));
+    QVERIFY(otherResult);
+    QVERIFY(otherResult->isEmpty());
+
+    QCOMPARE(invocations(), (QStringList{ticket, other}));
+}
+
+void ItineraryExtractorTest::cachedByContent()
+{
+    const auto ticket = writeFile(u"ticket.pdf"_s, "TrainReservation");
+    const auto copy = writeFile(u"copy.pdf"_s, "TrainReservation");
+    const auto empty = writeFile(u"empty.pdf"_s, "No reservations");
+
+    QCOMPARE(waitForResult(m_extractor->extract(ticket))->size(), 1);
+    QCOMPARE(waitForResult(m_extractor->extract(empty))->size(), 0);
+    QCOMPARE(invocations().size(), 2);
+
+    // Empty results are remembered too, and the same content under another name is the same file.
+    QCOMPARE(waitForResult(m_extractor->extract(ticket))->size(), 1);
+    QCOMPARE(waitForResult(m_extractor->extract(copy))->size(), 1);
+    QCOMPARE(waitForResult(m_extractor->extract(empty))->size(), 0);
+    QCOMPARE(invocations().size(), 2);
+
+    // Changed content is extracted again.
+    writeFile(u"ticket.pdf"_s, "Cancelled");
+    QCOMPARE(waitForResult(m_extractor->extract(ticket))->size(), 0);
+    QCOMPARE(invocations().size(), 3);
+}
+
+void ItineraryExtractorTest::cacheSurvivesRestart()
+{
+    const auto ticket = writeFile(u"ticket.pdf"_s, "TrainReservation");
+    QCOMPARE(waitForResult(m_extractor->extract(ticket))->size(), 1);
+    QCOMPARE(invocations().size(), 1);
+
+    ItineraryExtractor restarted(m_dir.filePath(u"cache"_s));
+    restarted.setExtractorPath(QStringLiteral(FAKE_ITINERARY_EXTRACTOR));
+    QCOMPARE(waitForResult(restarted.extract(ticket))->size(), 1);
+    QCOMPARE(invocations().size(), 1);
+}
+
+void ItineraryExtractorTest::deduplicateInFlight()
+{
+    qputenv("FAKE_EXTRACTOR_DELAY", "200");
+    const auto ticket = writeFile(u"ticket.pdf"_s, "TrainReservation");
+
+    QList<QFuture<ItineraryExtractor::Result>> futures;
+    for (int i = 0; i < 5; ++i) {
+        futures += m_extractor->extract(ticket);
+    }
+    for (const auto &future : std::as_const(futures)) {
+        const auto result = waitForResult(future);
+        QVERIFY(result);
+        QCOMPARE(result->size(), 1);
+    }
+    QCOMPARE(invocations().size(), 1);
+}
+
+void ItineraryExtractorTest::boundedQueue()
+{
+    qputenv("FAKE_EXTRACTOR_DELAY", "300");
+    m_extractor->setMaxProcesses(2);
+
+    QList<QFuture<ItineraryExtractor::Result>> futures;
+    for (int i = 0; i < 5; ++i) {
+        futures += m_extractor->extract(writeFile(u"file%1.pdf"_s.arg(i), "File " + QByteArray::number(i)));
+    }
+
+    QTRY_COMPARE(m_extractor->runningCount() + m_extractor->queuedCount(), 5);
+    QCOMPARE(m_extractor->runningCount(), 2);
+    QCOMPARE(m_extractor->queuedCount(), 3);
+
+    for (const auto &future : std::as_const(futures)) {
+        QVERIFY(waitForResult(future));
+        QVERIFY(m_extractor->runningCount() <= 2);
+    }
+    QCOMPARE(m_extractor->runningCount(), 0);
+    QCOMPARE(m_extractor->queuedCount(), 0);
+    QCOMPARE(invocations().size(), 5);
+}
+
+void ItineraryExtractorTest::extractorFailure()
+{
+    const auto ticket = writeFile(u"ticket.pdf"_s, "TrainReservation");
+
+    m_extractor->setExtractorPath(m_dir.filePath(u"does-not-exist"_s));
+    QVERIFY(!waitForResult(m_extractor->extract(ticket)));
+    QCOMPARE(m_extractor->runningCount(), 0);
+
+    // Failures are not cached.
+    m_extractor->setExtractorPath(QStringLiteral(FAKE_ITINERARY_EXTRACTOR));
+    QCOMPARE(waitForResult(m_extractor->extract(ticket))->size(), 1);
+}
+
+void ItineraryExtractorTest::missingFile()
+{
+    QVERIFY(!waitForResult(m_extractor->extract(m_dir.filePath(u"missing.pdf"_s))));
+    QVERIFY(invocations().isEmpty());
+}
+
+QTEST_GUILESS_MAIN(ItineraryExtractorTest)
+#include "itineraryextractortest.moc"
@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QObject>
+#include <QRandomGenerator>
+#include <QTest>
+
+#include <algorithm>
+
+#include "markdownsyntaxtrie.h"
+
+using namespace Qt::StringLiterals;
+
+namespace
+{
+// The linear scans over the syntax table that the trie replaces.
+std::optional<bool> referenceCheck(const QString &currentString, const QString &nextChar, bool lineStart)
+{
+    bool partialMatch = false;
+    bool fullMatch = false;
+    for (const auto &syntax : MarkdownSyntaxTrie::syntax()) {
+        if (syntax.lineStart && !lineStart) {
+            continue;
+        }
+        if (syntax.sequence == currentString) {
+            fullMatch = true;
+        } else if (syntax.sequence.startsWith(QString(currentString + nextChar))) {
+            partialMatch = true;
+        }
+    }
+
+    if (partialMatch) {
+        return false;
+    }
+    if (fullMatch) {
+        return true;
+    }
+    return std::nullopt;
+}
+
+bool referenceEndsSequence(const QString &text)
+{
+    return std::ranges::any_of(MarkdownSyntaxTrie::syntax(), [&text](const MarkdownSyntaxTrie::Syntax &syntax) {
+        return syntax.sequence.endsWith(text);
+    });
+}
+
+bool referenceMatch(const QString &text)
+{
+    return std::ranges::any_of(MarkdownSyntaxTrie::syntax(), [&text](const MarkdownSyntaxTrie::Syntax &syntax) {
+        return syntax.sequence == text;
+    });
+}
+
+// Every character used in a sequence, plus some that aren't.
+const QString alphabet = u" #>*-1.)`~_a é"_s;
+
+QStringList allStrings(int maxLength)
+{
+    QStringList strings{QString()};
+    QStringList previous{QString()};
+    for (int length = 1; length <= maxLength; ++length) {
+        QStringList current;
+        for (const auto &string : std::as_const(previous)) {
+            for (const auto c : alphabet) {
+                current += string + c;
+            }
+        }
+        strings += current;
+        previous = current;
+    }
+    return strings;
+}
+
+// The sequences, their prefixes and suffixes and some random strings up to the longest sequence.
+QStringList interestingStrings()
+{
+    QStringList strings = allStrings(3);
+    for (const auto &syntax : MarkdownSyntaxTrie::syntax()) {
+        const QString sequence = syntax.sequence;
+        for (qsizetype i = 0; i <= sequence.size(); ++i) {
+            strings += sequence.first(i);
+            strings += sequence.sliced(i);
+            strings += sequence.first(i) + u'a';
+        }
+    }
+    QRandomGenerator random(42);
+    for (int i = 0; i < 5000; ++i) {
+        QString string;
+        const auto length = random.bounded(4, 10);
+        for (int j = 0; j < length; ++j) {
+            string += alphabet[random.bounded(int(alphabet.size()))];
+        }
+        strings += string;
+    }
+    return strings;
+}
+}
+
+class MarkdownSyntaxTrieTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void check();
+    void endsSequence();
+    void match();
+    void walk();
+
+    void benchmarkCheck();
+};
+
+void MarkdownSyntaxTrieTest::check()
+{
+    const auto &trie = MarkdownSyntaxTrie::instance();
+    const auto strings = interestingStrings();
+
+    QStringList nextChars{QString()};
+    for (const auto c : alphabet) {
+        nextChars += QString(c);
+    }
+    // Surrogate pairs are selected as one character.
+    nextChars += u"😀"_s;
+
+    for (const auto &string : strings) {
+        const auto state = trie.walk(string);
+        for (const auto &nextChar : std::as_const(nextChars)) {
+            for (const bool lineStart : {false, true}) {
+                if (trie.check(state, nextChar, lineStart) != referenceCheck(string, nextChar, lineStart)) {
+                    QFAIL(qPrintable(u"Mismatch for \"%1\" followed by \"%2\" %3"_s.arg(string, nextChar, lineStart ? u"at line start"_s : u"in line"_s)));
+                }
+            }
+        }
+    }
+}
+
+void MarkdownSyntaxTrieTest::endsSequence()
+{
+    const auto &trie = MarkdownSyntaxTrie::instance();
+    for (const auto &string : interestingStrings()) {
+        if (string.isEmpty()) {
+            continue;
+        }
+        // Read backwards, the way ChatMarkdownHelper does.
+        auto state = MarkdownSyntaxTrie::Root;
+        for (auto i = string.size() - 1; i >= 0; --i) {
+            state = trie.previous(state, string[i]);
+        }
+        QCOMPARE(state != MarkdownSyntaxTrie::Dead, referenceEndsSequence(string));
+    }
+}
+
+void MarkdownSyntaxTrieTest::match()
+{
+    const auto &trie = MarkdownSyntaxTrie::instance();
+    for (const auto &string : interestingStrings()) {
+        const auto syntax = trie.match(trie.walk(string));
+        QCOMPARE(syntax != nullptr, referenceMatch(string));
+        if (syntax) {
+            QCOMPARE(QString(syntax->sequence), string);
+        }
+    }
+    QCOMPARE(trie.match(trie.walk(u"**"_s))->format, RichFormat::Bold);
+    QCOMPARE(trie.match(trie.walk(u"  1) "_s))->format, RichFormat::OrderedList);
+    QVERIFY(!trie.match(MarkdownSyntaxTrie::Dead));
+}
+
+void MarkdownSyntaxTrieTest::walk()
+{
+    const auto &trie = MarkdownSyntaxTrie::instance();
+    QCOMPARE(trie.walk(QString()), MarkdownSyntaxTrie::Root);
+    QCOMPARE(trie.walk(u"#a"_s), MarkdownSyntaxTrie::Dead);
+    QCOMPARE(trie.walk(u"#"_s, trie.walk(u"  #"_s)), trie.walk(u"  ##"_s));
+    QCOMPARE(trie.next(MarkdownSyntaxTrie::Dead, u'#'), MarkdownSyntaxTrie::Dead);
+}
+
+void MarkdownSyntaxTrieTest::benchmarkCheck()
+{
+    const auto &trie = MarkdownSyntaxTrie::instance();
+    const auto state = trie.walk(u"  ##"_s);
+    QBENCHMARK {
+        trie.check(state, u"#", true);
+    }
+}
+
+QTEST_GUILESS_MAIN(MarkdownSyntaxTrieTest)
+#include "markdownsyntaxtrietest.moc"
@@ -0,0 +1,238 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QBuffer>
+#include <QDateTime>
+#include <QDirIterator>
+#include <QImage>
+#include <QObject>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <QCoroTask>
+
+#include <Quotient/connection.h>
+
+#include "accountmanager.h"
+#include "mediathumbnailcache.h"
+#include "neochatconnection.h"
+#include "server.h"
+
+using namespace Quotient;
+using namespace Qt::StringLiterals;
+
+class MediaThumbnailCacheTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    NeoChatConnection *connection = nullptr;
+    Server server;
+
+    static MediaThumbnailCache::Key key(int id, QSize size = {96, 96}, const QString &method = u"crop"_s);
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void keys();
+    void evictLeastRecentlyUsed();
+    void persistsOrder();
+    void shrinkBudget();
+    void thumbnailFromServer();
+    void encryptedAtRest();
+};
+
+MediaThumbnailCache::Key MediaThumbnailCacheTest::key(int id, QSize size, const QString &method)
+{
+    return {.mxc = QUrl(u"mxc://example.org/media%1"_s.arg(id)), .size = size, .method = method};
+}
+
+void MediaThumbnailCacheTest::initTestCase()
+{
+    Connection::setRoomType<NeoChatRoom>();
+    server.start();
+    auto accountManager = new AccountManager(true, this);
+    connection = dynamic_cast<NeoChatConnection *>(accountManager->accounts()->front());
+    QVERIFY(connection);
+}
+
+void MediaThumbnailCacheTest::keys()
+{
+    QTemporaryDir dir;
+    MediaThumbnailCache cache(dir.path());
+
+    cache.insert(key(1), "crop 96"_ba);
+    cache.insert(key(1, {96, 96}, u"scale"_s), "scale 96"_ba);
+    cache.insert(key(1, {320, 240}, u"scale"_s), "scale 320"_ba);
+
+    QCOMPARE(cache.find(key(1)), "crop 96"_ba);
+    QCOMPARE(cache.find(key(1, {96, 96}, u"scale"_s)), "scale 96"_ba);
+    QCOMPARE(cache.find(key(1, {320, 240}, u"scale"_s)), "scale 320"_ba);
+    QVERIFY(!cache.contains(key(2)));
+    QVERIFY(cache.find(key(2)).isEmpty());
+
+    // The query NeoChatRoom::makeMediaUrl adds doesn't make it a different thumbnail.
+    auto withQuery = key(1);
+    withQuery.mxc.setQuery(u"user_id=@user:localhost&room_id=!room:localhost"_s);
+    QCOMPARE(cache.find(withQuery), "crop 96"_ba);
+
+    QCOMPARE(cache.size(), 7 + 8 + 9);
+    cache.remove(key(1));
+    QVERIFY(!cache.contains(key(1)));
+    QCOMPARE(cache.size(), 8 + 9);
+    cache.clear();
+    QCOMPARE(cache.size(), 0);
+    QVERIFY(QDir(dir.path()).isEmpty());
+}
+
+void MediaThumbnailCacheTest::evictLeastRecentlyUsed()
+{
+    QTemporaryDir dir;
+    MediaThumbnailCache cache(dir.path());
+    cache.setMaxSize(30);
+
+    cache.insert(key(1), QByteArray(10, 'a'));
+    cache.insert(key(2), QByteArray(10, 'b'));
+    cache.insert(key(3), QByteArray(10, 'c'));
+    QCOMPARE(cache.size(), 30);
+
+    // Using the first entry makes the second one the least recently used.
+    QVERIFY(!cache.find(key(1)).isEmpty());
+    cache.insert(key(4), QByteArray(10, 'd'));
+
+    QCOMPARE(cache.size(), 30);
+    QVERIFY(cache.contains(key(1)));
+    QVERIFY(!cache.contains(key(2)));
+    QVERIFY(cache.contains(key(3)));
+    QVERIFY(cache.contains(key(4)));
+    QCOMPARE(QDir(dir.path()).entryList(QDir::Files).size(), 3);
+
+    // Entries that don't fit at all aren't stored.
+    cache.insert(key(5), QByteArray(31, 'e'));
+    QVERIFY(!cache.contains(key(5)));
+    QVERIFY(cache.contains(key(1)));
+}
+
+void MediaThumbnailCacheTest::persistsOrder()
+{
+    QTemporaryDir dir;
+    {
+        MediaThumbnailCache cache(dir.path());
+        cache.insert(key(1), QByteArray(10, 'a'));
+        cache.insert(key(2), QByteArray(10, 'b'));
+        cache.insert(key(3), QByteArray(10, 'c'));
+
+        // Spread the modification times out, the entries were written within the file system's resolution.
+        const auto now = QDateTime::currentDateTimeUtc();
+        QDirIterator it(dir.path(), QDir::Files);
+        while (it.hasNext()) {
+            QFile file(it.next());
+            QVERIFY(file.open(QIODevice::ReadWrite));
+            const auto age = 'd' - file.read(1).at(0);
+            QVERIFY(file.setFileTime(now.addSecs(-3600 * age), QFileDevice::FileModificationTime));
+        }
+
+        QVERIFY(!cache.find(key(1)).isEmpty());
+    }
+
+    MediaThumbnailCache cache(dir.path());
+    QCOMPARE(cache.size(), 30);
+    QCOMPARE(cache.find(key(3)), QByteArray(10, 'c'));
+
+    cache.setMaxSize(20);
+    QVERIFY(!cache.contains(key(2)));
+    QVERIFY(cache.contains(key(1)));
+    QVERIFY(cache.contains(key(3)));
+}
+
+void MediaThumbnailCacheTest::shrinkBudget()
+{
+    QTemporaryDir dir;
+    MediaThumbnailCache cache(dir.path());
+    for (int i = 0; i < 10; i++) {
+        cache.insert(key(i), QByteArray(100, 'x'));
+    }
+    cache.setMaxSize(250);
+    QCOMPARE(cache.size(), 200);
+    QVERIFY(cache.contains(key(8)));
+    QVERIFY(cache.contains(key(9)));
+    QVERIFY(!cache.contains(key(7)));
+}
+
+void MediaThumbnailCacheTest::thumbnailFromServer()
+{
+    QImage image(400, 200, QImage::Format_RGB32);
+    image.fill(Qt::red);
+    QByteArray png;
+    QBuffer buffer(&png);
+    buffer.open(QIODevice::WriteOnly);
+    image.save(&buffer, "PNG");
+    auto mxc = server.uploadMedia(png);
+    mxc.setQuery(u"user_id=@user:localhost:1234"_s);
+
+    QTemporaryDir dir;
+    const MediaThumbnailCache::Key thumbnailKey{.mxc = mxc, .size = {96, 96}, .method = u"crop"_s};
+    const auto requests = server.mediaRequestCount();
+    {
+        MediaThumbnailCache cache(dir.path());
+        const auto data = QCoro::waitFor(cache.thumbnail(connection, thumbnailKey));
+        QCOMPARE(QImage::fromData(data).size(), QSize(96, 96));
+        QCOMPARE(server.mediaRequestCount(), requests + 1);
+
+        QCOMPARE(QCoro::waitFor(cache.thumbnail(connection, thumbnailKey)), data);
+        QCOMPARE(server.mediaRequestCount(), requests + 1);
+
+        const auto scaled = QCoro::waitFor(cache.thumbnail(connection, {.mxc = mxc, .size = {320, 240}, .method = u"scale"_s}));
+        QCOMPARE(QImage::fromData(scaled).size(), QSize(320, 160));
+        QCOMPARE(server.mediaRequestCount(), requests + 2);
+    }
+
+    // Requests for a thumbnail that is already on its way share it.
+    {
+        MediaThumbnailCache cache(dir.path());
+        const MediaThumbnailCache::Key concurrentKey{.mxc = mxc, .size = {64, 64}, .method = u"crop"_s};
+        auto first = cache.thumbnail(connection, concurrentKey);
+        auto second = cache.thumbnail(connection, concurrentKey);
+        const auto data = QCoro::waitFor(std::move(first));
+        QCOMPARE(QImage::fromData(data).size(), QSize(64, 64));
+        QCOMPARE(QCoro::waitFor(std::move(second)), data);
+        QCOMPARE(server.mediaRequestCount(), requests + 3);
+    }
+
+    // A restart reads it from the disk.
+    MediaThumbnailCache cache(dir.path());
+    QCOMPARE(QImage::fromData(QCoro::waitFor(cache.thumbnail(connection, thumbnailKey))).size(), QSize(96, 96));
+    QCOMPARE(server.mediaRequestCount(), requests + 3);
+
+    // Failed requests are not cached.
+    const MediaThumbnailCache::Key missing{.mxc = QUrl(u"mxc://localhost:1234/missing"_s), .size = {96, 96}, .method = u"crop"_s};
+    QVERIFY(QCoro::waitFor(cache.thumbnail(connection, missing)).isEmpty());
+    QVERIFY(!cache.contains(missing));
+}
+
+void MediaThumbnailCacheTest::encryptedAtRest()
+{
+    const auto plainText = "A thumbnail nobody else should see"_ba;
+    auto [metadata, cipherText] = encryptFile(plainText);
+    const auto mxc = server.uploadMedia(cipherText);
+    metadata.url = mxc;
+
+    QTemporaryDir dir;
+    MediaThumbnailCache cache(dir.path());
+    const MediaThumbnailCache::Key thumbnailKey{.mxc = mxc, .size = {96, 96}, .method = u"crop"_s};
+    QCOMPARE(QCoro::waitFor(cache.thumbnail(connection, thumbnailKey, metadata)), plainText);
+    QCOMPARE(QCoro::waitFor(cache.thumbnail(connection, thumbnailKey, metadata)), plainText);
+
+    // Only the ciphertext is on the disk.
+    QDirIterator it(dir.path(), QDir::Files);
+    QVERIFY(it.hasNext());
+    QFile file(it.next());
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const auto stored = file.readAll();
+    QCOMPARE(stored, cipherText);
+    QVERIFY(!stored.contains(plainText));
+}
+
+QTEST_GUILESS_MAIN(MediaThumbnailCacheTest)
+#include "mediathumbnailcachetest.moc"
@@ -0,0 +1,281 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QJsonArray>
+#include <QObject>
+#include <QTest>
+
+#include <Quotient/connection.h>
+#include <Quotient/syncdata.h>
+
+#include "membersearchindex.h"
+#include "models/userfiltermodel.h"
+#include "models/userlistmodel.h"
+#include "testutils.h"
+
+using namespace Quotient;
+using namespace Qt::StringLiterals;
+
+class MemberSearchIndexTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    Connection *connection = nullptr;
+    int m_eventCount = 0;
+
+    QJsonObject memberEvent(const QString &userId, const QString &displayName, const QString &membership = u"join"_s);
+    QJsonObject messageEvent(const QString &userId, qint64 timestamp);
+    static void sync(TestUtils::TestRoom *room, const QString &section, const QJsonArray &events);
+    static MemberSearchIndex makeIndex(int memberCount);
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void prefixes();
+    void normalization();
+    void ranking();
+    void limit();
+    void updates();
+    void roomIndex();
+    void userFilterModel();
+
+    void benchmarkBuild();
+    void benchmarkSearch_data();
+    void benchmarkSearch();
+};
+
+QJsonObject MemberSearchIndexTest::memberEvent(const QString &userId, const QString &displayName, const QString &membership)
+{
+    return QJsonObject{
+        {u"type"_s, u"m.room.member"_s},
+        {u"event_id"_s, u"$member%1"_s.arg(++m_eventCount)},
+        {u"sender"_s, userId},
+        {u"state_key"_s, userId},
+        {u"origin_server_ts"_s, 1432735824653 + m_eventCount},
+        {u"content"_s,
+         QJsonObject{
+             {u"membership"_s, membership},
+             {u"displayname"_s, displayName},
+         }},
+    };
+}
+
+QJsonObject MemberSearchIndexTest::messageEvent(const QString &userId, qint64 timestamp)
+{
+    return QJsonObject{
+        {u"type"_s, u"m.room.message"_s},
+        {u"event_id"_s, u"$message%1"_s.arg(++m_eventCount)},
+        {u"sender"_s, userId},
+        {u"origin_server_ts"_s, timestamp},
+        {u"content"_s,
+         QJsonObject{
+             {u"msgtype"_s, u"m.text"_s},
+             {u"body"_s, u"Hello"_s},
+         }},
+    };
+}
+
+void MemberSearchIndexTest::sync(TestUtils::TestRoom *room, const QString &section, const QJsonArray &events)
+{
+    room->update(SyncRoomData(room->id(), JoinState::Join, QJsonObject{{section, QJsonObject{{u"events"_s, events}}}}));
+}
+
+MemberSearchIndex MemberSearchIndexTest::makeIndex(int memberCount)
+{
+    static const QStringList firstNames{u"Alice"_s, u"Bob"_s, u"Carol"_s, u"Dave"_s, u"Eve"_s, u"Frank"_s, u"Grace"_s, u"Heidi"_s};
+    static const QStringList lastNames{u"Smith"_s, u"Jones"_s, u"Müller"_s, u"García"_s, u"Nguyen"_s, u"Kowalski"_s};
+
+    MemberSearchIndex index;
+    for (int i = 0; i < memberCount; ++i) {
+        const auto name = u"%1 %2 %3"_s.arg(firstNames[i % firstNames.size()], lastNames[(i / firstNames.size()) % lastNames.size()]).arg(i);
+        const auto userId = u"@user%1:server%2.org"_s.arg(i).arg(i % 20);
+        index.insert(userId, name);
+        index.setLastActive(userId, i % 97);
+    }
+    return index;
+}
+
+void MemberSearchIndexTest::initTestCase()
+{
+    connection = Connection::makeMockConnection(u"@bob:kde.org"_s);
+}
+
+void MemberSearchIndexTest::prefixes()
+{
+    MemberSearchIndex index;
+    index.insert(u"@alice.smith:example.org"_s, u"Alice Smith"_s);
+    index.insert(u"@bob:kde.org"_s, u"Bob"_s);
+
+    QCOMPARE(index.size(), 2);
+    QCOMPARE(index.search(u"ali"), QStringList{u"@alice.smith:example.org"_s});
+    QCOMPARE(index.search(u"smi"), QStringList{u"@alice.smith:example.org"_s});
+    QCOMPARE(index.search(u"alice sm"), QStringList{u"@alice.smith:example.org"_s});
+    QCOMPARE(index.search(u"@alice.smith:ex"), QStringList{u"@alice.smith:example.org"_s});
+    QCOMPARE(index.search(u"bob:kde"), QStringList{u"@bob:kde.org"_s});
+    // Only the start of words match.
+    QVERIFY(index.search(u"lice").isEmpty());
+    // The server name isn't split into words.
+    QVERIFY(index.search(u"org").isEmpty());
+    QCOMPARE(index.search(u"").size(), 2);
+}
+
+void MemberSearchIndexTest::normalization()
+{
+    MemberSearchIndex index;
+    index.insert(u"@zoe:example.org"_s, u"Zoë Ångström"_s);
+
+    QCOMPARE(index.search(u"ZOE"), QStringList{u"@zoe:example.org"_s});
+    QCOMPARE(index.search(u"angst"), QStringList{u"@zoe:example.org"_s});
+    QCOMPARE(index.search(u"Ångs"), QStringList{u"@zoe:example.org"_s});
+    QCOMPARE(MemberSearchIndex::normalize(u"Zoë"), u"zoe"_s);
+}
+
+void MemberSearchIndexTest::ranking()
+{
+    MemberSearchIndex index;
+    index.insert(u"@ann:example.org"_s, u"Ann"_s);
+    index.insert(u"@annabel:example.org"_s, u"Annabel"_s);
+    index.insert(u"@annika:example.org"_s, u"Annika"_s);
+    index.insert(u"@mary:example.org"_s, u"Mary Ann"_s);
+
+    // Without activity, by match and then name.
+    QCOMPARE(index.search(u"ann"),
+             (QStringList{u"@ann:example.org"_s, u"@annabel:example.org"_s, u"@annika:example.org"_s, u"@mary:example.org"_s}));
+
+    // The most recently active first among equally good matches, but never ahead of a better match.
+    index.setLastActive(u"@mary:example.org"_s, 3000);
+    index.setLastActive(u"@annika:example.org"_s, 2000);
+    index.setLastActive(u"@annabel:example.org"_s, 1000);
+    index.setLastActive(u"@annika:example.org"_s, 500);
+    QCOMPARE(index.search(u"ann"),
+             (QStringList{u"@ann:example.org"_s, u"@annika:example.org"_s, u"@annabel:example.org"_s, u"@mary:example.org"_s}));
+}
+
+void MemberSearchIndexTest::limit()
+{
+    const auto index = makeIndex(1000);
+    const auto all = index.search(u"alice");
+    QCOMPARE(all.size(), 125);
+    QCOMPARE(index.search(u"alice", 10), all.first(10));
+    QCOMPARE(index.search(u"alice", 0), QStringList());
+}
+
+void MemberSearchIndexTest::updates()
+{
+    MemberSearchIndex index;
+    index.insert(u"@alice:example.org"_s, u"Alice"_s);
+    auto revision = index.revision();
+
+    index.insert(u"@alice:example.org"_s, u"Zoe"_s);
+    QVERIFY(index.revision() != revision);
+    QCOMPARE(index.size(), 1);
+    QVERIFY(index.search(u"Ali").isEmpty());
+    QCOMPARE(index.search(u"zo"), QStringList{u"@alice:example.org"_s});
+    // The user id still matches.
+    QCOMPARE(index.search(u"@ali"), QStringList{u"@alice:example.org"_s});
+
+    revision = index.revision();
+    index.setLastActive(u"@alice:example.org"_s, 1000);
+    QCOMPARE(index.revision(), revision);
+
+    index.remove(u"@alice:example.org"_s);
+    QVERIFY(index.revision() != revision);
+    QVERIFY(!index.contains(u"@alice:example.org"_s));
+    QVERIFY(index.search(u"zo").isEmpty());
+    QCOMPARE(index.size(), 0);
+}
+
+void MemberSearchIndexTest::roomIndex()
+{
+    auto room = new TestUtils::TestRoom(connection, u"#roomindex:kde.org"_s);
+    sync(room,
+         u"state"_s,
+         QJsonArray{
+             memberEvent(u"@alice:example.org"_s, u"Alice"_s),
+             memberEvent(u"@alicia:example.org"_s, u"Alicia"_s),
+         });
+    sync(room, u"timeline"_s, QJsonArray{messageEvent(u"@alice:example.org"_s, 1432735900000)});
+
+    const auto &index = room->memberSearchIndex();
+    QCOMPARE(index.search(u"ali"), (QStringList{u"@alice:example.org"_s, u"@alicia:example.org"_s}));
+
+    sync(room, u"timeline"_s, QJsonArray{messageEvent(u"@alicia:example.org"_s, 1432735950000)});
+    QCOMPARE(index.search(u"ali"), (QStringList{u"@alicia:example.org"_s, u"@alice:example.org"_s}));
+
+    sync(room,
+         u"timeline"_s,
+         QJsonArray{
+             memberEvent(u"@alison:example.org"_s, u"Alison"_s),
+             memberEvent(u"@alice:example.org"_s, u"Alice"_s, u"leave"_s),
+             memberEvent(u"@alicia:example.org"_s, u"Zoe"_s),
+         });
+    // Alicia still matches through her user id and was active more recently.
+    QCOMPARE(index.search(u"ali"), (QStringList{u"@alicia:example.org"_s, u"@alison:example.org"_s}));
+    QCOMPARE(index.search(u"zoe"), QStringList{u"@alicia:example.org"_s});
+}
+
+void MemberSearchIndexTest::userFilterModel()
+{
+    auto room = new TestUtils::TestRoom(connection, u"#filtermodel:kde.org"_s);
+    sync(room,
+         u"state"_s,
+         QJsonArray{
+             memberEvent(u"@alice:example.org"_s, u"Alice"_s),
+             memberEvent(u"@bob:example.org"_s, u"Bob"_s),
+             memberEvent(u"@carol:example.org"_s, u"Carol Alison"_s),
+         });
+
+    UserListModel userListModel;
+    userListModel.setRoom(room);
+    userListModel.activate();
+
+    UserFilterModel filterModel;
+    filterModel.setSourceModel(&userListModel);
+    filterModel.setFilterText(u"ali"_s);
+    QCOMPARE(filterModel.rowCount(), 2);
+
+    // A member joining while filtering shows up if they match.
+    sync(room, u"timeline"_s, QJsonArray{memberEvent(u"@dave:example.org"_s, u"Dave"_s), memberEvent(u"@alina:example.org"_s, u"Alina"_s)});
+    QTRY_COMPARE(userListModel.rowCount(), 5);
+    QCOMPARE(filterModel.rowCount(), 3);
+
+    filterModel.setFilterText(QString());
+    QCOMPARE(filterModel.rowCount(), 0);
+    filterModel.setAllowEmpty(true);
+    QCOMPARE(filterModel.rowCount(), 5);
+}
+
+void MemberSearchIndexTest::benchmarkBuild()
+{
+    QBENCHMARK {
+        const auto index = makeIndex(50000);
+        QCOMPARE(index.size(), 50000);
+    }
+}
+
+void MemberSearchIndexTest::benchmarkSearch_data()
+{
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<qsizetype>("limit");
+
+    QTest::newRow("one letter") << u"a"_s << qsizetype(50);
+    QTest::newRow("first name") << u"grace"_s << qsizetype(50);
+    QTest::newRow("first name, all results") << u"grace"_s << qsizetype(-1);
+    QTest::newRow("user id") << u"@user4242"_s << qsizetype(50);
+    QTest::newRow("no match") << u"xyz"_s << qsizetype(50);
+}
+
+void MemberSearchIndexTest::benchmarkSearch()
+{
+    QFETCH(QString, text);
+    QFETCH(qsizetype, limit);
+
+    static const auto index = makeIndex(50000);
+    QBENCHMARK {
+        index.search(text, limit);
+    }
+}
+
+QTEST_MAIN(MemberSearchIndexTest)
+#include "membersearchindextest.moc"
@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QObject>
+#include <QSignalSpy>
+#include <QTest>
+
+#include <KLocalizedString>
+
+#include <Quotient/connection.h>
+
+#include "accountmanager.h"
+#include "models/notificationsmodel.h"
+#include "neochatroom.h"
+#include "server.h"
+
+using namespace Quotient;
+
+class NotificationsModelTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    NeoChatConnection *connection = nullptr;
+    Server server;
+    QString roomId;
+
+    QString sendHighlight(const QString &body, bool highlight = true);
+
+private Q_SLOTS:
+    void initTestCase();
+    void initialLoadAndPaging();
+    void incrementalLoad();
+    void readState();
+    void incrementalLoadAcrossPages();
+
+private:
+    NotificationsModel model;
+};
+
+QString NotificationsModelTest::sendHighlight(const QString &body, bool highlight)
+{
+    const auto eventId = server.sendEvent(roomId,
+                                          u"m.room.message"_s,
+                                          QJsonObject{
+                                              {u"body"_s, body},
+                                              {u"msgtype"_s, u"m.text"_s},
+                                          });
+    server.addNotification(roomId, eventId, highlight);
+    return eventId;
+}
+
+void NotificationsModelTest::initTestCase()
+{
+    Connection::setRoomType<NeoChatRoom>();
+    server.start();
+    KLocalizedString::setApplicationDomain(QByteArrayLiteral("neochat"));
+    auto accountManager = new AccountManager(true);
+    QSignalSpy spy(accountManager, &AccountManager::connectionAdded);
+    connection = dynamic_cast<NeoChatConnection *>(accountManager->accounts()->front());
+    QVERIFY(connection);
+    roomId = server.createRoom(u"@user:localhost:1234"_s);
+
+    QSignalSpy syncSpy(connection, &Connection::syncDone);
+    // We need to wait for two syncs, as the next one won't have the changes yet
+    QVERIFY(syncSpy.wait());
+    QVERIFY(syncSpy.wait());
+    QVERIFY(connection->room(roomId));
+}
+
+void NotificationsModelTest::initialLoadAndPaging()
+{
+    for (auto i = 0; i < 7; i++) {
+        sendHighlight(u"Message %1"_s.arg(i));
+    }
+
+    model.setConnection(connection);
+    // The fake server returns five notifications per page.
+    QTRY_COMPARE(model.rowCount({}), 5);
+    QVERIFY(model.canFetchMore({}));
+    QVERIFY(model.data(model.index(0), NotificationsModel::TextRole).toString().endsWith(u"Message 6"_s));
+
+    model.fetchMore({});
+    QTRY_COMPARE(model.rowCount({}), 7);
+    QVERIFY(!model.canFetchMore({}));
+    QVERIFY(model.data(model.index(6), NotificationsModel::TextRole).toString().endsWith(u"Message 0"_s));
+}
+
+void NotificationsModelTest::incrementalLoad()
+{
+    QSignalSpy resetSpy(&model, &QAbstractItemModel::modelReset);
+    QSignalSpy insertSpy(&model, &QAbstractItemModel::rowsInserted);
+
+    sendHighlight(u"Message 7"_s);
+    sendHighlight(u"Not a highlight"_s, false);
+    const auto newestId = sendHighlight(u"Message 8"_s);
+
+    QTRY_COMPARE(model.rowCount({}), 9);
+    QCOMPARE(resetSpy.count(), 0);
+    QCOMPARE(insertSpy.count(), 1);
+    QCOMPARE(insertSpy[0][1].toInt(), 0);
+    QCOMPARE(insertSpy[0][2].toInt(), 1);
+    QCOMPARE(model.data(model.index(0), NotificationsModel::EventIdRole).toString(), newestId);
+
+    // Further syncs without new notifications must not touch the model.
+    QSignalSpy syncSpy(connection, &Connection::syncDone);
+    QVERIFY(syncSpy.wait());
+    QVERIFY(syncSpy.wait());
+    QCOMPARE(model.rowCount({}), 9);
+    QCOMPARE(resetSpy.count(), 0);
+    QCOMPARE(insertSpy.count(), 1);
+}
+
+void NotificationsModelTest::readState()
+{
+    QSignalSpy resetSpy(&model, &QAbstractItemModel::modelReset);
+    QSignalSpy dataChangedSpy(&model, &QAbstractItemModel::dataChanged);
+    QVERIFY(!model.data(model.index(0), NotificationsModel::ReadRole).toBool());
+
+    server.markNotificationsRead(roomId);
+    QTRY_VERIFY(model.data(model.index(0), NotificationsModel::ReadRole).toBool());
+    QVERIFY(dataChangedSpy.count() > 0);
+    QCOMPARE(dataChangedSpy[0][2].value<QList<int>>(), QList<int>{NotificationsModel::ReadRole});
+    QCOMPARE(resetSpy.count(), 0);
+    QCOMPARE(model.rowCount({}), 9);
+}
+
+void NotificationsModelTest::incrementalLoadAcrossPages()
+{
+    QSignalSpy resetSpy(&model, &QAbstractItemModel::modelReset);
+    QSignalSpy insertSpy(&model, &QAbstractItemModel::rowsInserted);
+    const auto previousNewestId = model.data(model.index(0), NotificationsModel::EventIdRole).toString();
+
+    // More than the five notifications on a page of the fake server.
+    QString newestId;
+    for (auto i = 9; i < 16; i++) {
+        newestId = sendHighlight(u"Message %1"_s.arg(i));
+    }
+
+    QTRY_COMPARE(model.rowCount({}), 16);
+    // The second page reaches the known notifications, so nothing is dropped or reset.
+    QCOMPARE(resetSpy.count(), 0);
+    QCOMPARE(insertSpy.count(), 1);
+    QCOMPARE(insertSpy[0][1].toInt(), 0);
+    QCOMPARE(insertSpy[0][2].toInt(), 6);
+    QCOMPARE(model.data(model.index(0), NotificationsModel::EventIdRole).toString(), newestId);
+    QCOMPARE(model.data(model.index(7), NotificationsModel::EventIdRole).toString(), previousNewestId);
+    QVERIFY(model.data(model.index(7), NotificationsModel::ReadRole).toBool());
+    QVERIFY(!model.data(model.index(0), NotificationsModel::ReadRole).toBool());
+}
+
+QTEST_GUILESS_MAIN(NotificationsModelTest)
+#include "notificationsmodeltest.moc"
@@ -0,0 +1,211 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QJsonArray>
+#include <QObject>
+#include <QSignalSpy>
+#include <QTest>
+
+#include <Quotient/connection.h>
+#include <Quotient/events/roompowerlevelsevent.h>
+#include <Quotient/syncdata.h>
+
+#include <limits>
+
+#include "powerleveltable.h"
+#include "testutils.h"
+
+using namespace Quotient;
+using namespace Qt::StringLiterals;
+
+class PowerLevelTableTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    Connection *connection = nullptr;
+
+    static QJsonObject powerLevelsJson(const QString &eventId, const QJsonObject &content);
+    static event_ptr_tt<RoomPowerLevelsEvent> powerLevelsEvent(const QJsonObject &content);
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void defaults();
+    void explicitDefaults();
+    void eventOverrides();
+    void actionLevels();
+    void creators();
+    void invalid();
+
+    void roomTable();
+};
+
+QJsonObject PowerLevelTableTest::powerLevelsJson(const QString &eventId, const QJsonObject &content)
+{
+    return QJsonObject{
+        {u"type"_s, u"m.room.power_levels"_s},
+        {u"event_id"_s, eventId},
+        {u"sender"_s, u"@admin:example.org"_s},
+        {u"state_key"_s, QString()},
+        {u"origin_server_ts"_s, 1432735824653},
+        {u"content"_s, content},
+    };
+}
+
+event_ptr_tt<RoomPowerLevelsEvent> PowerLevelTableTest::powerLevelsEvent(const QJsonObject &content)
+{
+    return loadEvent<RoomPowerLevelsEvent>(powerLevelsJson(u"$powerlevels"_s, content));
+}
+
+void PowerLevelTableTest::initTestCase()
+{
+    connection = Connection::makeMockConnection(u"@bob:kde.org"_s);
+}
+
+void PowerLevelTableTest::defaults()
+{
+    const auto event = powerLevelsEvent({});
+    const PowerLevelTable table(event.get(), {}, 1);
+
+    QVERIFY(table.isValid());
+    QCOMPARE(table.version(), quint64(1));
+    QCOMPARE(table.usersDefault(), 0);
+    QCOMPARE(table.eventsDefault(), 0);
+    QCOMPARE(table.stateDefault(), 50);
+    QCOMPARE(table.userLevel(u"@alice:example.org"_s), 0);
+    QCOMPARE(table.eventLevel(u"m.room.message"_s), 0);
+    QCOMPARE(table.stateLevel(u"m.room.name"_s), 50);
+    QVERIFY(table.canSendEvent(u"@alice:example.org"_s, u"m.room.message"_s));
+    QVERIFY(!table.canSendState(u"@alice:example.org"_s, u"m.room.name"_s));
+}
+
+void PowerLevelTableTest::explicitDefaults()
+{
+    const auto event = powerLevelsEvent(QJsonObject{
+        {u"users_default"_s, 10},
+        {u"events_default"_s, 20},
+        {u"state_default"_s, 30},
+        {u"users"_s, QJsonObject{{u"@alice:example.org"_s, 25}}},
+    });
+    const PowerLevelTable table(event.get(), {}, 1);
+
+    QCOMPARE(table.usersDefault(), 10);
+    QCOMPARE(table.eventsDefault(), 20);
+    QCOMPARE(table.stateDefault(), 30);
+    QCOMPARE(table.userLevel(u"@alice:example.org"_s), 25);
+    QCOMPARE(table.userLevel(u"@carol:example.org"_s), 10);
+    QVERIFY(table.canSendEvent(u"@alice:example.org"_s, u"m.room.message"_s));
+    QVERIFY(!table.canSendState(u"@alice:example.org"_s, u"m.room.name"_s));
+    QVERIFY(!table.canSendEvent(u"@carol:example.org"_s, u"m.room.message"_s));
+}
+
+void PowerLevelTableTest::eventOverrides()
+{
+    const auto event = powerLevelsEvent(QJsonObject{
+        {u"events"_s,
+         QJsonObject{
+             {u"m.reaction"_s, 5},
+             {u"m.room.topic"_s, 0},
+         }},
+        {u"users"_s, QJsonObject{{u"@alice:example.org"_s, 1}}},
+    });
+    const PowerLevelTable table(event.get(), {}, 1);
+
+    QCOMPARE(table.eventLevel(u"m.reaction"_s), 5);
+    QCOMPARE(table.stateLevel(u"m.room.topic"_s), 0);
+    QCOMPARE(table.stateLevel(u"m.room.name"_s), 50);
+    QVERIFY(!table.canSendEvent(u"@alice:example.org"_s, u"m.reaction"_s));
+    QVERIFY(table.canSendState(u"@alice:example.org"_s, u"m.room.topic"_s));
+
+    auto eventTypes = table.eventTypes();
+    eventTypes.sort();
+    QCOMPARE(eventTypes, (QStringList{u"m.reaction"_s, u"m.room.topic"_s}));
+}
+
+void PowerLevelTableTest::actionLevels()
+{
+    const auto event = powerLevelsEvent(QJsonObject{
+        {u"ban"_s, 60},
+        {u"kick"_s, 40},
+        {u"invite"_s, 10},
+        {u"redact"_s, 30},
+        {u"users"_s, QJsonObject{{u"@alice:example.org"_s, 40}}},
+    });
+    const PowerLevelTable table(event.get(), {}, 1);
+
+    QCOMPARE(table.actionLevel(PowerLevelTable::Ban), 60);
+    QCOMPARE(table.actionLevel(PowerLevelTable::Kick), 40);
+    QCOMPARE(table.actionLevel(PowerLevelTable::Invite), 10);
+    QCOMPARE(table.actionLevel(PowerLevelTable::Redact), 30);
+    QVERIFY(!table.canPerform(u"@alice:example.org"_s, PowerLevelTable::Ban));
+    QVERIFY(table.canPerform(u"@alice:example.org"_s, PowerLevelTable::Kick));
+    QVERIFY(table.canPerform(u"@alice:example.org"_s, PowerLevelTable::Redact));
+    QVERIFY(!table.canPerform(u"@carol:example.org"_s, PowerLevelTable::Invite));
+}
+
+void PowerLevelTableTest::creators()
+{
+    const auto event = powerLevelsEvent(QJsonObject{
+        {u"state_default"_s, 100},
+        {u"ban"_s, 100},
+        {u"users"_s, QJsonObject{{u"@admin:example.org"_s, 100}}},
+    });
+    const PowerLevelTable table(event.get(), {u"@creator:example.org"_s}, 1);
+
+    QVERIFY(table.isCreator(u"@creator:example.org"_s));
+    QVERIFY(!table.isCreator(u"@admin:example.org"_s));
+    QCOMPARE(table.userLevel(u"@creator:example.org"_s), std::numeric_limits<int>::max());
+    QVERIFY(table.canSendState(u"@creator:example.org"_s, u"m.room.name"_s));
+    QVERIFY(table.canPerform(u"@creator:example.org"_s, PowerLevelTable::Ban));
+}
+
+void PowerLevelTableTest::invalid()
+{
+    const PowerLevelTable table(nullptr, {u"@creator:example.org"_s}, 1);
+
+    QVERIFY(!table.isValid());
+    QVERIFY(table.canSendEvent(u"@creator:example.org"_s, u"m.room.message"_s));
+    QVERIFY(!table.canSendEvent(u"@alice:example.org"_s, u"m.room.message"_s));
+    QVERIFY(!table.canSendState(u"@alice:example.org"_s, u"m.room.name"_s));
+    QVERIFY(!table.canPerform(u"@alice:example.org"_s, PowerLevelTable::Invite));
+
+    QVERIFY(!PowerLevelTable().isValid());
+}
+
+void PowerLevelTableTest::roomTable()
+{
+    auto room = new TestUtils::TestRoom(connection, u"#myroom:kde.org"_s);
+    room->update(SyncRoomData(room->id(),
+                              JoinState::Join,
+                              QJsonObject{{u"state"_s,
+                                           QJsonObject{{u"events"_s,
+                                                        QJsonArray{powerLevelsJson(u"$powerlevels1"_s,
+                                                                                   QJsonObject{
+                                                                                       {u"users"_s, QJsonObject{{u"@bob:kde.org"_s, 50}}},
+                                                                                   })}}}}}));
+
+    const auto version = room->powerLevels().version();
+    QVERIFY(room->powerLevels().isValid());
+    QCOMPARE(room->powerLevels().userLevel(u"@bob:kde.org"_s), 50);
+    QCOMPARE(room->powerLevels().version(), version);
+    QVERIFY(room->canSendState(u"m.room.name"_s));
+
+    QSignalSpy spy(room, &NeoChatRoom::powerLevelsChanged);
+    room->update(SyncRoomData(room->id(),
+                              JoinState::Join,
+                              QJsonObject{{u"timeline"_s,
+                                           QJsonObject{{u"events"_s,
+                                                        QJsonArray{powerLevelsJson(u"$powerlevels2"_s,
+                                                                                   QJsonObject{
+                                                                                       {u"users"_s, QJsonObject{{u"@bob:kde.org"_s, 0}}},
+                                                                                   })}}}}}));
+
+    QCOMPARE(spy.count(), 1);
+    QVERIFY(room->powerLevels().version() > version);
+    QCOMPARE(room->powerLevels().userLevel(u"@bob:kde.org"_s), 0);
+    QVERIFY(!room->canSendState(u"m.room.name"_s));
+}
+
+QTEST_GUILESS_MAIN(PowerLevelTableTest)
+#include "powerleveltabletest.moc"
@@ -0,0 +1,365 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QAbstractItemModelTester>
+#include <QObject>
+#include <QSignalSpy>
+#include <QTest>
+
+#include <KLocalizedString>
+
+#include <Quotient/connection.h>
+
+#include "accountmanager.h"
+#include "enums/neochatroomtype.h"
+#include "enums/roomsortorder.h"
+#include "enums/roomsortparameter.h"
+#include "models/roomlistmodel.h"
+#include "models/roomtreemodel.h"
+#include "models/sortfilterroomtreemodel.h"
+#include "neochatroom.h"
+#include "roomsearchindex.h"
+#include "server.h"
+
+using namespace Quotient;
+
+class CountingSortFilterRoomTreeModel : public SortFilterRoomTreeModel
+{
+public:
+    using SortFilterRoomTreeModel::SortFilterRoomTreeModel;
+
+    mutable int lessThanCalls = 0;
+
+protected:
+    bool lessThan(const QModelIndex &source_left, const QModelIndex &source_right) const override
+    {
+        lessThanCalls++;
+        return SortFilterRoomTreeModel::lessThan(source_left, source_right);
+    }
+};
+
+class RoomTreeModelTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    NeoChatConnection *connection = nullptr;
+    Server server;
+    QStringList roomIds;
+
+    void sendMessages();
+    void sendMessage(const QString &roomId);
+    void setRoomName(const QString &roomId, const QString &name);
+    void setCanonicalAlias(const QString &roomId, const QString &alias);
+    bool waitForSync();
+    static QStringList matchingRoomIds(const RoomTreeModel &model, const SortFilterRoomTreeModel &proxy);
+
+private Q_SLOTS:
+    void initTestCase();
+    void coalescedTreeChanges();
+    void coalescedListChanges();
+    void cachedSortKeys();
+    void moveRoom();
+    void normalize();
+    void filter();
+    void filterAliasChange();
+};
+
+void RoomTreeModelTest::initTestCase()
+{
+    Connection::setRoomType<NeoChatRoom>();
+    server.start();
+    KLocalizedString::setApplicationDomain(QByteArrayLiteral("neochat"));
+    auto accountManager = new AccountManager(true);
+    QSignalSpy spy(accountManager, &AccountManager::connectionAdded);
+    connection = dynamic_cast<NeoChatConnection *>(accountManager->accounts()->front());
+    QVERIFY(connection);
+    for (auto i = 0; i < 5; i++) {
+        roomIds += server.createRoom(u"@user:localhost:1234"_s);
+    }
+
+    QSignalSpy syncSpy(connection, &Connection::syncDone);
+    // We need to wait for two syncs, as the next one won't have the changes yet
+    QVERIFY(syncSpy.wait());
+    QVERIFY(syncSpy.wait());
+    for (const auto &roomId : std::as_const(roomIds)) {
+        QVERIFY(connection->room(roomId));
+    }
+}
+
+void RoomTreeModelTest::sendMessage(const QString &roomId)
+{
+    server.sendEvent(roomId,
+                     u"m.room.message"_s,
+                     QJsonObject{
+                         {u"body"_s, u"Foo"_s},
+                         {u"msgtype"_s, u"m.text"_s},
+                     });
+}
+
+void RoomTreeModelTest::sendMessages()
+{
+    for (const auto &roomId : std::as_const(roomIds)) {
+        sendMessage(roomId);
+    }
+}
+
+void RoomTreeModelTest::setRoomName(const QString &roomId, const QString &name)
+{
+    server.sendStateEvent(roomId, u"m.room.name"_s, {}, QJsonObject{{u"name"_s, name}});
+}
+
+void RoomTreeModelTest::setCanonicalAlias(const QString &roomId, const QString &alias)
+{
+    server.sendStateEvent(roomId, u"m.room.canonical_alias"_s, {}, QJsonObject{{u"alias"_s, alias}});
+}
+
+bool RoomTreeModelTest::waitForSync()
+{
+    QSignalSpy syncSpy(connection, &Connection::syncDone);
+    // We need to wait for two syncs, as the next one won't have the changes yet
+    return syncSpy.wait() && syncSpy.wait();
+}
+
+QStringList RoomTreeModelTest::matchingRoomIds(const RoomTreeModel &model, const SortFilterRoomTreeModel &proxy)
+{
+    QStringList result;
+    // Categories without matching rooms are filtered out as well.
+    const auto category = proxy.mapFromSource(model.index(NeoChatRoomType::Normal, 0));
+    for (auto row = 0; category.isValid() && row < proxy.rowCount(category); row++) {
+        result += proxy.index(row, 0, category).data(RoomTreeModel::RoomIdRole).toString();
+    }
+    result.sort();
+    return result;
+}
+
+void RoomTreeModelTest::coalescedTreeChanges()
+{
+    RoomTreeModel model;
+    model.setConnection(connection);
+    CountingSortFilterRoomTreeModel proxy(&model);
+
+    // Rows notified more than once within the same sync.
+    int duplicates = 0;
+    int emissions = 0;
+    // dataChanged emissions after which the proxy had to compare rows, i.e. incremental re-sorts.
+    int resortPasses = 0;
+    int lastLessThanCalls = 0;
+    QSet<std::pair<int, int>> notifiedRows;
+    connect(connection, &Connection::syncDone, this, [&notifiedRows] {
+        notifiedRows.clear();
+    });
+    // The proxy is connected first, so it has re-sorted by the time this runs.
+    connect(&model, &QAbstractItemModel::dataChanged, this, [&](const QModelIndex &topLeft, const QModelIndex &bottomRight) {
+        emissions++;
+        if (proxy.lessThanCalls > lastLessThanCalls) {
+            resortPasses++;
+            lastLessThanCalls = proxy.lessThanCalls;
+        }
+        for (auto row = topLeft.row(); row <= bottomRight.row(); row++) {
+            const auto key = std::make_pair(topLeft.parent().row(), row);
+            if (notifiedRows.contains(key)) {
+                duplicates++;
+            }
+            notifiedRows.insert(key);
+        }
+    });
+
+    // The cost of sorting every category once, the most a single sync may take.
+    proxy.lessThanCalls = 0;
+    proxy.invalidate();
+    const auto fullSortCalls = proxy.lessThanCalls;
+    QVERIFY(fullSortCalls > 0);
+
+    // The room signals that each emitted dataChanged, and made the proxy re-sort, before the batching.
+    int roomChanges = 0;
+    for (const auto &roomId : std::as_const(roomIds)) {
+        const auto room = dynamic_cast<NeoChatRoom *>(connection->room(roomId));
+        connect(room, &Room::addedMessages, this, [&roomChanges] {
+            roomChanges++;
+        });
+        connect(room, &Room::changed, this, [&roomChanges](Room::Changes changes) {
+            if (changes & (Room::Change::UnreadStats | Room::Change::Highlights)) {
+                roomChanges++;
+            }
+        });
+        connect(room, &NeoChatRoom::pushNotificationStateChanged, this, [&roomChanges] {
+            roomChanges++;
+        });
+        connect(room, &NeoChatRoom::lastActiveTimeChanged, this, [&roomChanges] {
+            roomChanges++;
+        });
+    }
+
+    proxy.lessThanCalls = 0;
+    sendMessages();
+    QSignalSpy syncSpy(connection, &Connection::syncDone);
+    QVERIFY(syncSpy.wait());
+    QVERIFY(syncSpy.wait());
+
+    QVERIFY(emissions > 0);
+    QVERIFY(emissions <= roomIds.size());
+    QCOMPARE(duplicates, 0);
+    // Unbatched, every room change was a re-sort: at least one per room for the new message.
+    QVERIFY(roomChanges >= roomIds.size());
+    // Batched, the rooms sit next to each other in the category, so each of the two syncs re-sorts at most once.
+    QVERIFY(resortPasses > 0);
+    QVERIFY(resortPasses <= 2);
+    QVERIFY(resortPasses < roomChanges);
+    // Each changed row is re-inserted into its sorted category, never more than one full sort per sync.
+    QVERIFY(proxy.lessThanCalls > 0);
+    QVERIFY(proxy.lessThanCalls <= 2 * fullSortCalls);
+
+    disconnect(connection, &Connection::syncDone, this, nullptr);
+    for (const auto &roomId : std::as_const(roomIds)) {
+        connection->room(roomId)->disconnect(this);
+    }
+}
+
+void RoomTreeModelTest::coalescedListChanges()
+{
+    RoomListModel model;
+    model.setConnection(connection);
+
+    QSignalSpy dataChangedSpy(&model, &QAbstractItemModel::dataChanged);
+    sendMessages();
+    QSignalSpy syncSpy(connection, &Connection::syncDone);
+    QVERIFY(syncSpy.wait());
+    QVERIFY(syncSpy.wait());
+
+    QVERIFY(dataChangedSpy.count() > 0);
+    QVERIFY(dataChangedSpy.count() <= roomIds.size());
+    int notifiedRows = 0;
+    for (const auto &emission : std::as_const(dataChangedSpy)) {
+        notifiedRows += emission[1].toModelIndex().row() - emission[0].toModelIndex().row() + 1;
+    }
+    QVERIFY(notifiedRows <= model.rowCount());
+}
+
+void RoomTreeModelTest::cachedSortKeys()
+{
+    RoomSortParameter::setSortOrder(RoomSortOrder::LastMessage);
+    RoomTreeModel model;
+    model.setConnection(connection);
+    SortFilterRoomTreeModel proxy(&model);
+    const auto category = proxy.mapFromSource(model.index(NeoChatRoomType::Normal, 0));
+    QCOMPARE(proxy.rowCount(category), roomIds.size());
+
+    // The cached sort key of a room must be updated when a new message arrives.
+    for (const auto &roomId : {roomIds[2], roomIds[4], roomIds[0]}) {
+        sendMessage(roomId);
+        QSignalSpy syncSpy(connection, &Connection::syncDone);
+        QVERIFY(syncSpy.wait());
+        QVERIFY(syncSpy.wait());
+        QCOMPARE(proxy.index(0, 0, category).data(RoomTreeModel::RoomIdRole).toString(), roomId);
+    }
+    RoomSortParameter::setSortOrder(RoomSortOrder::Activity);
+}
+
+void RoomTreeModelTest::moveRoom()
+{
+    RoomTreeModel model;
+    model.setConnection(connection);
+    QAbstractItemModelTester tester(&model);
+    const auto room = dynamic_cast<NeoChatRoom *>(connection->room(roomIds[1]));
+    QCOMPARE(model.indexForRoom(room).parent().row(), NeoChatRoomType::Normal);
+
+    QSignalSpy movedSpy(&model, &QAbstractItemModel::rowsMoved);
+    QSignalSpy removedSpy(&model, &QAbstractItemModel::rowsRemoved);
+    room->addTag(u"m.favourite"_s);
+    QCOMPARE(movedSpy.count(), 1);
+    QCOMPARE(removedSpy.count(), 0);
+    QCOMPARE(model.indexForRoom(room).parent().row(), NeoChatRoomType::Favorite);
+
+    room->removeTag(u"m.favourite"_s);
+    QCOMPARE(movedSpy.count(), 2);
+    QCOMPARE(removedSpy.count(), 0);
+    QCOMPARE(model.indexForRoom(room).parent().row(), NeoChatRoomType::Normal);
+
+    // The rows of the other rooms in the old category have shifted.
+    for (const auto &roomId : std::as_const(roomIds)) {
+        const auto otherRoom = dynamic_cast<NeoChatRoom *>(connection->room(roomId));
+        QCOMPARE(model.roomForIndex(model.indexForRoom(otherRoom)), otherRoom);
+    }
+}
+
+void RoomTreeModelTest::normalize()
+{
+    QCOMPARE(RoomSearchIndex::normalize(u"Café Ångström"_s), u"cafe angstrom"_s);
+    QCOMPARE(RoomSearchIndex::normalize(u"STRASSE"_s), u"strasse"_s);
+}
+
+void RoomTreeModelTest::filter()
+{
+    RoomTreeModel model;
+    model.setConnection(connection);
+    SortFilterRoomTreeModel proxy(&model);
+    const auto matching = [&model, &proxy](const QString &text) {
+        proxy.setFilterText(text);
+        return matchingRoomIds(model, proxy);
+    };
+    const auto rooms = [this](std::initializer_list<int> indexes) {
+        QStringList result;
+        for (const auto index : indexes) {
+            result += roomIds[index];
+        }
+        result.sort();
+        return result;
+    };
+
+    setRoomName(roomIds[0], u"Café Ångström"_s);
+    setRoomName(roomIds[2], u"Kitchen"_s);
+    setCanonicalAlias(roomIds[2], u"#greenhouse:localhost:1234"_s);
+    setRoomName(roomIds[4], u"Garden party"_s);
+    QVERIFY(waitForSync());
+
+    // Diacritics and case are ignored on both sides.
+    QCOMPARE(matching(u"cafe"_s), rooms({0}));
+    QCOMPARE(matching(u"ANGSTROM"_s), rooms({0}));
+    QCOMPARE(matching(u"ångström"_s), rooms({0}));
+    QCOMPARE(matching(u"kitchen"_s), rooms({2}));
+    // Only the alias of the room matches.
+    QCOMPARE(matching(u"GreenHouse"_s), rooms({2}));
+
+    // Every extension of the filter text narrows down the previous result.
+    QCOMPARE(matching(u"gar"_s), rooms({4}));
+    QCOMPARE(matching(u"garden party"_s), rooms({4}));
+    QCOMPARE(matching(u"garden partyx"_s), QStringList{});
+    // Removing characters again widens it.
+    QCOMPARE(matching(u"garden"_s), rooms({4}));
+    QCOMPARE(matching(u"no such room"_s), QStringList{});
+
+    // Renaming rooms while the filter is active refreshes the result.
+    proxy.setFilterText(u"cafe"_s);
+    setRoomName(roomIds[0], u"Tea house"_s);
+    setRoomName(roomIds[4], u"Cafeteria"_s);
+    QVERIFY(waitForSync());
+    QCOMPARE(matchingRoomIds(model, proxy), rooms({4}));
+    QCOMPARE(matching(u"tea"_s), rooms({0}));
+
+    QCOMPARE(matching({}).size(), roomIds.size());
+}
+
+void RoomTreeModelTest::filterAliasChange()
+{
+    RoomTreeModel model;
+    model.setConnection(connection);
+    SortFilterRoomTreeModel proxy(&model);
+
+    setCanonicalAlias(roomIds[1], u"#aliaslookup:localhost:1234"_s);
+    QVERIFY(waitForSync());
+    proxy.setFilterText(u"AliasLookup"_s);
+    QCOMPARE(matchingRoomIds(model, proxy), QStringList{roomIds[1]});
+
+    // The alias moves to another room while the filter is active.
+    setCanonicalAlias(roomIds[1], u"#renamed:localhost:1234"_s);
+    setCanonicalAlias(roomIds[3], u"#aliaslookup:localhost:1234"_s);
+    QVERIFY(waitForSync());
+    QCOMPARE(matchingRoomIds(model, proxy), QStringList{roomIds[3]});
+
+    proxy.setFilterText(u"renamed"_s);
+    QCOMPARE(matchingRoomIds(model, proxy), QStringList{roomIds[1]});
+}
+
+QTEST_GUILESS_MAIN(RoomTreeModelTest)
+#include "roomtreemodeltest.moc"
@@ -3,8 +3,10 @@
 
 #include "server.h"
 
+#include <QBuffer>
 #include <QFile>
 #include <QHttpServerResponder>
+#include <QImage>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QNetworkReply>
@@ -116,6 +118,19 @@ void Server::start()
                    });
 
     m_server.route(u"/_matrix/client/r0/sync"_s, QHttpServerRequest::Method::Get, this, &Server::sync);
+    m_server.route(u"/_matrix/client/v3/notifications"_s, QHttpServerRequest::Method::Get, this, &Server::notifications);
+    m_server.route(u"/_matrix/client/v1/media/download/<arg>/<arg>"_s,
+                   QHttpServerRequest::Method::Get,
+                   [this](const QString &serverName, const QString &mediaId, QHttpServerResponder &responder) {
+                       const auto it = m_media.constFind(serverName + u'/' + mediaId);
+                       if (it == m_media.constEnd()) {
+                           responder.write(QHttpServerResponder::StatusCode::NotFound);
+                           return;
+                       }
+                       m_mediaRequestCount++;
+                       responder.write(*it, "application/octet-stream");
+                   });
+    m_server.route(u"/_matrix/client/v1/media/thumbnail/<arg>/<arg>"_s, QHttpServerRequest::Method::Get, this, &Server::mediaThumbnail);
 
     QSslConfiguration config;
     QFile key(QStringLiteral(DATA_DIR) + u"/localhost.key"_s);
@@ -222,6 +237,98 @@ QString Server::sendStateEvent(const QString &roomId, const QString &eventType,
     return eventId;
 }
 
+void Server::addNotification(const QString &roomId, const QString &eventId, bool highlight)
+{
+    QJsonObject event;
+    for (const auto &change : m_state) {
+        for (const auto &it : change.events) {
+            if (it.fullJson[u"event_id"_s].toString() == eventId) {
+                event = it.fullJson;
+            }
+        }
+    }
+    QJsonArray actions{u"notify"_s};
+    if (highlight) {
+        actions += QJsonObject{{u"set_tweak"_s, u"highlight"_s}};
+    }
+    m_notifications += QJsonObject{
+        {u"actions"_s, actions},
+        {u"event"_s, event},
+        {u"read"_s, false},
+        {u"room_id"_s, roomId},
+        {u"ts"_s, event[u"origin_server_ts"_s]},
+    };
+}
+
+void Server::markNotificationsRead(const QString &roomId)
+{
+    for (auto &notification : m_notifications) {
+        if (notification[u"room_id"_s].toString() == roomId) {
+            notification[u"read"_s] = true;
+        }
+    }
+}
+
+void Server::notifications(const QHttpServerRequest &request, QHttpServerResponder &responder)
+{
+    // The "from" token is the number of notifications to skip, starting at the newest one.
+    const auto from = request.query().queryItemValue(u"from"_s).toInt();
+    const auto limitItem = request.query().queryItemValue(u"limit"_s);
+    const auto limit = limitItem.isEmpty() ? 5 : limitItem.toInt();
+
+    QJsonArray notifications;
+    for (auto i = m_notifications.size() - 1 - from; i >= 0 && notifications.size() < limit; i--) {
+        notifications += m_notifications[i];
+    }
+
+    QJsonObject data{{u"notifications"_s, notifications}};
+    if (from + notifications.size() < m_notifications.size()) {
+        data[u"next_token"_s] = QString::number(from + notifications.size());
+    }
+    responder.write(QJsonDocument(data), QHttpServerResponder::StatusCode::Ok);
+}
+
+QUrl Server::uploadMedia(const QByteArray &data)
+{
+    const auto mediaId = QUuid::createUuid().toString(QUuid::Id128);
+    m_media[u"localhost:1234/"_s + mediaId] = data;
+    return QUrl(u"mxc://localhost:1234/"_s + mediaId);
+}
+
+int Server::mediaRequestCount() const
+{
+    return m_mediaRequestCount;
+}
+
+void Server::mediaThumbnail(const QString &serverName, const QString &mediaId, QHttpServerResponder &responder, const QHttpServerRequest &request)
+{
+    const auto it = m_media.constFind(serverName + u'/' + mediaId);
+    if (it == m_media.constEnd()) {
+        responder.write(QHttpServerResponder::StatusCode::NotFound);
+        return;
+    }
+    m_mediaRequestCount++;
+
+    // Scale the image like a real server would, anything else is served as it is.
+    auto image = QImage::fromData(*it);
+    if (image.isNull()) {
+        responder.write(*it, "application/octet-stream");
+        return;
+    }
+    const QSize size(request.query().queryItemValue(u"width"_s).toInt(), request.query().queryItemValue(u"height"_s).toInt());
+    if (request.query().queryItemValue(u"method"_s) == u"crop"_s) {
+        image = image.scaled(size, Qt::KeepAspectRatioByExpanding, Qt::SmoothTransformation);
+        image = image.copy(QRect(QPoint((image.width() - size.width()) / 2, (image.height() - size.height()) / 2), size));
+    } else {
+        image = image.scaled(size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    }
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    image.save(&buffer, "PNG");
+    responder.write(data, "image/png");
+}
+
 void Server::sync(const QHttpServerRequest &request, QHttpServerResponder &responder)
 {
     QJsonObject joinRooms;
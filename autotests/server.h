@@ -5,6 +5,7 @@
 #include <QHttpServer>
 #include <QJsonObject>
 #include <QSslServer>
+#include <QUrl>
 
 struct Changes {
     struct NewRoom {
@@ -71,11 +72,37 @@ public:
     QString sendEvent(const QString &roomId, const QString &eventType, const QJsonObject &content);
     QString sendStateEvent(const QString &roomId, const QString &eventType, const QString &stateKey, const QJsonObject &content);
 
+    /**
+     * Add a notification for the event with id eventId, previously sent with sendEvent, to the user's notifications.
+     */
+    void addNotification(const QString &roomId, const QString &eventId, bool highlight = true);
+
+    /**
+     * Mark all notifications in the room as read.
+     */
+    void markNotificationsRead(const QString &roomId);
+
+    /**
+     * Store data in the media repository and return its mxc URL.
+     */
+    QUrl uploadMedia(const QByteArray &data);
+
+    /**
+     * The number of media downloads and thumbnails that have been served.
+     */
+    int mediaRequestCount() const;
+
 private:
     QHttpServer m_server;
     QSslServer m_sslServer;
 
     void sync(const QHttpServerRequest &request, QHttpServerResponder &responder);
+    void notifications(const QHttpServerRequest &request, QHttpServerResponder &responder);
+    void mediaThumbnail(const QString &serverName, const QString &mediaId, QHttpServerResponder &responder, const QHttpServerRequest &request);
 
     QList<Changes> m_state;
+    // Oldest first
+    QList<QJsonObject> m_notifications;
+    QHash<QString, QByteArray> m_media;
+    int m_mediaRequestCount = 0;
 };
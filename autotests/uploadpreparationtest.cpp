@@ -0,0 +1,193 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QImageReader>
+#include <QImageWriter>
+#include <QMimeDatabase>
+#include <QObject>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QtConcurrent>
+
+#include <Quotient/events/roommessageevent.h>
+
+#include "uploadpreparation.h"
+
+using namespace Qt::StringLiterals;
+
+class UploadPreparationTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    QTemporaryDir m_dir;
+
+    QString writeImage(const QString &name, const QSize &size, QImageIOHandler::Transformations transformation = QImageIOHandler::TransformationNone);
+    static PreparedImage prepare(const QString &path, int maxDimension = 0);
+    static void cleanup(const PreparedImage &prepared);
+
+private Q_SLOTS:
+    void smallImage();
+    void largeImage();
+    void downscale();
+    void orientation();
+    void notAnImage();
+    void sentBlurhash();
+};
+
+QString UploadPreparationTest::writeImage(const QString &name, const QSize &size, QImageIOHandler::Transformations transformation)
+{
+    QImage image(size, QImage::Format_RGB888);
+    image.fill(Qt::darkCyan);
+    const auto path = m_dir.filePath(name);
+    QImageWriter writer(path);
+    writer.setTransformation(transformation);
+    if (!writer.write(image)) {
+        qWarning() << writer.errorString();
+    }
+    return path;
+}
+
+PreparedImage UploadPreparationTest::prepare(const QString &path, int maxDimension)
+{
+    auto future = QtConcurrent::run(&UploadPreparation::prepareImage, path, maxDimension);
+    future.waitForFinished();
+    return future.result();
+}
+
+void UploadPreparationTest::cleanup(const PreparedImage &prepared)
+{
+    if (prepared.temporaryFile) {
+        QFile::remove(prepared.filePath);
+    }
+    if (!prepared.thumbnailPath.isEmpty()) {
+        QFile::remove(prepared.thumbnailPath);
+    }
+}
+
+void UploadPreparationTest::smallImage()
+{
+    const auto path = writeImage(u"small.png"_s, {300, 200});
+    const auto prepared = prepare(path, 1280);
+
+    QCOMPARE(prepared.filePath, path);
+    QVERIFY(!prepared.temporaryFile);
+    QCOMPARE(prepared.size, QSize(300, 200));
+    QCOMPARE(prepared.fileSize, QFileInfo(path).size());
+    QCOMPARE(prepared.mimeType.name(), u"image/png"_s);
+    // Small enough to be its own thumbnail.
+    QVERIFY(prepared.thumbnailPath.isEmpty());
+    QCOMPARE(prepared.blurhash.size(), 28);
+}
+
+void UploadPreparationTest::largeImage()
+{
+    const auto path = writeImage(u"large.jpg"_s, {3000, 1500});
+    const auto prepared = prepare(path);
+
+    QCOMPARE(prepared.filePath, path);
+    QVERIFY(!prepared.temporaryFile);
+    QCOMPARE(prepared.size, QSize(3000, 1500));
+    QVERIFY(QFile::exists(prepared.thumbnailPath));
+    QCOMPARE(prepared.thumbnailSize, QSize(800, 400));
+    QCOMPARE(QImageReader(prepared.thumbnailPath).size(), QSize(800, 400));
+    QCOMPARE(prepared.thumbnailFileSize, QFileInfo(prepared.thumbnailPath).size());
+    QVERIFY(!prepared.blurhash.isEmpty());
+    cleanup(prepared);
+}
+
+void UploadPreparationTest::downscale()
+{
+    const auto path = writeImage(u"downscale.jpg"_s, {3000, 1500});
+    const auto prepared = prepare(path, 1000);
+
+    QVERIFY(prepared.temporaryFile);
+    QVERIFY(prepared.filePath != path);
+    QCOMPARE(prepared.size, QSize(1000, 500));
+    QCOMPARE(QImageReader(prepared.filePath).size(), QSize(1000, 500));
+    QCOMPARE(prepared.mimeType.name(), u"image/jpeg"_s);
+    QCOMPARE(prepared.fileSize, QFileInfo(prepared.filePath).size());
+    QCOMPARE(prepared.thumbnailSize, QSize(800, 400));
+    cleanup(prepared);
+    // The original is left alone.
+    QCOMPARE(QImageReader(path).size(), QSize(3000, 1500));
+}
+
+void UploadPreparationTest::orientation()
+{
+    const auto path = writeImage(u"rotated.jpg"_s, {2000, 1000}, QImageIOHandler::TransformationRotate90);
+    if (QImageReader(path).transformation() != QImageIOHandler::TransformationRotate90) {
+        QSKIP("The JPEG plugin doesn't write the orientation");
+    }
+
+    const auto prepared = prepare(path);
+    QCOMPARE(prepared.size, QSize(1000, 2000));
+    QCOMPARE(prepared.thumbnailSize, QSize(300, 600));
+    cleanup(prepared);
+
+    const auto downscaled = prepare(path, 1000);
+    QCOMPARE(downscaled.size, QSize(500, 1000));
+    // The orientation is applied to the pixels of the copy.
+    QImageReader reader(downscaled.filePath);
+    reader.setAutoTransform(true);
+    QCOMPARE(reader.read().size(), QSize(500, 1000));
+    cleanup(downscaled);
+}
+
+void UploadPreparationTest::notAnImage()
+{
+    const auto path = m_dir.filePath(u"broken.png"_s);
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write("definitely not a png");
+    file.close();
+
+    const auto prepared = prepare(path, 1000);
+    QCOMPARE(prepared.filePath, path);
+    QVERIFY(!prepared.temporaryFile);
+    QVERIFY(!prepared.size.isValid());
+    QVERIFY(prepared.thumbnailPath.isEmpty());
+    QVERIFY(prepared.blurhash.isEmpty());
+}
+
+void UploadPreparationTest::sentBlurhash()
+{
+    using namespace Quotient;
+    const auto blurhashOf = [](const RoomMessageEvent &event) {
+        return event.contentJson()["info"_L1].toObject()["xyz.amorgan.blurhash"_L1].toString();
+    };
+    const auto url = QUrl::fromLocalFile(m_dir.filePath(u"upload"_s));
+
+    auto imageContent = std::make_unique<UploadPreparation::BlurhashContent<EventContent::ImageContent>>(url,
+                                                                                                         1000,
+                                                                                                         QMimeDatabase().mimeTypeForName(u"image/png"_s),
+                                                                                                         QSize(300, 200),
+                                                                                                         u"image.png"_s);
+    imageContent->blurhash = u"LEHV6nWB2yk8pyo0adR*.7kCMdnj"_s;
+    const RoomMessageEvent imageEvent(u"image.png"_s, MessageEventType::Image, std::move(imageContent));
+    QCOMPARE(blurhashOf(imageEvent), u"LEHV6nWB2yk8pyo0adR*.7kCMdnj"_s);
+    // The known fields are still sent.
+    QCOMPARE(imageEvent.contentJson()["info"_L1].toObject()["w"_L1].toInt(), 300);
+
+    auto videoContent = std::make_unique<UploadPreparation::BlurhashContent<EventContent::VideoContent>>(url,
+                                                                                                         1000,
+                                                                                                         QMimeDatabase().mimeTypeForName(u"video/mp4"_s),
+                                                                                                         QSize(640, 480),
+                                                                                                         u"video.mp4"_s);
+    videoContent->blurhash = u"L6PZfSi_.AyE_3t7t7R**0o#DgR4"_s;
+    const RoomMessageEvent videoEvent(u"video.mp4"_s, MessageEventType::Video, std::move(videoContent));
+    QCOMPARE(blurhashOf(videoEvent), u"L6PZfSi_.AyE_3t7t7R**0o#DgR4"_s);
+
+    // Without a blurhash the info is left as it is.
+    const RoomMessageEvent plainEvent(u"image.png"_s,
+                                      MessageEventType::Image,
+                                      std::make_unique<UploadPreparation::BlurhashContent<EventContent::ImageContent>>(url,
+                                                                                                                       1000,
+                                                                                                                       QMimeDatabase().mimeTypeForName(u"image/png"_s),
+                                                                                                                       QSize(300, 200),
+                                                                                                                       u"image.png"_s));
+    QVERIFY(!plainEvent.contentJson()["info"_L1].toObject().contains("xyz.amorgan.blurhash"_L1));
+}
+
+QTEST_GUILESS_MAIN(UploadPreparationTest)
+#include "uploadpreparationtest.moc"
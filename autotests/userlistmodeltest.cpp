@@ -0,0 +1,276 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QAbstractItemModelTester>
+#include <QCollator>
+#include <QJsonArray>
+#include <QObject>
+#include <QSignalSpy>
+#include <QTest>
+
+#include <Quotient/connection.h>
+#include <Quotient/syncdata.h>
+
+#include "models/userlistmodel.h"
+#include "testutils.h"
+
+using namespace Quotient;
+using namespace Qt::StringLiterals;
+
+class UserListModelTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    Connection *connection = nullptr;
+    TestUtils::TestRoom *room = nullptr;
+    UserListModel *model = nullptr;
+    int m_eventCount = 0;
+
+    QJsonObject memberEvent(const QString &userId, const QString &displayName);
+    static void sync(TestUtils::TestRoom *room, const QString &section, const QJsonArray &events);
+    static bool isSorted(const UserListModel &model);
+    static QStringList userIds(const UserListModel &model);
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void sorted();
+    void joinInsertsAtSortedRow();
+    void renameMovesRow();
+    void joinStorm();
+    void orderedByDisplayName();
+
+    void benchmarkJoinStorm();
+    void benchmarkRenames();
+};
+
+QJsonObject UserListModelTest::memberEvent(const QString &userId, const QString &displayName)
+{
+    return QJsonObject{
+        {u"type"_s, u"m.room.member"_s},
+        {u"event_id"_s, u"$member%1"_s.arg(++m_eventCount)},
+        {u"sender"_s, userId},
+        {u"state_key"_s, userId},
+        {u"origin_server_ts"_s, 1432735824653 + m_eventCount},
+        {u"content"_s,
+         QJsonObject{
+             {u"membership"_s, u"join"_s},
+             {u"displayname"_s, displayName},
+         }},
+    };
+}
+
+void UserListModelTest::sync(TestUtils::TestRoom *room, const QString &section, const QJsonArray &events)
+{
+    room->update(SyncRoomData(room->id(), JoinState::Join, QJsonObject{{section, QJsonObject{{u"events"_s, events}}}}));
+}
+
+bool UserListModelTest::isSorted(const UserListModel &model)
+{
+    QCollator collator;
+    collator.setCaseSensitivity(Qt::CaseInsensitive);
+    for (int row = 1; row < model.rowCount(); ++row) {
+        const auto previous = model.index(row - 1);
+        const auto current = model.index(row);
+        const auto previousLevel = model.data(previous, UserListModel::PowerLevelRole).toInt();
+        const auto currentLevel = model.data(current, UserListModel::PowerLevelRole).toInt();
+        if (previousLevel != currentLevel) {
+            if (previousLevel < currentLevel) {
+                return false;
+            }
+            continue;
+        }
+        if (collator.compare(model.data(previous, UserListModel::DisplayNameRole).toString(), model.data(current, UserListModel::DisplayNameRole).toString())
+            > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+QStringList UserListModelTest::userIds(const UserListModel &model)
+{
+    QStringList ids;
+    for (int row = 0; row < model.rowCount(); ++row) {
+        ids += model.data(model.index(row), UserListModel::UserIdRole).toString();
+    }
+    return ids;
+}
+
+void UserListModelTest::initTestCase()
+{
+    connection = Connection::makeMockConnection(u"@bob:kde.org"_s);
+    room = new TestUtils::TestRoom(connection, u"#myroom:kde.org"_s);
+    sync(room,
+         u"state"_s,
+         QJsonArray{
+             QJsonObject{
+                 {u"type"_s, u"m.room.power_levels"_s},
+                 {u"event_id"_s, u"$powerlevels"_s},
+                 {u"sender"_s, u"@admin:example.org"_s},
+                 {u"state_key"_s, QString()},
+                 {u"origin_server_ts"_s, 1432735824653},
+                 {u"content"_s,
+                  QJsonObject{
+                      {u"users"_s, QJsonObject{{u"@admin:example.org"_s, 100}, {u"@mod:example.org"_s, 50}}},
+                      {u"users_default"_s, 0},
+                  }},
+             },
+             memberEvent(u"@carol:example.org"_s, u"Carol"_s),
+             memberEvent(u"@admin:example.org"_s, u"Zed"_s),
+             memberEvent(u"@bob:example.org"_s, u"bob"_s),
+             memberEvent(u"@mod:example.org"_s, u"Mallory"_s),
+             memberEvent(u"@alice:example.org"_s, u"Alice"_s),
+         });
+
+    model = new UserListModel(this);
+    new QAbstractItemModelTester(model, QAbstractItemModelTester::FailureReportingMode::QtTest, model);
+    model->setRoom(room);
+    model->activate();
+}
+
+void UserListModelTest::sorted()
+{
+    QCOMPARE(userIds(*model),
+             (QStringList{
+                 u"@admin:example.org"_s,
+                 u"@mod:example.org"_s,
+                 u"@alice:example.org"_s,
+                 u"@bob:example.org"_s,
+                 u"@carol:example.org"_s,
+             }));
+    QVERIFY(isSorted(*model));
+}
+
+void UserListModelTest::joinInsertsAtSortedRow()
+{
+    QSignalSpy spy(model, &QAbstractItemModel::rowsInserted);
+    sync(room, u"timeline"_s, QJsonArray{memberEvent(u"@amy:example.org"_s, u"Amy"_s)});
+
+    // Joins are inserted once control returns to the event loop.
+    QTRY_COMPARE(spy.count(), 1);
+    QCOMPARE(spy[0][1].toInt(), 3);
+    QCOMPARE(spy[0][2].toInt(), 3);
+    QCOMPARE(model->data(model->index(3), UserListModel::UserIdRole).toString(), u"@amy:example.org"_s);
+    QCOMPARE(model->rowCount(), 6);
+    QVERIFY(isSorted(*model));
+}
+
+void UserListModelTest::renameMovesRow()
+{
+    QSignalSpy moveSpy(model, &QAbstractItemModel::rowsMoved);
+    QSignalSpy dataSpy(model, &QAbstractItemModel::dataChanged);
+    sync(room, u"timeline"_s, QJsonArray{memberEvent(u"@alice:example.org"_s, u"Zoe"_s)});
+
+    QCOMPARE(moveSpy.count(), 1);
+    QCOMPARE(moveSpy[0][1].toInt(), 2);
+    QCOMPARE(model->rowCount(), 6);
+    QCOMPARE(model->data(model->index(5), UserListModel::UserIdRole).toString(), u"@alice:example.org"_s);
+    QCOMPARE(model->data(model->index(5), UserListModel::DisplayNameRole).toString(), u"Zoe"_s);
+    QVERIFY(!dataSpy.isEmpty());
+    QVERIFY(isSorted(*model));
+
+    // A rename that keeps the position doesn't move the row.
+    moveSpy.clear();
+    sync(room, u"timeline"_s, QJsonArray{memberEvent(u"@alice:example.org"_s, u"Zoey"_s)});
+    QCOMPARE(moveSpy.count(), 0);
+    QCOMPARE(model->data(model->index(5), UserListModel::DisplayNameRole).toString(), u"Zoey"_s);
+}
+
+void UserListModelTest::joinStorm()
+{
+    QJsonArray events;
+    for (int i = 0; i < 500; ++i) {
+        events += memberEvent(u"@storm%1:example.org"_s.arg(i), u"Storm %1"_s.arg(i));
+    }
+
+    QSignalSpy resetSpy(model, &QAbstractItemModel::modelReset);
+    QSignalSpy insertSpy(model, &QAbstractItemModel::rowsInserted);
+    sync(room, u"timeline"_s, events);
+
+    QTRY_COMPARE(model->rowCount(), 506);
+    QCOMPARE(resetSpy.count(), 1);
+    QCOMPARE(insertSpy.count(), 0);
+    QVERIFY(isSorted(*model));
+    QCOMPARE(userIds(*model).first(2), (QStringList{u"@admin:example.org"_s, u"@mod:example.org"_s}));
+}
+
+void UserListModelTest::orderedByDisplayName()
+{
+    // Members are ordered by what the list shows, not by their ids.
+    const auto orderRoom = new TestUtils::TestRoom(connection, u"#order:kde.org"_s);
+    sync(orderRoom,
+         u"state"_s,
+         QJsonArray{
+             memberEvent(u"@aaron:example.org"_s, u"Yuri"_s),
+             memberEvent(u"@zach:example.org"_s, u"Abel"_s),
+             memberEvent(u"@beth:example.org"_s, QString()),
+         });
+
+    UserListModel orderModel;
+    orderModel.setRoom(orderRoom);
+    orderModel.activate();
+    QCOMPARE(userIds(orderModel),
+             (QStringList{
+                 u"@zach:example.org"_s,
+                 u"@beth:example.org"_s,
+                 u"@aaron:example.org"_s,
+             }));
+}
+
+void UserListModelTest::benchmarkJoinStorm()
+{
+    constexpr int memberCount = 30000;
+
+    QJsonArray events;
+    for (int i = 0; i < memberCount; ++i) {
+        // Not in name order.
+        const auto n = (i * 7919) % memberCount;
+        events += memberEvent(u"@member%1:example.org"_s.arg(n), u"Member %1"_s.arg(n));
+    }
+
+    QBENCHMARK_ONCE {
+        TestUtils::TestRoom stormRoom(connection, u"#storm:kde.org"_s);
+        UserListModel stormModel;
+        stormModel.setRoom(&stormRoom);
+        stormModel.activate();
+
+        sync(&stormRoom, u"timeline"_s, events);
+        QTRY_COMPARE(stormModel.rowCount(), memberCount);
+        stormModel.setRoom(nullptr);
+    }
+}
+
+void UserListModelTest::benchmarkRenames()
+{
+    constexpr int memberCount = 30000;
+    constexpr int renameCount = 1000;
+
+    TestUtils::TestRoom renameRoom(connection, u"#renames:kde.org"_s);
+    QJsonArray events;
+    for (int i = 0; i < memberCount; ++i) {
+        events += memberEvent(u"@member%1:example.org"_s.arg(i), u"Member %1"_s.arg(i));
+    }
+    sync(&renameRoom, u"state"_s, events);
+
+    UserListModel renameModel;
+    renameModel.setRoom(&renameRoom);
+    renameModel.activate();
+    QCOMPARE(renameModel.rowCount(), memberCount);
+
+    int round = 0;
+    QBENCHMARK {
+        QJsonArray renames;
+        for (int i = 0; i < renameCount; ++i) {
+            renames += memberEvent(u"@member%1:example.org"_s.arg(i * (memberCount / renameCount)), u"Renamed %1 %2"_s.arg(round).arg(i));
+        }
+        ++round;
+        sync(&renameRoom, u"timeline"_s, renames);
+    }
+    QCOMPARE(renameModel.rowCount(), memberCount);
+    renameModel.setRoom(nullptr);
+}
+
+QTEST_MAIN(UserListModelTest)
+#include "userlistmodeltest.moc"
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QFile>
+#include <QImage>
+#include <QMediaCaptureSession>
+#include <QMediaFormat>
+#include <QMediaRecorder>
+#include <QObject>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QVideoFrame>
+#include <QVideoFrameInput>
+
+#include "blurhash.h"
+#include "videothumbnailextractor.h"
+
+using namespace Qt::StringLiterals;
+using namespace std::chrono_literals;
+
+class VideoThumbnailExtractorTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    QTemporaryDir m_dir;
+    QString m_clip;
+
+    static constexpr QSize clipSize{320, 240};
+    static constexpr int frameRate = 15;
+    static constexpr int frameCount = 30;
+
+    VideoThumbnail waitForThumbnail(QFuture<VideoThumbnail> future);
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void representativePosition();
+    void extract();
+    void concurrencyCap();
+    void invalidFile();
+};
+
+VideoThumbnail VideoThumbnailExtractorTest::waitForThumbnail(QFuture<VideoThumbnail> future)
+{
+    if (!QTest::qWaitFor(
+            [&future]() {
+                return future.isFinished();
+            },
+            20000)) {
+        return {};
+    }
+    return future.result();
+}
+
+void VideoThumbnailExtractorTest::initTestCase()
+{
+    QVERIFY(m_dir.isValid());
+
+    // Generate a two second clip that starts black and then turns green, like a fade in.
+    QMediaFormat format(QMediaFormat::MPEG4);
+    format.setVideoCodec(QMediaFormat::VideoCodec::H264);
+    if (!format.isSupported(QMediaFormat::Encode)) {
+        QSKIP("Encoding H.264 video isn't supported here");
+    }
+
+    QMediaCaptureSession session;
+    QVideoFrameInput input;
+    QMediaRecorder recorder;
+    session.setVideoFrameInput(&input);
+    session.setRecorder(&recorder);
+    recorder.setMediaFormat(format);
+    recorder.setVideoResolution(clipSize);
+    recorder.setVideoFrameRate(frameRate);
+    m_clip = m_dir.filePath(u"clip.mp4"_s);
+    recorder.setOutputLocation(QUrl::fromLocalFile(m_clip));
+
+    int sent = 0;
+    const auto sendFrames = [&]() {
+        while (sent < frameCount) {
+            QImage image(clipSize, QImage::Format_RGB32);
+            image.fill(sent < 2 ? Qt::black : Qt::green);
+            QVideoFrame frame(image);
+            frame.setStartTime(qint64(sent) * 1000000 / frameRate);
+            frame.setEndTime(qint64(sent + 1) * 1000000 / frameRate);
+            if (!input.sendVideoFrame(frame)) {
+                return;
+            }
+            ++sent;
+        }
+        recorder.stop();
+    };
+    connect(&input, &QVideoFrameInput::readyToSendVideoFrame, this, sendFrames);
+
+    QSignalSpy stateSpy(&recorder, &QMediaRecorder::recorderStateChanged);
+    recorder.record();
+    if (recorder.error() != QMediaRecorder::NoError) {
+        QSKIP(qPrintable(u"Can't record video: "_s + recorder.errorString()));
+    }
+    sendFrames();
+    QTRY_COMPARE_WITH_TIMEOUT(recorder.recorderState(), QMediaRecorder::StoppedState, 20000);
+    QCOMPARE(sent, frameCount);
+    QVERIFY(QFile::exists(m_clip));
+}
+
+void VideoThumbnailExtractorTest::representativePosition()
+{
+    QCOMPARE(VideoThumbnailExtractor::representativePosition(0), qint64(0));
+    QCOMPARE(VideoThumbnailExtractor::representativePosition(2000), qint64(200));
+    QCOMPARE(VideoThumbnailExtractor::representativePosition(10 * 60 * 1000), qint64(3000));
+}
+
+void VideoThumbnailExtractorTest::extract()
+{
+    VideoThumbnailExtractor extractor;
+    const auto result = waitForThumbnail(extractor.extract(QUrl::fromLocalFile(m_clip)));
+
+    QCOMPARE(result.videoSize, clipSize);
+    QVERIFY(result.duration > 1500);
+    QVERIFY(!result.thumbnail.path.isEmpty());
+    QCOMPARE(result.thumbnail.size, clipSize);
+    QCOMPARE(result.thumbnail.fileSize, QFile(result.thumbnail.path).size());
+
+    // The frame a tenth into the clip is past the black start.
+    QImage thumbnail(result.thumbnail.path);
+    QVERIFY(!thumbnail.isNull());
+    const auto centre = thumbnail.pixelColor(thumbnail.rect().center());
+    QVERIFY2(centre.green() > 200 && centre.red() < 60 && centre.blue() < 60, qPrintable(centre.name()));
+
+    QVERIFY(!Quotient::BlurHash::decode(result.thumbnail.blurhash, QSize(32, 32)).isNull());
+    QFile::remove(result.thumbnail.path);
+}
+
+void VideoThumbnailExtractorTest::concurrencyCap()
+{
+    VideoThumbnailExtractor extractor;
+    extractor.setMaxConcurrent(2);
+
+    QList<QFuture<VideoThumbnail>> futures;
+    for (int i = 0; i < 5; ++i) {
+        futures += extractor.extract(QUrl::fromLocalFile(m_clip));
+    }
+    QCOMPARE(extractor.runningCount(), 2);
+    QCOMPARE(extractor.queuedCount(), 3);
+
+    for (const auto &future : std::as_const(futures)) {
+        const auto result = waitForThumbnail(future);
+        QVERIFY(!result.thumbnail.path.isEmpty());
+        QFile::remove(result.thumbnail.path);
+        QVERIFY(extractor.runningCount() <= 2);
+    }
+    QTRY_COMPARE(extractor.runningCount(), 0);
+    QCOMPARE(extractor.queuedCount(), 0);
+}
+
+void VideoThumbnailExtractorTest::invalidFile()
+{
+    const auto path = m_dir.filePath(u"broken.mp4"_s);
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write("This is not a video");
+    file.close();
+
+    VideoThumbnailExtractor extractor;
+    extractor.setTimeout(5s);
+    const auto result = waitForThumbnail(extractor.extract(QUrl::fromLocalFile(path)));
+    QVERIFY(result.thumbnail.path.isEmpty());
+}
+
+QTEST_MAIN(VideoThumbnailExtractorTest)
+#include "videothumbnailextractortest.moc"
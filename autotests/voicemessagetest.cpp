@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QObject>
+#include <QRandomGenerator>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <Quotient/e2ee/cryptoutils.h>
+
+#include <cmath>
+
+#include "audiowaveform.h"
+#include "fileencryption.h"
+
+using namespace Qt::StringLiterals;
+
+class VoiceMessageTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void waveform();
+    void waveformDownsampled();
+    void waveformFirstChannel();
+    void waveformEmpty();
+
+    void encryptChunked_data();
+    void encryptChunked();
+    void encryptFileRoundTrip();
+};
+
+namespace
+{
+QAudioFormat monoInt16()
+{
+    QAudioFormat format;
+    format.setSampleFormat(QAudioFormat::Int16);
+    format.setSampleRate(48000);
+    format.setChannelCount(1);
+    return format;
+}
+
+// @p seconds of a 440 Hz sine with the given amplitude, 0 being silence.
+QByteArray sine(const QAudioFormat &format, double seconds, double amplitude)
+{
+    const auto frames = qsizetype(format.sampleRate() * seconds);
+    QByteArray data(frames * format.bytesPerFrame(), 0);
+    auto samples = reinterpret_cast<qint16 *>(data.data());
+    for (qsizetype i = 0; i < frames; ++i) {
+        samples[i] = qint16(std::lround(amplitude * 32767 * std::sin(2 * M_PI * 440 * i / format.sampleRate())));
+    }
+    return data;
+}
+
+// Feed @p data in pieces that don't line up with frames, like an audio device would.
+void feed(AudioWaveform &waveform, const QByteArray &data, const QAudioFormat &format)
+{
+    for (qsizetype offset = 0; offset < data.size(); offset += 1001) {
+        waveform.addData(data.mid(offset, 1001), format);
+    }
+}
+
+QByteArray randomBytes(qsizetype size)
+{
+    QByteArray bytes(size, Qt::Uninitialized);
+    for (auto &byte : bytes) {
+        byte = char(QRandomGenerator::global()->bounded(256));
+    }
+    return bytes;
+}
+}
+
+void VoiceMessageTest::waveform()
+{
+    const auto format = monoInt16();
+    AudioWaveform waveform;
+    feed(waveform, sine(format, 1, 0) + sine(format, 1, 0.5), format);
+
+    const auto summary = waveform.summary();
+    QCOMPARE(summary.size(), 20);
+    for (int i = 0; i < 10; ++i) {
+        QCOMPARE(summary[i], 0);
+    }
+    for (int i = 10; i < 20; ++i) {
+        QVERIFY2(std::abs(summary[i] - AudioWaveform::maxValue / 2) <= 2, qPrintable(QString::number(summary[i])));
+    }
+}
+
+void VoiceMessageTest::waveformDownsampled()
+{
+    const auto format = monoInt16();
+    AudioWaveform waveform;
+    // A minute of audio getting louder every ten seconds.
+    for (int i = 0; i < 6; ++i) {
+        feed(waveform, sine(format, 10, (i + 1) / 6.0), format);
+    }
+
+    const auto summary = waveform.summary();
+    QCOMPARE(summary.size(), AudioWaveform::defaultLength);
+    QVERIFY(std::abs(summary.first() - AudioWaveform::maxValue / 6) <= 2);
+    QVERIFY(summary.last() >= AudioWaveform::maxValue - 1);
+    for (qsizetype i = 1; i < summary.size(); ++i) {
+        // Allow for the sampled peaks of a sine not all being the same.
+        QVERIFY(summary[i] >= summary[i - 1] - 2);
+    }
+
+    QCOMPARE(waveform.summary(6).size(), 6);
+
+    waveform.reset();
+    QVERIFY(waveform.summary().isEmpty());
+}
+
+void VoiceMessageTest::waveformFirstChannel()
+{
+    QAudioFormat format;
+    format.setSampleFormat(QAudioFormat::Float);
+    format.setSampleRate(8000);
+    format.setChannelCount(2);
+
+    // Silence on the left, full scale on the right.
+    QByteArray data;
+    for (int i = 0; i < 8000; ++i) {
+        const float frame[] = {0.0f, i % 2 ? 1.0f : -1.0f};
+        data.append(reinterpret_cast<const char *>(frame), sizeof(frame));
+    }
+
+    AudioWaveform waveform;
+    feed(waveform, data, format);
+    QCOMPARE(waveform.summary(), QList<int>(10, 0));
+}
+
+void VoiceMessageTest::waveformEmpty()
+{
+    AudioWaveform waveform;
+    QVERIFY(waveform.summary().isEmpty());
+    waveform.addData(QByteArray(1, 0), monoInt16());
+    QVERIFY(waveform.summary().isEmpty());
+}
+
+void VoiceMessageTest::encryptChunked_data()
+{
+    QTest::addColumn<qsizetype>("size");
+    QTest::addColumn<qint64>("chunkSize");
+    QTest::addColumn<QByteArray>("iv");
+
+    const auto randomIv = randomBytes(Quotient::AesBlockSize);
+    // The counter has to carry through all 16 bytes of the IV.
+    const auto overflowingIv = QByteArray(Quotient::AesBlockSize, char(0xff));
+
+    QTest::newRow("empty") << qsizetype(0) << FileEncryption::defaultChunkSize << randomIv;
+    QTest::newRow("single chunk") << qsizetype(1000) << FileEncryption::defaultChunkSize << randomIv;
+    QTest::newRow("many chunks") << qsizetype(200 * 1024 + 5) << FileEncryption::defaultChunkSize << randomIv;
+    QTest::newRow("small chunks") << qsizetype(10 * 1024 + 7) << qint64(48) << randomIv;
+    QTest::newRow("overflowing counter") << qsizetype(10 * 1024 + 7) << qint64(48) << overflowingIv;
+}
+
+void VoiceMessageTest::encryptChunked()
+{
+    QFETCH(qsizetype, size);
+    QFETCH(qint64, chunkSize);
+    QFETCH(QByteArray, iv);
+
+    const auto key = randomBytes(Quotient::Aes256KeySize);
+    auto plainText = randomBytes(size);
+
+    QBuffer input(&plainText);
+    QVERIFY(input.open(QIODevice::ReadOnly));
+    QByteArray cipherText;
+    QBuffer output(&cipherText);
+    QVERIFY(output.open(QIODevice::WriteOnly));
+
+    const auto hash = FileEncryption::encrypt(input, output, key, iv, chunkSize);
+    QVERIFY(!hash.isEmpty());
+
+    const auto expected = Quotient::aesCtr256Encrypt(plainText, Quotient::asCBytes<Quotient::Aes256KeySize>(key), Quotient::asCBytes<Quotient::AesBlockSize>(iv));
+    QVERIFY(expected);
+    QCOMPARE(cipherText, *expected);
+    QCOMPARE(hash, QCryptographicHash::hash(cipherText, QCryptographicHash::Sha256));
+}
+
+void VoiceMessageTest::encryptFileRoundTrip()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    // Stands in for a recording, several chunks long.
+    const auto plainText = sine(monoInt16(), 3, 0.5);
+    QFile input(dir.filePath(u"voice.ogg"_s));
+    QVERIFY(input.open(QIODevice::WriteOnly));
+    input.write(plainText);
+    input.close();
+
+    const auto metadata = FileEncryption::encryptFile(input.fileName(), dir.filePath(u"voice.ogg.enc"_s));
+    QVERIFY(metadata);
+    QCOMPARE(metadata->v, u"v2"_s);
+    QCOMPARE(metadata->key.alg, u"A256CTR"_s);
+
+    QFile output(dir.filePath(u"voice.ogg.enc"_s));
+    QVERIFY(output.open(QIODevice::ReadOnly));
+    const auto cipherText = output.readAll();
+    QCOMPARE(cipherText.size(), plainText.size());
+    QVERIFY(cipherText != plainText);
+    QCOMPARE(metadata->hashes[u"sha256"_s],
+             QString::fromLatin1(QCryptographicHash::hash(cipherText, QCryptographicHash::Sha256).toBase64(QByteArray::OmitTrailingEquals)));
+
+    QCOMPARE(Quotient::decryptFile(cipherText, *metadata), plainText);
+
+    QVERIFY(!FileEncryption::encryptFile(dir.filePath(u"missing.ogg"_s), dir.filePath(u"missing.ogg.enc"_s)));
+}
+
+QTEST_GUILESS_MAIN(VoiceMessageTest)
+#include "voicemessagetest.moc"
@@ -5,6 +5,8 @@
 
 #include "blurhash.h"
 
+using namespace Qt::StringLiterals;
+
 /*
  * Qt unfortunately re-encodes the base83 string in QML.
  * The only special ASCII characters used in the blurhash base83 string are:
@@ -36,6 +38,10 @@ static const QMap<QLatin1String, QLatin1String> knownEncodings = {
 };
 // clang-format on
 
+// Placeholders are small, so a handful of megabytes covers a full timeline of them.
+static constexpr qsizetype cacheBudget = 16 * 1024 * 1024;
+static constexpr int maxDecodeThreads = 2;
+
 class AsyncImageResponseRunnable : public QObject, public QRunnable
 {
     Q_OBJECT
@@ -44,40 +50,32 @@ Q_SIGNALS:
     void done(QImage image);
 
 public:
-    AsyncImageResponseRunnable(const QString &id, const QSize &requestedSize)
-        : m_id(id)
-        , m_requestedSize(requestedSize)
+    AsyncImageResponseRunnable(BlurHashImageProvider *provider, const QString &key, const QString &blurhash, const QSize &size)
+        : m_provider(provider)
+        , m_key(key)
+        , m_blurhash(blurhash)
+        , m_size(size)
     {
-        if (m_requestedSize.width() == -1)
-            m_requestedSize.setWidth(64);
-        if (m_requestedSize.height() == -1)
-            m_requestedSize.setHeight(64);
     }
 
     void run() override
     {
-        if (m_id.isEmpty())
-            return;
-
-        QString decodedId = m_id;
-        for (auto i = knownEncodings.constBegin(); i != knownEncodings.constEnd(); ++i)
-            decodedId.replace(i.key(), i.value());
+        const auto image = Quotient::BlurHash::decode(m_blurhash, m_size);
 
-        Q_EMIT done(Quotient::BlurHash::decode(decodedId, m_requestedSize));
+        // Emitted while the provider still holds its lock, so a request that joined
+        // this decode is guaranteed to be connected before the result goes out.
+        QMutexLocker locker(&m_provider->m_mutex);
+        m_provider->finishDecode(m_key, image);
+        Q_EMIT done(image);
     }
 
 private:
-    QString m_id;
-    QSize m_requestedSize;
+    BlurHashImageProvider *m_provider;
+    QString m_key;
+    QString m_blurhash;
+    QSize m_size;
 };
 
-AsyncImageResponse::AsyncImageResponse(const QString &id, const QSize &requestedSize, QThreadPool *pool)
-{
-    const auto runnable = new AsyncImageResponseRunnable(id, requestedSize);
-    connect(runnable, &AsyncImageResponseRunnable::done, this, &AsyncImageResponse::handleDone);
-    pool->start(runnable);
-}
-
 void AsyncImageResponse::handleDone(QImage image)
 {
     m_image = std::move(image);
@@ -89,9 +87,57 @@ QQuickTextureFactory *AsyncImageResponse::textureFactory() const
     return QQuickTextureFactory::textureFactoryForImage(m_image);
 }
 
+BlurHashImageProvider::BlurHashImageProvider()
+    : m_cache(cacheBudget)
+{
+    pool.setMaxThreadCount(std::clamp(QThread::idealThreadCount() / 2, 1, maxDecodeThreads));
+}
+
 QQuickImageResponse *BlurHashImageProvider::requestImageResponse(const QString &id, const QSize &requestedSize)
 {
-    return new AsyncImageResponse(id, requestedSize, &pool);
+    const auto response = new AsyncImageResponse;
+
+    QString blurhash = id;
+    for (auto i = knownEncodings.constBegin(); i != knownEncodings.constEnd(); ++i)
+        blurhash.replace(i.key(), i.value());
+
+    if (blurhash.isEmpty()) {
+        QMetaObject::invokeMethod(response, &AsyncImageResponse::handleDone, Qt::QueuedConnection, QImage());
+        return response;
+    }
+
+    QSize size = requestedSize;
+    if (size.width() == -1)
+        size.setWidth(64);
+    if (size.height() == -1)
+        size.setHeight(64);
+
+    const auto key = u"%1@%2x%3"_s.arg(blurhash, QString::number(size.width()), QString::number(size.height()));
+
+    QMutexLocker locker(&m_mutex);
+    if (const auto image = m_cache.object(key)) {
+        // QQuickImageResponse::finished is only picked up after the response has been returned.
+        QMetaObject::invokeMethod(response, &AsyncImageResponse::handleDone, Qt::QueuedConnection, *image);
+        return response;
+    }
+
+    auto runnable = m_pending.value(key);
+    if (!runnable) {
+        runnable = new AsyncImageResponseRunnable(this, key, blurhash, size);
+        m_pending.insert(key, runnable);
+        pool.start(runnable);
+    }
+    connect(runnable, &AsyncImageResponseRunnable::done, response, &AsyncImageResponse::handleDone);
+
+    return response;
+}
+
+void BlurHashImageProvider::finishDecode(const QString &key, const QImage &image)
+{
+    m_pending.remove(key);
+    if (!image.isNull()) {
+        m_cache.insert(key, new QImage(image), image.sizeInBytes());
+    }
 }
 
 #include "blurhashimageprovider.moc"
@@ -3,23 +3,46 @@
 
 #pragma once
 
+#include <QCache>
+#include <QMutex>
 #include <QQuickAsyncImageProvider>
 #include <QThreadPool>
 
+class AsyncImageResponseRunnable;
+
 class AsyncImageResponse final : public QQuickImageResponse
 {
 public:
-    AsyncImageResponse(const QString &id, const QSize &requestedSize, QThreadPool *pool);
+    AsyncImageResponse() = default;
     void handleDone(QImage image);
     QQuickTextureFactory *textureFactory() const override;
     QImage m_image;
 };
 
+/**
+ * @class BlurHashImageProvider
+ *
+ * Decodes blurhash placeholders on a small dedicated thread pool.
+ *
+ * Decoded images are kept in an LRU cache keyed by the hash and the requested
+ * size, with the budget counted in bytes. Identical requests that arrive while
+ * a decode is running share its result instead of decoding again.
+ */
 class BlurHashImageProvider : public QQuickAsyncImageProvider
 {
 public:
+    BlurHashImageProvider();
+
     QQuickImageResponse *requestImageResponse(const QString &id, const QSize &requestedSize) override;
 
 private:
+    friend class AsyncImageResponseRunnable;
+
+    void finishDecode(const QString &key, const QImage &image);
+
+    QMutex m_mutex;
+    QCache<QString, QImage> m_cache;
+    QHash<QString, AsyncImageResponseRunnable *> m_pending;
+    // Declared last so that running decodes are waited for before the cache goes away.
     QThreadPool pool;
 };
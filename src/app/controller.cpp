@@ -20,6 +20,7 @@
 #include "enums/roomsortparameter.h"
 #include "general_logging.h"
 #include "mediasizehelper.h"
+#include "mediathumbnailcache.h"
 #include "models/actionsmodel.h"
 #include "models/messagecontentmodel.h"
 #include "models/messagemodel.h"
@@ -81,6 +82,11 @@ Controller::Controller(QObject *parent)
         NeoChatConnection::setKeywordPushRuleDefault(static_cast<PushRuleAction::Action>(NeoChatConfig::keywordPushRuleDefault()));
     });
 
+    MediaThumbnailCache::instance().setMaxSize(qint64(NeoChatConfig::thumbnailCacheSize()) * 1024 * 1024);
+    connect(NeoChatConfig::self(), &NeoChatConfig::ThumbnailCacheSizeChanged, this, [] {
+        MediaThumbnailCache::instance().setMaxSize(qint64(NeoChatConfig::thumbnailCacheSize()) * 1024 * 1024);
+    });
+
     ActionsModel::setAllowQuickEdit(NeoChatConfig::allowQuickEdit());
     connect(NeoChatConfig::self(), &NeoChatConfig::AllowQuickEditChanged, this, []() {
         ActionsModel::setAllowQuickEdit(NeoChatConfig::allowQuickEdit());
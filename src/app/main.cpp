@@ -45,6 +45,7 @@
 
 #include "accountmanager.h"
 #include "blurhashimageprovider.h"
+#include "mediathumbnailimageprovider.h"
 #include "colorschemer.h"
 #include "controller.h"
 #include "login.h"
@@ -285,6 +286,7 @@ int main(int argc, char *argv[])
     }
 
     engine.addImageProvider(u"blurhash"_s, new BlurHashImageProvider);
+    engine.addImageProvider(u"mxcthumbnail"_s, new MediaThumbnailImageProvider);
 
     engine.loadFromModule("org.kde.neochat", "Main");
     if (engine.rootObjects().isEmpty()) {
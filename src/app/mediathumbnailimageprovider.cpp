@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "mediathumbnailimageprovider.h"
+
+#include <QCoreApplication>
+#include <QUrlQuery>
+
+#include <Quotient/accountregistry.h>
+#include <Quotient/events/roommessageevent.h>
+
+#include "controller.h"
+#include "mediathumbnailcache.h"
+#include "neochatroom.h"
+
+using namespace Qt::StringLiterals;
+using namespace Quotient;
+
+namespace
+{
+struct ThumbnailPreset {
+    QSize size;
+    QString method;
+};
+
+// The thumbnail sizes servers are recommended to pregenerate.
+const QList<ThumbnailPreset> presets = {
+    {{32, 32}, u"crop"_s},
+    {{96, 96}, u"crop"_s},
+    {{320, 240}, u"scale"_s},
+    {{640, 480}, u"scale"_s},
+    {{800, 600}, u"scale"_s},
+};
+
+const ThumbnailPreset &presetFor(const QSize &requestedSize)
+{
+    if (requestedSize.isValid()) {
+        for (const auto &preset : presets) {
+            if (preset.size.width() >= requestedSize.width() && preset.size.height() >= requestedSize.height()) {
+                return preset;
+            }
+        }
+    }
+    return presets.last();
+}
+
+std::optional<EncryptedFileMetadata> encryptedThumbnail(NeoChatRoom *room, const QString &eventId)
+{
+    if (!room || !room->usesEncryption() || eventId.isEmpty()) {
+        return std::nullopt;
+    }
+    const auto event = eventCast<const RoomMessageEvent>(room->getEvent(eventId).first);
+    if (!event || !event->has<EventContent::FileContentBase>()) {
+        return std::nullopt;
+    }
+    const auto content = event->get<EventContent::FileContentBase>();
+    const auto imageContent = dynamic_cast<const EventContent::ImageContent *>(content.get());
+    const auto videoContent = dynamic_cast<const EventContent::VideoContent *>(content.get());
+    const auto &source = imageContent ? imageContent->thumbnail.source : videoContent ? videoContent->thumbnail.source : FileSourceInfo();
+    if (const auto metadata = std::get_if<EncryptedFileMetadata>(&source)) {
+        return *metadata;
+    }
+    return std::nullopt;
+}
+}
+
+/*
+ * Lives in the GUI thread, where the cache and the connections are, and hands the
+ * image over to the response in the image loader's thread. If the response is gone
+ * by then, the connection is simply dropped.
+ */
+class MediaThumbnailLoader : public QObject
+{
+    Q_OBJECT
+
+public:
+    QCoro::Task<void> load(QUrl mediaUrl, QSize requestedSize)
+    {
+        const QUrlQuery query(mediaUrl);
+        const auto connection = Controller::instance().accounts()->get(query.queryItemValue(u"user_id"_s));
+        const auto room = connection ? dynamic_cast<NeoChatRoom *>(connection->room(query.queryItemValue(u"room_id"_s))) : nullptr;
+
+        const auto &preset = presetFor(requestedSize);
+        const auto data = co_await MediaThumbnailCache::instance().thumbnail(connection,
+                                                                             {.mxc = mediaUrl, .size = preset.size, .method = preset.method},
+                                                                             encryptedThumbnail(room, query.queryItemValue(u"event_id"_s)));
+        Q_EMIT loaded(QImage::fromData(data));
+        deleteLater();
+    }
+
+Q_SIGNALS:
+    void loaded(const QImage &image);
+};
+
+class MediaThumbnailResponse : public QQuickImageResponse
+{
+public:
+    MediaThumbnailResponse(const QString &id, const QSize &requestedSize)
+    {
+        const auto loader = new MediaThumbnailLoader;
+        loader->moveToThread(QCoreApplication::instance()->thread());
+        connect(loader, &MediaThumbnailLoader::loaded, this, [this](const QImage &image) {
+            m_image = image;
+            Q_EMIT finished();
+        });
+        const QUrl mediaUrl(u"mxc://"_s + id);
+        QMetaObject::invokeMethod(loader, [loader, mediaUrl, requestedSize] {
+            loader->load(mediaUrl, requestedSize);
+        });
+    }
+
+    QQuickTextureFactory *textureFactory() const override
+    {
+        return QQuickTextureFactory::textureFactoryForImage(m_image);
+    }
+
+private:
+    QImage m_image;
+};
+
+QQuickImageResponse *MediaThumbnailImageProvider::requestImageResponse(const QString &id, const QSize &requestedSize)
+{
+    return new MediaThumbnailResponse(id, requestedSize);
+}
+
+#include "mediathumbnailimageprovider.moc"
@@ -0,0 +1,24 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QQuickAsyncImageProvider>
+
+/**
+ * @class MediaThumbnailImageProvider
+ *
+ * Loads media thumbnails through the MediaThumbnailCache.
+ *
+ * The image id is an mxc URL made with NeoChatRoom::makeMediaUrl() without its
+ * scheme, see MediaThumbnailCache::imageUrl(). The requested size is rounded up
+ * to one of the thumbnail sizes recommended by the spec so that differently
+ * sized delegates share cache entries.
+ *
+ * @sa MediaThumbnailCache
+ */
+class MediaThumbnailImageProvider : public QQuickAsyncImageProvider
+{
+public:
+    QQuickImageResponse *requestImageResponse(const QString &id, const QSize &requestedSize) override;
+};
@@ -52,6 +52,9 @@ QVariant NotificationsModel::data(const QModelIndex &index, int role) const
     if (role == UriRole) {
         return Uri(m_notifications[row].roomId.toLatin1(), m_notifications[row].eventId.toLatin1()).toUrl();
     }
+    if (role == ReadRole) {
+        return m_notifications[row].read;
+    }
     return {};
 }
 
@@ -66,6 +69,7 @@ QHash<int, QByteArray> NotificationsModel::roleNames() const
         {EventIdRole, "eventId"},
         {RoomDisplayNameRole, "roomDisplayName"},
         {UriRole, "uri"},
+        {ReadRole, "read"},
     };
 }
 
@@ -76,72 +80,202 @@ NeoChatConnection *NotificationsModel::connection() const
 
 void NotificationsModel::setConnection(NeoChatConnection *connection)
 {
+    if (connection == m_connection) {
+        return;
+    }
     if (m_connection) {
-        // disconnect things...
+        m_connection->disconnect(this);
     }
-    if (!connection) {
-        return;
+    beginResetModel();
+    m_notifications.clear();
+    m_newestEventId.clear();
+    m_nextToken.clear();
+    if (m_newerJob) {
+        m_newerJob->abandon();
+    }
+    if (m_olderJob) {
+        m_olderJob->abandon();
     }
+    endResetModel();
+    Q_EMIT nextTokenChanged();
+    Q_EMIT loadingChanged();
+
     m_connection = connection;
     Q_EMIT connectionChanged();
-    connect(connection, &Connection::syncDone, this, [this]() {
-        loadData();
+    if (!connection) {
+        return;
+    }
+    connect(connection, &Connection::syncDone, this, [this] {
+        loadNewer();
     });
-    loadData();
+    loadNewer();
 }
 
-void NotificationsModel::loadData()
+void NotificationsModel::loadNewer(std::optional<int> limit)
 {
-    if (!m_connection) {
+    if (!m_connection || m_newerJob) {
         return;
     }
-    if (m_job || (!m_notifications.empty() && m_nextToken.isEmpty())) {
+    m_pendingNewer.clear();
+    m_pendingNewestEventId.clear();
+    requestNewer({}, limit, MaxNewerPages);
+    Q_EMIT loadingChanged();
+}
+
+void NotificationsModel::requestNewer(const QString &from, std::optional<int> limit, int pagesLeft)
+{
+    m_newerJob = m_connection->callApi<GetNotificationsJob>(from, limit);
+    connect(m_newerJob, &BaseJob::finished, this, [this, limit, pagesLeft]() {
+        auto job = m_newerJob;
+        m_newerJob = nullptr;
+        if (job->status() != BaseJob::Success) {
+            Q_EMIT loadingChanged();
+            return;
+        }
+
+        const auto initialLoad = m_newestEventId.isEmpty();
+        const auto nextToken = job->nextToken();
+        bool reachedKnown = false;
+        for (const auto &notification : job->notifications()) {
+            const auto eventId = notification.event->fullJson()["event_id"_L1].toString();
+            if (m_pendingNewestEventId.isEmpty()) {
+                m_pendingNewestEventId = eventId;
+            }
+            if (!initialLoad && eventId == m_newestEventId) {
+                reachedKnown = true;
+            }
+            // Everything from here on is already in the model, only the read state may have changed.
+            if (reachedKnown) {
+                updateReadState(eventId, notification.read);
+                continue;
+            }
+            if (auto newNotification = makeNotification(notification)) {
+                m_pendingNewer += *newNotification;
+            }
+        }
+
+        // More new notifications than fit on a page, continue on the next one.
+        if (!initialLoad && !reachedKnown && !nextToken.isEmpty() && pagesLeft > 1) {
+            requestNewer(nextToken, limit, pagesLeft - 1);
+            return;
+        }
+        Q_EMIT loadingChanged();
+
+        const auto newNotifications = std::exchange(m_pendingNewer, {});
+        const auto newestEventId = std::exchange(m_pendingNewestEventId, {});
+        if (newestEventId.isEmpty()) {
+            return;
+        }
+        m_newestEventId = newestEventId;
+
+        if (initialLoad || !reachedKnown) {
+            // Either the first page or the known notifications weren't reached within
+            // MaxNewerPages; in the latter case there would be a gap in the list, so start over.
+            beginResetModel();
+            m_notifications = newNotifications;
+            endResetModel();
+            m_nextToken = nextToken;
+            Q_EMIT nextTokenChanged();
+            return;
+        }
+        if (newNotifications.isEmpty()) {
+            return;
+        }
+        beginInsertRows({}, 0, newNotifications.size() - 1);
+        m_notifications = newNotifications + m_notifications;
+        endInsertRows();
+    });
+}
+
+void NotificationsModel::loadOlder(std::optional<int> limit)
+{
+    if (!m_connection || m_olderJob || m_nextToken.isEmpty()) {
         return;
     }
-    m_job = m_connection->callApi<GetNotificationsJob>(m_nextToken);
+    m_olderJob = m_connection->callApi<GetNotificationsJob>(m_nextToken, limit);
     Q_EMIT loadingChanged();
-    connect(m_job, &BaseJob::finished, this, [this]() {
-        m_nextToken = m_job->nextToken();
+    connect(m_olderJob, &BaseJob::finished, this, [this]() {
+        auto job = m_olderJob;
+        m_olderJob = nullptr;
+        Q_EMIT loadingChanged();
+        if (job->status() != BaseJob::Success) {
+            return;
+        }
+
+        m_nextToken = job->nextToken();
         Q_EMIT nextTokenChanged();
-        for (const auto &notification : m_job->notifications()) {
-            if (std::any_of(notification.actions.constBegin(), notification.actions.constEnd(), [](const QVariant &it) {
-                    if (it.canConvert<QVariantMap>()) {
-                        if (it.toMap()["set_tweak"_L1] == "highlight"_L1) {
-                            return true;
-                        }
-                    }
-                    return false;
+        QList<Notification> olderNotifications;
+        for (const auto &notification : job->notifications()) {
+            const auto eventId = notification.event->fullJson()["event_id"_L1].toString();
+            // Rows may have shifted onto this page if new notifications arrived in the meantime.
+            if (std::any_of(m_notifications.constBegin(), m_notifications.constEnd(), [&eventId](const Notification &it) {
+                    return it.eventId == eventId;
                 })) {
-                const auto &authorId = notification.event->fullJson()["sender"_L1].toString();
-                const auto &room = m_connection->room(notification.roomId);
-                if (!room) {
-                    continue;
-                }
-                auto u = room->member(authorId).avatarUrl();
-                auto avatar = u.isEmpty() ? QUrl() : connection()->makeMediaUrl(u);
-                const auto &authorAvatar = avatar.isValid() && avatar.scheme() == u"mxc"_s ? avatar : QUrl();
+                updateReadState(eventId, notification.read);
+                continue;
+            }
+            if (auto olderNotification = makeNotification(notification)) {
+                olderNotifications += *olderNotification;
+            }
+        }
+        if (olderNotifications.isEmpty()) {
+            return;
+        }
+        beginInsertRows({}, m_notifications.size(), m_notifications.size() + olderNotifications.size() - 1);
+        m_notifications += olderNotifications;
+        endInsertRows();
+    });
+}
 
-                const auto &roomEvent = eventCast<const RoomEvent>(notification.event.get());
-                if (!roomEvent) {
-                    continue;
+std::optional<NotificationsModel::Notification> NotificationsModel::makeNotification(const GetNotificationsJob::Notification &notification) const
+{
+    if (!std::any_of(notification.actions.constBegin(), notification.actions.constEnd(), [](const QVariant &it) {
+            if (it.canConvert<QVariantMap>()) {
+                if (it.toMap()["set_tweak"_L1] == "highlight"_L1) {
+                    return true;
                 }
-
-                beginInsertRows({}, m_notifications.length(), m_notifications.length());
-                m_notifications += Notification{
-                    .roomId = notification.roomId,
-                    .text = room->member(authorId).htmlSafeDisplayName() + (roomEvent->is<StateEvent>() ? u" "_s : u": "_s)
-                        + EventHandler::plainBody(dynamic_cast<NeoChatRoom *>(room), roomEvent, true),
-                    .authorName = room->member(authorId).htmlSafeDisplayName(),
-                    .authorAvatar = authorAvatar,
-                    .eventId = roomEvent->id(),
-                    .roomDisplayName = room->displayName(),
-                };
-                endInsertRows();
             }
-        }
-        m_job = nullptr;
-        Q_EMIT loadingChanged();
+            return false;
+        })) {
+        return std::nullopt;
+    }
+    const auto &authorId = notification.event->fullJson()["sender"_L1].toString();
+    const auto &room = m_connection->room(notification.roomId);
+    if (!room) {
+        return std::nullopt;
+    }
+    auto u = room->member(authorId).avatarUrl();
+    auto avatar = u.isEmpty() ? QUrl() : connection()->makeMediaUrl(u);
+    const auto &authorAvatar = avatar.isValid() && avatar.scheme() == u"mxc"_s ? avatar : QUrl();
+
+    const auto &roomEvent = eventCast<const RoomEvent>(notification.event.get());
+    if (!roomEvent) {
+        return std::nullopt;
+    }
+
+    return Notification{
+        .roomId = notification.roomId,
+        .text = room->member(authorId).htmlSafeDisplayName() + (roomEvent->is<StateEvent>() ? u" "_s : u": "_s)
+            + EventHandler::plainBody(dynamic_cast<NeoChatRoom *>(room), roomEvent, true),
+        .authorName = room->member(authorId).htmlSafeDisplayName(),
+        .authorAvatar = authorAvatar,
+        .eventId = roomEvent->id(),
+        .roomDisplayName = room->displayName(),
+        .read = notification.read,
+    };
+}
+
+void NotificationsModel::updateReadState(const QString &eventId, bool read)
+{
+    const auto it = std::find_if(m_notifications.begin(), m_notifications.end(), [&eventId](const Notification &notification) {
+        return notification.eventId == eventId;
     });
+    if (it == m_notifications.end() || it->read == read) {
+        return;
+    }
+    it->read = read;
+    const auto row = static_cast<int>(std::distance(m_notifications.begin(), it));
+    Q_EMIT dataChanged(index(row), index(row), {ReadRole});
 }
 
 bool NotificationsModel::canFetchMore(const QModelIndex &parent) const
@@ -153,12 +287,12 @@ bool NotificationsModel::canFetchMore(const QModelIndex &parent) const
 void NotificationsModel::fetchMore(const QModelIndex &parent)
 {
     Q_UNUSED(parent);
-    loadData();
+    loadOlder();
 }
 
 bool NotificationsModel::loading() const
 {
-    return m_job;
+    return m_newerJob || m_olderJob;
 }
 
 QString NotificationsModel::nextToken() const
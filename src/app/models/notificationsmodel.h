@@ -10,6 +10,16 @@
 #include <QVariant>
 #include <Quotient/csapi/notifications.h>
 
+/**
+ * @class NotificationsModel
+ *
+ * A model listing the highlight notifications of a connection, newest first.
+ *
+ * The model is loaded incrementally. After each sync only the notifications newer
+ * than the newest one already known are requested and prepended, while older
+ * notifications are paged in on demand via fetchMore(). Changes to the read state
+ * of already loaded notifications are applied as row updates.
+ */
 class NotificationsModel : public QAbstractListModel
 {
     Q_OBJECT
@@ -29,6 +39,7 @@ public:
         EventIdRole,
         RoomDisplayNameRole,
         UriRole,
+        ReadRole,
     };
     Q_ENUM(Roles);
 
@@ -39,6 +50,7 @@ public:
         QUrl authorAvatar;
         QString eventId;
         QString roomDisplayName;
+        bool read = false;
     };
 
     explicit NotificationsModel(QObject *parent = nullptr);
@@ -61,8 +73,38 @@ Q_SIGNALS:
 
 private:
     QPointer<NeoChatConnection> m_connection;
-    void loadData();
+
+    /**
+     * @brief The most pages loadNewer() requests before giving up on reaching the known notifications.
+     */
+    static constexpr int MaxNewerPages = 5;
+
+    /**
+     * @brief Request the notifications newer than the newest known one.
+     *
+     * Pages of at most @p limit notifications are requested until one contains the newest
+     * known notification, updating the read state of the known ones on the way. If the
+     * model is empty this loads the first page instead.
+     */
+    void loadNewer(std::optional<int> limit = std::nullopt);
+
+    /**
+     * @brief Request the next page of at most @p limit older notifications using m_nextToken.
+     */
+    void loadOlder(std::optional<int> limit = std::nullopt);
+
+    void requestNewer(const QString &from, std::optional<int> limit, int pagesLeft);
+
+    std::optional<Notification> makeNotification(const Quotient::GetNotificationsJob::Notification &notification) const;
+    void updateReadState(const QString &eventId, bool read);
+
     QList<Notification> m_notifications;
+    // The id of the newest event returned by the server, including the ones that are filtered out.
+    QString m_newestEventId;
     QString m_nextToken;
-    QPointer<Quotient::GetNotificationsJob> m_job;
+    // What loadNewer() found on the pages requested so far.
+    QList<Notification> m_pendingNewer;
+    QString m_pendingNewestEventId;
+    QPointer<Quotient::GetNotificationsJob> m_newerJob;
+    QPointer<Quotient::GetNotificationsJob> m_olderJob;
 };
@@ -49,6 +49,7 @@ Kirigami.ScrollablePage {
             required property string authorName
             required property string roomDisplayName
             required property string notificationText
+            required property bool read
 
             width: parent?.width ?? 0
 
@@ -89,7 +90,8 @@ Kirigami.ScrollablePage {
 
                         text: notificationDelegate.notificationText
                         elide: Text.ElideRight
-                        font: Kirigami.Theme.smallFont
+                        font.pointSize: Kirigami.Theme.smallFont.pointSize
+                        font.weight: notificationDelegate.read ? Font.Normal : Font.Bold
 
                         Layout.fillWidth: true
                         Layout.alignment: Qt.AlignLeft | Qt.AlignTop
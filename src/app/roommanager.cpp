@@ -96,6 +96,10 @@ RoomManager::RoomManager(QObject *parent)
     connect(NeoChatConfig::self(), &NeoChatConfig::TypingNotificationsChanged, this, [] {
         NeoChatRoom::setTypingNotificationsActive(NeoChatConfig::self()->typingNotifications());
     });
+    NeoChatRoom::setUploadImageMaxDimension(NeoChatConfig::self()->uploadImageMaxDimension());
+    connect(NeoChatConfig::self(), &NeoChatConfig::UploadImageMaxDimensionChanged, this, [] {
+        NeoChatRoom::setUploadImageMaxDimension(NeoChatConfig::self()->uploadImageMaxDimension());
+    });
     connect(m_sortFilterSpaceListModel, &SortFilterSpaceListModel::layoutChanged, m_sortFilterRoomTreeModel, &SortFilterRoomTreeModel::invalidate);
     connect(&ActionsModel::instance(), &ActionsModel::resolveResource, this, [this](const QString &idOrUri, const QString &action) {
         resolveResource(idOrUri, action);
@@ -139,6 +143,9 @@ RoomManager::RoomManager(QObject *parent)
     connect(NeoChatConfig::self(), &NeoChatConfig::SortOrderChanged, this, [this]() {
         m_sortFilterRoomTreeModel->invalidate();
     });
+    connect(NeoChatConfig::self(), &NeoChatConfig::CustomSortOrderChanged, this, [this]() {
+        m_sortFilterRoomTreeModel->invalidate();
+    });
     connect(NeoChatConfig::self(), &NeoChatConfig::CollapsedChanged, this, [this]() {
         m_sortFilterRoomTreeModel->invalidate();
     });
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "audiowaveform.h"
+
+#include <algorithm>
+#include <cmath>
+
+AudioWaveform::AudioWaveform(std::chrono::milliseconds binDuration)
+    : m_binDuration(binDuration)
+{
+}
+
+std::chrono::milliseconds AudioWaveform::binDuration() const
+{
+    return m_binDuration;
+}
+
+void AudioWaveform::reset()
+{
+    m_partialFrame.clear();
+    m_binFrames = 0;
+    m_binPeak = 0;
+    m_bins.clear();
+}
+
+void AudioWaveform::addData(const QByteArray &data, const QAudioFormat &format)
+{
+    const auto frameSize = format.bytesPerFrame();
+    if (!format.isValid() || frameSize <= 0) {
+        return;
+    }
+    const auto framesPerBin = std::max<qint64>(1, qint64(format.sampleRate()) * m_binDuration.count() / 1000);
+
+    const auto buffer = m_partialFrame.isEmpty() ? data : m_partialFrame + data;
+    const auto frames = buffer.size() / frameSize;
+    const auto *frame = buffer.constData();
+    for (qsizetype i = 0; i < frames; ++i, frame += frameSize) {
+        m_binPeak = std::max(m_binPeak, std::abs(format.normalizedSampleValue(frame)));
+        if (++m_binFrames == framesPerBin) {
+            m_bins += m_binPeak;
+            m_binFrames = 0;
+            m_binPeak = 0;
+        }
+    }
+    m_partialFrame = buffer.sliced(frames * frameSize);
+}
+
+QList<int> AudioWaveform::summary(int length) const
+{
+    auto bins = m_bins;
+    if (m_binFrames > 0) {
+        bins += m_binPeak;
+    }
+    if (bins.isEmpty() || length <= 0) {
+        return {};
+    }
+
+    const auto toValue = [](float peak) {
+        return std::clamp(int(std::lround(peak * maxValue)), 0, maxValue);
+    };
+
+    QList<int> values;
+    if (bins.size() <= length) {
+        values.reserve(bins.size());
+        for (const auto peak : std::as_const(bins)) {
+            values += toValue(peak);
+        }
+        return values;
+    }
+
+    values.reserve(length);
+    for (int i = 0; i < length; ++i) {
+        const auto begin = bins.cbegin() + qsizetype(i) * bins.size() / length;
+        const auto end = bins.cbegin() + qsizetype(i + 1) * bins.size() / length;
+        values += toValue(*std::max_element(begin, end));
+    }
+    return values;
+}
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QAudioFormat>
+#include <QByteArray>
+#include <QList>
+
+#include <chrono>
+
+/**
+ * @class AudioWaveform
+ *
+ * Builds the waveform of an audio recording while it is being recorded.
+ *
+ * Raw samples are reduced to the peak amplitude of each binDuration() as they are
+ * added, so the memory used only grows with the length of the recording, not with
+ * its sample rate. summary() turns those into the values used for the waveform of
+ * an org.matrix.msc1767.audio event.
+ */
+class AudioWaveform
+{
+public:
+    /**
+     * @brief The value of a full scale sample in summary().
+     */
+    static constexpr int maxValue = 1024;
+
+    /**
+     * @brief The default number of values in summary().
+     */
+    static constexpr int defaultLength = 100;
+
+    explicit AudioWaveform(std::chrono::milliseconds binDuration = std::chrono::milliseconds(100));
+
+    std::chrono::milliseconds binDuration() const;
+
+    /**
+     * @brief Forget all samples added so far.
+     */
+    void reset();
+
+    /**
+     * @brief Add raw audio @p data in @p format.
+     *
+     * Data doesn't have to end on a frame boundary, a partial frame is kept until the
+     * next call. Only the first channel is used.
+     */
+    void addData(const QByteArray &data, const QAudioFormat &format);
+
+    /**
+     * @brief The waveform as at most @p length values between 0 and maxValue.
+     */
+    QList<int> summary(int length = defaultLength) const;
+
+private:
+    std::chrono::milliseconds m_binDuration;
+    QByteArray m_partialFrame;
+    qint64 m_binFrames = 0;
+    float m_binPeak = 0;
+    QList<float> m_bins;
+};
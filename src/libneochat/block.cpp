@@ -141,9 +141,17 @@ CodeBlock::CodeBlock(Type type, const QTextDocumentFragment &content, const QStr
 {
 }
 
+CodeBlock::CodeBlock(Type type, const QTextDocumentFragment &content, const QString &language, bool highlighted, QObject *parent)
+    : TextBlock(type, content, {}, parent)
+    , m_language(language)
+    , m_highlighted(highlighted)
+{
+}
+
 CodeBlock::CodeBlock(CodeCacheItem *item, QObject *parent)
     : TextBlock(item, parent)
     , m_language(item->language)
+    , m_highlighted(item->highlighted)
 {
 }
 
@@ -152,9 +160,19 @@ QString CodeBlock::language() const
     return m_language;
 }
 
+bool CodeBlock::highlighted() const
+{
+    return m_highlighted;
+}
+
+void CodeBlock::appendFragment(const QTextDocumentFragment &fragment)
+{
+    item()->appendFragment(fragment);
+}
+
 CacheItemPtr CodeBlock::toCacheItem() const
 {
-    return std::make_unique<CodeCacheItem>(type(), item()->toFragment(), language());
+    return std::make_unique<CodeCacheItem>(type(), item()->toFragment(), language(), highlighted());
 }
 
 UrlBlock::UrlBlock(Type type, const QUrl &source, QObject *parent)
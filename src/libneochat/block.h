@@ -163,16 +163,34 @@ class CodeBlock : public TextBlock
      */
     Q_PROPERTY(QString language READ language CONSTANT)
 
+    /**
+     * @brief Whether the content already carries its syntax highlighting formats.
+     *
+     * When true the view shouldn't run its own highlighter over the text.
+     */
+    Q_PROPERTY(bool highlighted READ highlighted CONSTANT)
+
 public:
     CodeBlock(Type type, const QTextDocumentFragment &content, const QString &language, QObject *parent);
+    CodeBlock(Type type, const QTextDocumentFragment &content, const QString &language, bool highlighted, QObject *parent);
     CodeBlock(CodeCacheItem *item, QObject *parent);
 
     [[nodiscard]] QString language() const;
 
+    [[nodiscard]] bool highlighted() const;
+
+    /**
+     * @brief Append the given QTextDocumentFragment as new lines at the end of the code.
+     *
+     * Any formatting in the fragment is kept.
+     */
+    void appendFragment(const QTextDocumentFragment &fragment);
+
     [[nodiscard]] CacheItemPtr toCacheItem() const override;
 
 private:
     QString m_language;
+    bool m_highlighted = false;
 };
 
 /**
@@ -3,6 +3,8 @@
 
 #include "blockcache.h"
 
+#include <QDataStream>
+#include <QMimeDatabase>
 #include <QRegularExpression>
 #include <algorithm>
 #include <memory>
@@ -58,6 +60,213 @@ inline QString trimNewline(QString string)
     return string;
 }
 
+namespace
+{
+// Data written with another version is dropped.
+constexpr quint8 FormatVersion = 2;
+
+// The CacheItem class that was written, the type of the item doesn't tell.
+enum class ItemClass : quint8 {
+    Base,
+    BasicText,
+    Text,
+    Code,
+    Url,
+    File,
+    Image,
+    Video,
+    Audio,
+    Location,
+    Reply,
+};
+
+// UTF-8 is about half the size of the UTF-16 QDataStream uses for QString.
+void writeString(QDataStream &stream, const QString &string)
+{
+    stream << string.toUtf8();
+}
+
+QString readString(QDataStream &stream)
+{
+    QByteArray utf8;
+    stream >> utf8;
+    return QString::fromUtf8(utf8);
+}
+
+void writeUrl(QDataStream &stream, const QUrl &url)
+{
+    stream << url.toEncoded();
+}
+
+QUrl readUrl(QDataStream &stream)
+{
+    QByteArray encoded;
+    stream >> encoded;
+    return QUrl::fromEncoded(encoded);
+}
+
+void writeFileInfo(QDataStream &stream, const FileInfo &info)
+{
+    stream << info.size;
+    writeString(stream, info.mimeType.name());
+}
+
+void readFileInfo(QDataStream &stream, FileInfo &info)
+{
+    stream >> info.size;
+    info.mimeType = QMimeDatabase().mimeTypeForName(readString(stream));
+}
+
+void writeImageInfo(QDataStream &stream, const ImageInfo &info)
+{
+    writeFileInfo(stream, info);
+    stream << info.pixelSize << info.isAnimated << info.isSticker;
+}
+
+ImageInfo readImageInfo(QDataStream &stream)
+{
+    ImageInfo info;
+    readFileInfo(stream, info);
+    stream >> info.pixelSize >> info.isAnimated >> info.isSticker;
+    return info;
+}
+
+void writeItem(QDataStream &stream, const CacheItem *item)
+{
+    const auto writeHeader = [&stream, item](ItemClass itemClass) {
+        stream << quint8(itemClass) << qint32(item->type);
+    };
+
+    // Most derived classes first.
+    if (const auto codeItem = dynamic_cast<const CodeCacheItem *>(item)) {
+        writeHeader(ItemClass::Code);
+        writeString(stream, codeItem->content.toHtml());
+        writeString(stream, codeItem->language);
+        stream << codeItem->highlighted;
+    } else if (const auto textItem = dynamic_cast<const TextCacheItem *>(item)) {
+        writeHeader(ItemClass::Text);
+        writeString(stream, textItem->content.toHtml());
+        stream << textItem->hasSpoiler;
+    } else if (const auto basicTextItem = dynamic_cast<const BasicTextCacheItem *>(item)) {
+        writeHeader(ItemClass::BasicText);
+        writeString(stream, basicTextItem->display);
+    } else if (const auto fileItem = dynamic_cast<const FileCacheItem *>(item)) {
+        writeHeader(ItemClass::File);
+        writeUrl(stream, fileItem->source);
+        writeString(stream, fileItem->filename);
+        writeFileInfo(stream, fileItem->info);
+    } else if (const auto imageItem = dynamic_cast<const ImageCacheItem *>(item)) {
+        writeHeader(ItemClass::Image);
+        writeUrl(stream, imageItem->source);
+        writeString(stream, imageItem->filename);
+        writeImageInfo(stream, imageItem->info);
+        writeUrl(stream, imageItem->thumbnailSource);
+        writeImageInfo(stream, imageItem->thumbnailInfo);
+        stream << imageItem->optimize;
+    } else if (const auto videoItem = dynamic_cast<const VideoCacheItem *>(item)) {
+        writeHeader(ItemClass::Video);
+        writeUrl(stream, videoItem->source);
+        writeString(stream, videoItem->filename);
+        writeFileInfo(stream, videoItem->info);
+        stream << videoItem->info.pixelSize << videoItem->info.duration;
+        writeUrl(stream, videoItem->thumbnailSource);
+        writeImageInfo(stream, videoItem->thumbnailInfo);
+    } else if (const auto audioItem = dynamic_cast<const AudioCacheItem *>(item)) {
+        writeHeader(ItemClass::Audio);
+        writeUrl(stream, audioItem->source);
+        writeString(stream, audioItem->filename);
+        writeFileInfo(stream, audioItem->info);
+        stream << audioItem->info.duration;
+    } else if (const auto urlItem = dynamic_cast<const UrlCacheItem *>(item)) {
+        writeHeader(ItemClass::Url);
+        writeUrl(stream, urlItem->source);
+    } else if (const auto locationItem = dynamic_cast<const LocationCacheItem *>(item)) {
+        writeHeader(ItemClass::Location);
+        stream << double(locationItem->latitude) << double(locationItem->longitude);
+        writeString(stream, locationItem->asset);
+    } else if (const auto replyItem = dynamic_cast<const ReplyCacheItem *>(item)) {
+        writeHeader(ItemClass::Reply);
+        writeString(stream, replyItem->id);
+    } else {
+        writeHeader(ItemClass::Base);
+    }
+}
+
+CacheItemPtr readItem(QDataStream &stream)
+{
+    quint8 itemClass = 0;
+    qint32 rawType = 0;
+    stream >> itemClass >> rawType;
+    const auto type = static_cast<Type>(rawType);
+
+    switch (static_cast<ItemClass>(itemClass)) {
+    case ItemClass::Base:
+        return std::make_unique<CacheItem>(type);
+    case ItemClass::BasicText:
+        return std::make_unique<BasicTextCacheItem>(type, readString(stream));
+    case ItemClass::Text: {
+        const auto html = readString(stream);
+        bool hasSpoiler = false;
+        stream >> hasSpoiler;
+        return std::make_unique<TextCacheItem>(type, QTextDocumentFragment::fromHtml(html), hasSpoiler);
+    }
+    case ItemClass::Code: {
+        const auto html = readString(stream);
+        const auto language = readString(stream);
+        bool highlighted = false;
+        stream >> highlighted;
+        return std::make_unique<CodeCacheItem>(type, QTextDocumentFragment::fromHtml(html), language, highlighted);
+    }
+    case ItemClass::Url:
+        return std::make_unique<UrlCacheItem>(type, readUrl(stream));
+    case ItemClass::File: {
+        const auto source = readUrl(stream);
+        const auto filename = readString(stream);
+        FileInfo info;
+        readFileInfo(stream, info);
+        return std::make_unique<FileCacheItem>(type, source, filename, info);
+    }
+    case ItemClass::Image: {
+        const auto source = readUrl(stream);
+        const auto filename = readString(stream);
+        const auto info = readImageInfo(stream);
+        const auto thumbnailSource = readUrl(stream);
+        const auto thumbnailInfo = readImageInfo(stream);
+        bool optimize = true;
+        stream >> optimize;
+        return std::make_unique<ImageCacheItem>(type, source, filename, info, thumbnailSource, thumbnailInfo, optimize);
+    }
+    case ItemClass::Video: {
+        const auto source = readUrl(stream);
+        const auto filename = readString(stream);
+        VideoInfo info;
+        readFileInfo(stream, info);
+        stream >> info.pixelSize >> info.duration;
+        const auto thumbnailSource = readUrl(stream);
+        const auto thumbnailInfo = readImageInfo(stream);
+        return std::make_unique<VideoCacheItem>(type, source, filename, info, thumbnailSource, thumbnailInfo);
+    }
+    case ItemClass::Audio: {
+        const auto source = readUrl(stream);
+        const auto filename = readString(stream);
+        AudioInfo info;
+        readFileInfo(stream, info);
+        stream >> info.duration;
+        return std::make_unique<AudioCacheItem>(type, source, filename, info);
+    }
+    case ItemClass::Location: {
+        double latitude = 0;
+        double longitude = 0;
+        stream >> latitude >> longitude;
+        return std::make_unique<LocationCacheItem>(type, latitude, longitude, readString(stream));
+    }
+    case ItemClass::Reply:
+        return std::make_unique<ReplyCacheItem>(type, readString(stream));
+    }
+    return nullptr;
+}
+}
+
 bool CacheItem::richTextActive = true;
 
 CacheItem::CacheItem(Type type)
@@ -135,9 +344,10 @@ QString TextCacheItem::toString() const
     return type == Quote ? formatQuote(textOut) : textOut;
 }
 
-CodeCacheItem::CodeCacheItem(Type type, const QTextDocumentFragment &content, const QString &language)
+CodeCacheItem::CodeCacheItem(Type type, const QTextDocumentFragment &content, const QString &language, bool highlighted)
     : TextCacheItem(type, content)
     , language(language)
+    , highlighted(highlighted)
 {
 }
 
@@ -271,21 +481,25 @@ bool Cache::hasType(const QList<Type> &types) const
 void Cache::prepend(CacheItemPtr item)
 {
     m_items.insert(m_items.begin(), std::move(item));
+    Q_EMIT changed();
 }
 
 void Cache::append(CacheItemPtr item)
 {
     m_items.push_back(std::move(item));
+    Q_EMIT changed();
 }
 
 void Cache::removeAt(qsizetype i)
 {
     m_items.erase(m_items.begin() + i);
+    Q_EMIT changed();
 }
 
 void Cache::clear()
 {
     m_items.clear();
+    Q_EMIT changed();
 }
 
 QString Cache::toString() const
@@ -318,4 +532,90 @@ QString Cache::toString() const
     return text;
 }
 
+qsizetype Cache::focusRow() const
+{
+    return m_focusRow;
+}
+
+int Cache::cursorPosition() const
+{
+    return m_cursorPosition;
+}
+
+void Cache::setCursor(qsizetype focusRow, int cursorPosition)
+{
+    if (focusRow == m_focusRow && cursorPosition == m_cursorPosition) {
+        return;
+    }
+    m_focusRow = focusRow;
+    m_cursorPosition = cursorPosition;
+    Q_EMIT changed();
+}
+
+QString Cache::eventId() const
+{
+    return m_eventId;
+}
+
+void Cache::setEventId(const QString &eventId)
+{
+    if (eventId == m_eventId) {
+        return;
+    }
+    m_eventId = eventId;
+    Q_EMIT changed();
+}
+
+QByteArray Cache::serialize() const
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    stream << FormatVersion << qint64(m_focusRow) << qint32(m_cursorPosition);
+    writeString(stream, m_eventId);
+    stream << quint32(m_items.size());
+    for (const auto &item : m_items) {
+        writeItem(stream, item.get());
+    }
+    return data;
+}
+
+bool Cache::deserialize(const QByteArray &data)
+{
+    m_items.clear();
+    m_focusRow = -1;
+    m_cursorPosition = -1;
+    m_eventId.clear();
+
+    QDataStream stream(data);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    quint8 version = 0;
+    qint64 focusRow = -1;
+    qint32 cursorPosition = -1;
+    quint32 count = 0;
+    stream >> version >> focusRow >> cursorPosition;
+    const auto eventId = readString(stream);
+    stream >> count;
+
+    bool valid = version == FormatVersion && stream.status() == QDataStream::Ok;
+    CacheItems items;
+    // Don't trust count to reserve anything, the data may be truncated.
+    for (quint32 i = 0; valid && i < count; ++i) {
+        auto item = readItem(stream);
+        valid = item && stream.status() == QDataStream::Ok;
+        items.push_back(std::move(item));
+    }
+
+    if (valid) {
+        m_items = std::move(items);
+        m_focusRow = focusRow;
+        m_cursorPosition = cursorPosition;
+        m_eventId = eventId;
+    }
+    Q_EMIT changed();
+    return valid;
+}
+
 #include "moc_blockcache.cpp"
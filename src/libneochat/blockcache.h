@@ -80,9 +80,13 @@ public:
 class CodeCacheItem : public TextCacheItem
 {
 public:
-    CodeCacheItem(Type type, const QTextDocumentFragment &content, const QString &language = {});
+    CodeCacheItem(Type type, const QTextDocumentFragment &content, const QString &language = {}, bool highlighted = false);
 
     QString language;
+    /**
+     * @brief Whether the content already carries its syntax highlighting, see CodeBlock::highlighted().
+     */
+    bool highlighted;
 
     QString toString() const override;
 };
@@ -320,7 +324,56 @@ public:
      */
     QString toString() const;
 
+    /**
+     * @brief The row of the item that had focus, -1 if unknown.
+     */
+    qsizetype focusRow() const;
+
+    /**
+     * @brief The cursor position in the item that had focus, -1 if unknown.
+     */
+    int cursorPosition() const;
+
+    /**
+     * @brief Set where the cursor was when the contents were cached.
+     */
+    void setCursor(qsizetype focusRow, int cursorPosition);
+
+    /**
+     * @brief The event the contents belong to, e.g. the event being edited.
+     *
+     * Unlike the items this isn't reset by clear().
+     */
+    QString eventId() const;
+    void setEventId(const QString &eventId);
+
+    /**
+     * @brief Return the items and metadata of the Cache in a compact binary format.
+     *
+     * Text items are stored as the HTML of their fragment so they can be written
+     * without laying them out in a QTextDocument.
+     *
+     * @sa deserialize()
+     */
+    QByteArray serialize() const;
+
+    /**
+     * @brief Replace the contents of the Cache with data from serialize().
+     *
+     * Returns false and leaves the Cache empty if the data is invalid.
+     */
+    bool deserialize(const QByteArray &data);
+
+Q_SIGNALS:
+    /**
+     * @brief The items or metadata of the Cache changed.
+     */
+    void changed();
+
 private:
     CacheItems m_items;
+    qsizetype m_focusRow = -1;
+    int m_cursorPosition = -1;
+    QString m_eventId;
 };
 }
@@ -0,0 +1,352 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: MIT
+
+#include "blurhash.h"
+
+#include <QtGui/QColorSpace>
+
+#include <array>
+#include <numbers>
+
+// From https://github.com/woltapp/blurhash/blob/master/Algorithm.md#base-83
+const static QString b83Characters{QStringLiteral("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz#$%*+,-.:;=?@[]^_{|}~")};
+
+// Images are scaled down to fit this before encoding, a handful of components can't carry more detail anyway.
+constexpr int maxEncodeDimension = 64;
+
+using namespace Quotient;
+using Components = std::pair<int, int>;
+
+std::optional<int> decode83(const QString &encodedString)
+{
+    int temp = 0;
+    for (const QChar c : encodedString) {
+        const auto index = b83Characters.indexOf(c);
+        if (index == -1)
+            return std::nullopt;
+
+        temp = temp * 83 + static_cast<int>(index);
+    }
+
+    return temp;
+}
+
+QString encode83(int value)
+{
+    QString buffer;
+
+    do {
+        buffer += b83Characters[value % 83];
+    } while ((value = value / 83));
+
+    std::ranges::reverse(buffer);
+
+    return buffer;
+}
+
+Components unpackComponents(const int packedComponents)
+{
+    return {packedComponents % 9 + 1, packedComponents / 9 + 1};
+}
+
+int packComponents(const Components &components)
+{
+    const auto [componentX, componentY] = components;
+    return (componentX - 1) + (componentY - 1) * 9;
+}
+
+float decodeMaxAC(const int value)
+{
+    return static_cast<float>(value + 1) / 166.f;
+}
+
+int encodeMaxAC(const float value)
+{
+    return std::clamp(static_cast<int>(value * 166 - 0.5f), 0, 82);
+}
+
+int encodeAverageColor(const int red, const int green, const int blue)
+{
+    return (red << 16) + (green << 8) + blue;
+}
+
+float signPow(const float value, const float exp)
+{
+    return std::copysign(std::pow(std::abs(value), exp), value);
+}
+
+// Writes the linear RGB values of the AC component to color.
+void decodeAC(const int value, const float maxAC, float *color)
+{
+    const auto quantR = value / (19 * 19);
+    const auto quantG = (value / 19) % 19;
+    const auto quantB = value % 19;
+
+    color[0] = signPow((static_cast<float>(quantR) - 9) / 9, 2) * maxAC;
+    color[1] = signPow((static_cast<float>(quantG) - 9) / 9, 2) * maxAC;
+    color[2] = signPow((static_cast<float>(quantB) - 9) / 9, 2) * maxAC;
+}
+
+int encodeAC(const float *color, const float maxAC)
+{
+    const auto quantR = static_cast<int>(std::max(0.f, std::min(18.f, std::floor(signPow(color[0] / maxAC, 0.5) * 9 + 9.5f))));
+    const auto quantG = static_cast<int>(std::max(0.f, std::min(18.f, std::floor(signPow(color[1] / maxAC, 0.5) * 9 + 9.5f))));
+    const auto quantB = static_cast<int>(std::max(0.f, std::min(18.f, std::floor(signPow(color[2] / maxAC, 0.5) * 9 + 9.5f))));
+
+    return quantR * 19 * 19 + quantG * 19 + quantB;
+}
+
+// The cosine basis for each component, stored component after component so that the
+// pixel loops can run over contiguous memory.
+QList<float> calculateComponentBases(const int dimension, const int components)
+{
+    QList<float> bases(static_cast<qsizetype>(dimension) * components);
+
+    const auto scale = static_cast<float>(std::numbers::pi) / static_cast<float>(dimension);
+    for (int n = 0; n < components; n++) {
+        for (int i = 0; i < dimension; i++) {
+            bases[n * dimension + i] = std::cos(scale * static_cast<float>(n * i));
+        }
+    }
+    return bases;
+}
+
+float srgbToLinear(const int value)
+{
+    const auto v = static_cast<float>(value) / 255.f;
+    return v <= 0.04045f ? v / 12.92f : std::pow((v + 0.055f) / 1.055f, 2.4f);
+}
+
+const std::array<float, 256> &srgbToLinearTable()
+{
+    static const auto table = [] {
+        std::array<float, 256> table;
+        for (int i = 0; i < 256; i++) {
+            table[i] = srgbToLinear(i);
+        }
+        return table;
+    }();
+    return table;
+}
+
+constexpr int linearToSrgbTableSize = 1 << 14;
+
+const std::array<uchar, linearToSrgbTableSize> &linearToSrgbTable()
+{
+    static const auto table = [] {
+        std::array<uchar, linearToSrgbTableSize> table;
+        for (int i = 0; i < linearToSrgbTableSize; i++) {
+            const auto v = static_cast<float>(i) / (linearToSrgbTableSize - 1);
+            const auto srgb = v <= 0.0031308f ? v * 12.92f : 1.055f * std::pow(v, 1 / 2.4f) - 0.055f;
+            table[i] = static_cast<uchar>(std::clamp(static_cast<int>(srgb * 255 + 0.5f), 0, 255));
+        }
+        return table;
+    }();
+    return table;
+}
+
+uchar linearToSrgb(const float value)
+{
+    return linearToSrgbTable()[static_cast<int>(std::clamp(value, 0.f, 1.f) * (linearToSrgbTableSize - 1) + 0.5f)];
+}
+
+QImage BlurHash::decode(const QString &blurhash, const QSize &size)
+{
+    // 10 is the minimum length of a blurhash string
+    if (blurhash.length() < 10)
+        return {};
+
+    // First character is the number of components
+    const auto components83 = decode83(blurhash.first(1));
+    if (!components83.has_value())
+        return {};
+
+    const auto [componentX, componentY] = unpackComponents(*components83);
+    const auto minimumSize = 1 + 1 + 4 + (componentX * componentY - 1) * 2;
+    if (componentX < 1 || componentY < 1 || blurhash.size() != minimumSize)
+        return {};
+
+    // Second character is the maximum AC component value
+    const auto maxAC83 = decode83(blurhash.mid(1, 1));
+    if (!maxAC83.has_value())
+        return {};
+
+    const auto maxAC = decodeMaxAC(*maxAC83);
+
+    // Third character onward is the average color of the image
+    const auto averageColor83 = decode83(blurhash.mid(2, 4));
+    if (!averageColor83.has_value())
+        return {};
+
+    // Linear RGB values of all components, the first one is the average color.
+    QList<float> colors(componentX * componentY * 3);
+    colors[0] = srgbToLinear(*averageColor83 >> 16);
+    colors[1] = srgbToLinear((*averageColor83 >> 8) & 255);
+    colors[2] = srgbToLinear(*averageColor83 & 255);
+
+    // Iterate through the rest of the string for the color values
+    // Each AC component is two characters each
+    for (qsizetype c = 6, i = 3; c < blurhash.size(); c += 2, i += 3) {
+        const auto acComponent83 = decode83(blurhash.mid(c, 2));
+        if (!acComponent83.has_value())
+            return {};
+
+        decodeAC(*acComponent83, maxAC, &colors[i]);
+    }
+
+    QImage image(size, QImage::Format_RGB888);
+    if (image.isNull())
+        return {};
+    image.setColorSpace(QColorSpace::SRgb);
+
+    const auto width = size.width();
+    const auto height = size.height();
+    const auto basesX = calculateComponentBases(width, componentX);
+    const auto basesY = calculateComponentBases(height, componentY);
+
+    QList<float> rowColors(componentX * 3);
+    QList<float> lineR(width);
+    QList<float> lineG(width);
+    QList<float> lineB(width);
+
+    for (int y = 0; y < height; y++) {
+        // All pixels in a row share the vertical basis, so collapse the components to one color per column component first.
+        std::fill(rowColors.begin(), rowColors.end(), 0.f);
+        for (int ny = 0; ny < componentY; ny++) {
+            const auto basis = basesY[ny * height + y];
+            for (int nx = 0; nx < componentX; nx++) {
+                const auto color = &colors[(nx + ny * componentX) * 3];
+                rowColors[nx * 3] += color[0] * basis;
+                rowColors[nx * 3 + 1] += color[1] * basis;
+                rowColors[nx * 3 + 2] += color[2] * basis;
+            }
+        }
+
+        std::fill(lineR.begin(), lineR.end(), 0.f);
+        std::fill(lineG.begin(), lineG.end(), 0.f);
+        std::fill(lineB.begin(), lineB.end(), 0.f);
+        float *const r = lineR.data();
+        float *const g = lineG.data();
+        float *const b = lineB.data();
+        for (int nx = 0; nx < componentX; nx++) {
+            const float colorR = rowColors[nx * 3];
+            const float colorG = rowColors[nx * 3 + 1];
+            const float colorB = rowColors[nx * 3 + 2];
+            const float *const basis = basesX.constData() + nx * width;
+            // Contiguous and branch free, so that the compiler can vectorize it.
+            for (int x = 0; x < width; x++) {
+                r[x] += colorR * basis[x];
+                g[x] += colorG * basis[x];
+                b[x] += colorB * basis[x];
+            }
+        }
+
+        auto scanLine = image.scanLine(y);
+        for (int x = 0; x < width; x++) {
+            scanLine[x * 3] = linearToSrgb(r[x]);
+            scanLine[x * 3 + 1] = linearToSrgb(g[x]);
+            scanLine[x * 3 + 2] = linearToSrgb(b[x]);
+        }
+    }
+
+    return image;
+}
+
+QString BlurHash::encode(const QImage &image, const int componentsX, const int componentsY)
+{
+    Q_ASSERT(componentsX >= 1 && componentsX <= 9);
+    Q_ASSERT(componentsY >= 1 && componentsY <= 9);
+
+    if (image.isNull())
+        return {};
+
+    // Scaling down averages the pixels anyway, which is all the low frequency components need.
+    QImage working = image;
+    if (working.width() > maxEncodeDimension || working.height() > maxEncodeDimension) {
+        working = working.scaled(maxEncodeDimension, maxEncodeDimension, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    }
+    working = working.convertToFormat(QImage::Format_RGB888);
+    if (working.isNull())
+        return {};
+
+    const auto width = working.width();
+    const auto height = working.height();
+    const auto basesX = calculateComponentBases(width, componentsX);
+    const auto basesY = calculateComponentBases(height, componentsY);
+    const auto &toLinear = srgbToLinearTable();
+
+    QList<float> factors(componentsX * componentsY * 3, 0.f);
+    QList<float> rowFactors(componentsX * 3);
+    QList<float> lineR(width);
+    QList<float> lineG(width);
+    QList<float> lineB(width);
+
+    for (int y = 0; y < height; y++) {
+        const auto scanLine = working.constScanLine(y);
+        for (int x = 0; x < width; x++) {
+            lineR[x] = toLinear[scanLine[x * 3]];
+            lineG[x] = toLinear[scanLine[x * 3 + 1]];
+            lineB[x] = toLinear[scanLine[x * 3 + 2]];
+        }
+
+        // Project the row onto the horizontal components, then spread that over the vertical ones.
+        const float *const r = lineR.constData();
+        const float *const g = lineG.constData();
+        const float *const b = lineB.constData();
+        for (int nx = 0; nx < componentsX; nx++) {
+            const float *const basis = basesX.constData() + nx * width;
+            float sumR = 0.f;
+            float sumG = 0.f;
+            float sumB = 0.f;
+            for (int x = 0; x < width; x++) {
+                sumR += r[x] * basis[x];
+                sumG += g[x] * basis[x];
+                sumB += b[x] * basis[x];
+            }
+            rowFactors[nx * 3] = sumR;
+            rowFactors[nx * 3 + 1] = sumG;
+            rowFactors[nx * 3 + 2] = sumB;
+        }
+
+        for (int ny = 0; ny < componentsY; ny++) {
+            const auto basis = basesY[ny * height + y];
+            for (int nx = 0; nx < componentsX; nx++) {
+                const auto factor = &factors[(ny * componentsX + nx) * 3];
+                factor[0] += rowFactors[nx * 3] * basis;
+                factor[1] += rowFactors[nx * 3 + 1] * basis;
+                factor[2] += rowFactors[nx * 3 + 2] * basis;
+            }
+        }
+    }
+
+    for (qsizetype i = 0; i < factors.size(); i++) {
+        const float normalisation = (i < 3) ? 1 : 2;
+        factors[i] *= normalisation / static_cast<float>(width * height);
+    }
+
+    QString encodedString;
+    encodedString.append(encode83(packComponents(Components(componentsX, componentsY))).rightJustified(1, QLatin1Char('0')));
+
+    float maximumValue;
+    if (factors.size() > 3) {
+        float actualMaximumValue = 0;
+        for (qsizetype i = 3; i < factors.size(); i++) {
+            actualMaximumValue = std::max(std::abs(factors[i]), actualMaximumValue);
+        }
+
+        int quantisedMaximumValue = encodeMaxAC(actualMaximumValue);
+        maximumValue = (static_cast<float>(quantisedMaximumValue) + 1) / 166;
+        encodedString.append(encode83(quantisedMaximumValue).leftJustified(1, QLatin1Char('0')));
+    } else {
+        maximumValue = 1;
+        encodedString.append(encode83(0).leftJustified(1, QLatin1Char('0')));
+    }
+
+    encodedString.append(
+        encode83(encodeAverageColor(linearToSrgb(factors[0]), linearToSrgb(factors[1]), linearToSrgb(factors[2]))).rightJustified(4, QLatin1Char('0')));
+
+    for (qsizetype i = 3; i < factors.size(); i += 3)
+        encodedString.append(encode83(encodeAC(&factors[i], maximumValue)).rightJustified(2, QLatin1Char('0')));
+
+    return encodedString;
+}
@@ -18,6 +18,10 @@ namespace BlurHash
 QImage decode(const QString &blurhash, const QSize &size);
 
 /** Encodes the @p image and returns a blurhash string.
+ *
+ * Large images are scaled down before encoding, so this is cheap enough for full
+ * resolution photos. It is still best called off the GUI thread.
+ *
  * @param image A non-null image.
  * @param componentsX the number of components X-wise. Must be between 1 and 9.
  * @param componentsY the number of components Y-wise. Must be between 1 and 9.
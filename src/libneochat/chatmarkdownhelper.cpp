@@ -3,138 +3,14 @@
 
 #include "chatmarkdownhelper.h"
 
+#include <QTextBlock>
 #include <QTextCursor>
 #include <QTextDocument>
-#include <qtextcursor.h>
 
 #include "chattextitemhelper.h"
+#include "markdownsyntaxtrie.h"
 #include "richformat.h"
 
-namespace
-{
-struct MarkdownSyntax {
-    QLatin1String sequence;
-    bool closable = false;
-    bool lineStart = false;
-    RichFormat::Format format;
-};
-
-const QList<MarkdownSyntax> syntax = {
-    MarkdownSyntax{.sequence = "*"_L1, .closable = true, .format = RichFormat::Italic},
-    MarkdownSyntax{.sequence = "**"_L1, .closable = true, .format = RichFormat::Bold},
-    MarkdownSyntax{.sequence = "# "_L1, .lineStart = true, .format = RichFormat::Heading1},
-    MarkdownSyntax{.sequence = " # "_L1, .lineStart = true, .format = RichFormat::Heading1},
-    MarkdownSyntax{.sequence = "  # "_L1, .lineStart = true, .format = RichFormat::Heading1},
-    MarkdownSyntax{.sequence = "   # "_L1, .lineStart = true, .format = RichFormat::Heading1},
-    MarkdownSyntax{.sequence = "## "_L1, .lineStart = true, .format = RichFormat::Heading2},
-    MarkdownSyntax{.sequence = " ## "_L1, .lineStart = true, .format = RichFormat::Heading2},
-    MarkdownSyntax{.sequence = "  ## "_L1, .lineStart = true, .format = RichFormat::Heading2},
-    MarkdownSyntax{.sequence = "   ## "_L1, .lineStart = true, .format = RichFormat::Heading2},
-    MarkdownSyntax{.sequence = "### "_L1, .lineStart = true, .format = RichFormat::Heading3},
-    MarkdownSyntax{.sequence = " ### "_L1, .lineStart = true, .format = RichFormat::Heading3},
-    MarkdownSyntax{.sequence = "  ### "_L1, .lineStart = true, .format = RichFormat::Heading3},
-    MarkdownSyntax{.sequence = "   ### "_L1, .lineStart = true, .format = RichFormat::Heading3},
-    MarkdownSyntax{.sequence = "#### "_L1, .lineStart = true, .format = RichFormat::Heading4},
-    MarkdownSyntax{.sequence = " #### "_L1, .lineStart = true, .format = RichFormat::Heading4},
-    MarkdownSyntax{.sequence = "  #### "_L1, .lineStart = true, .format = RichFormat::Heading4},
-    MarkdownSyntax{.sequence = "   #### "_L1, .lineStart = true, .format = RichFormat::Heading4},
-    MarkdownSyntax{.sequence = "##### "_L1, .lineStart = true, .format = RichFormat::Heading5},
-    MarkdownSyntax{.sequence = " ##### "_L1, .lineStart = true, .format = RichFormat::Heading5},
-    MarkdownSyntax{.sequence = "  ##### "_L1, .lineStart = true, .format = RichFormat::Heading5},
-    MarkdownSyntax{.sequence = "   ##### "_L1, .lineStart = true, .format = RichFormat::Heading5},
-    MarkdownSyntax{.sequence = "###### "_L1, .lineStart = true, .format = RichFormat::Heading6},
-    MarkdownSyntax{.sequence = " ###### "_L1, .lineStart = true, .format = RichFormat::Heading6},
-    MarkdownSyntax{.sequence = "  ###### "_L1, .lineStart = true, .format = RichFormat::Heading6},
-    MarkdownSyntax{.sequence = "   ###### "_L1, .lineStart = true, .format = RichFormat::Heading6},
-    MarkdownSyntax{.sequence = ">"_L1, .lineStart = true, .format = RichFormat::Quote},
-    MarkdownSyntax{.sequence = " >"_L1, .lineStart = true, .format = RichFormat::Quote},
-    MarkdownSyntax{.sequence = "  >"_L1, .lineStart = true, .format = RichFormat::Quote},
-    MarkdownSyntax{.sequence = "   >"_L1, .lineStart = true, .format = RichFormat::Quote},
-    MarkdownSyntax{.sequence = "> "_L1, .lineStart = true, .format = RichFormat::Quote},
-    MarkdownSyntax{.sequence = " > "_L1, .lineStart = true, .format = RichFormat::Quote},
-    MarkdownSyntax{.sequence = "  > "_L1, .lineStart = true, .format = RichFormat::Quote},
-    MarkdownSyntax{.sequence = "   > "_L1, .lineStart = true, .format = RichFormat::Quote},
-    MarkdownSyntax{.sequence = "* "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
-    MarkdownSyntax{.sequence = " * "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
-    MarkdownSyntax{.sequence = "  * "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
-    MarkdownSyntax{.sequence = "   * "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
-    MarkdownSyntax{.sequence = "- "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
-    MarkdownSyntax{.sequence = " - "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
-    MarkdownSyntax{.sequence = "  - "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
-    MarkdownSyntax{.sequence = "   - "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
-    MarkdownSyntax{.sequence = "1. "_L1, .lineStart = true, .format = RichFormat::OrderedList},
-    MarkdownSyntax{.sequence = " 1. "_L1, .lineStart = true, .format = RichFormat::OrderedList},
-    MarkdownSyntax{.sequence = "  1. "_L1, .lineStart = true, .format = RichFormat::OrderedList},
-    MarkdownSyntax{.sequence = "   1. "_L1, .lineStart = true, .format = RichFormat::OrderedList},
-    MarkdownSyntax{.sequence = "1) "_L1, .lineStart = true, .format = RichFormat::OrderedList},
-    MarkdownSyntax{.sequence = " 1) "_L1, .lineStart = true, .format = RichFormat::OrderedList},
-    MarkdownSyntax{.sequence = "  1) "_L1, .lineStart = true, .format = RichFormat::OrderedList},
-    MarkdownSyntax{.sequence = "   1) "_L1, .lineStart = true, .format = RichFormat::OrderedList},
-    MarkdownSyntax{.sequence = "`"_L1, .closable = true, .format = RichFormat::InlineCode},
-    MarkdownSyntax{.sequence = "```"_L1, .lineStart = true, .format = RichFormat::Code},
-    MarkdownSyntax{.sequence = " ```"_L1, .lineStart = true, .format = RichFormat::Code},
-    MarkdownSyntax{.sequence = "  ```"_L1, .lineStart = true, .format = RichFormat::Code},
-    MarkdownSyntax{.sequence = "   ```"_L1, .lineStart = true, .format = RichFormat::Code},
-    MarkdownSyntax{.sequence = "~~"_L1, .closable = true, .format = RichFormat::Strikethrough},
-    MarkdownSyntax{.sequence = "_"_L1, .closable = true, .format = RichFormat::Underline},
-};
-
-std::optional<bool> checkSequence(const QString &currentString, const QString &nextChar, bool lineStart = false)
-{
-    QList<MarkdownSyntax> partialMatches;
-    std::optional<MarkdownSyntax> fullMatch = std::nullopt;
-    auto it = syntax.cbegin();
-    while ((it = std::find_if(it,
-                              syntax.cend(),
-                              [currentString, nextChar](const MarkdownSyntax &syntax) {
-                                  return syntax.sequence == currentString || syntax.sequence.startsWith(QString(currentString + nextChar));
-                              }))
-           != syntax.cend()) {
-        if (it->lineStart ? lineStart : true) {
-            if (it->sequence == currentString) {
-                fullMatch = *it;
-            } else {
-                partialMatches += *it;
-            }
-        }
-        ++it;
-    }
-
-    if (partialMatches.length() > 0) {
-        return false;
-    }
-    if (fullMatch) {
-        return true;
-    }
-    return std::nullopt;
-}
-
-bool checkSequenceBackwards(const QString &currentString)
-{
-    auto it = syntax.cbegin();
-    while ((it = std::find_if(it,
-                              syntax.cend(),
-                              [currentString](const MarkdownSyntax &syntax) {
-                                  return syntax.sequence.endsWith(currentString);
-                              }))
-           != syntax.cend()) {
-        return true;
-    }
-    return false;
-}
-
-std::optional<MarkdownSyntax> syntaxForSequence(const QString &sequence)
-{
-    const auto it = std::find_if(syntax.cbegin(), syntax.cend(), [sequence](const MarkdownSyntax &syntax) {
-        return syntax.sequence == sequence;
-    });
-    if (it == syntax.cend()) {
-        return std::nullopt;
-    }
-    return *it;
-}
-}
-
 bool ChatMarkdownHelper::richTextActive = true;
 
 ChatMarkdownHelper::ChatMarkdownHelper(QObject *parent)
@@ -215,34 +91,40 @@ void ChatMarkdownHelper::updatePosition(int position)
         return;
     }
 
-    auto cursor = m_textItem->textCursor();
-    if (cursor.isNull()) {
+    const auto document = m_textItem->document();
+    if (!document) {
         return;
     }
-    cursor.setPosition(m_startPos);
-    cursor.movePosition(QTextCursor::PreviousCharacter, QTextCursor::KeepAnchor);
-    while (checkSequenceBackwards(cursor.selectedText()) && m_startPos > 0) {
+    // Move the start back over the text that ends a sequence.
+    const auto &trie = MarkdownSyntaxTrie::instance();
+    auto state = MarkdownSyntaxTrie::Root;
+    while (m_startPos > 0 && (state = trie.previous(state, document->characterAt(m_startPos - 1))) != MarkdownSyntaxTrie::Dead) {
         --m_startPos;
-        cursor.movePosition(QTextCursor::PreviousCharacter, QTextCursor::KeepAnchor);
     }
 }
 
 void ChatMarkdownHelper::checkMarkdownForward()
 {
-    auto cursor = m_textItem->textCursor();
-    if (cursor.isNull()) {
+    const auto document = m_textItem->document();
+    if (!document) {
         return;
     }
 
-    cursor.setPosition(m_startPos);
-    const auto atBlockStart = cursor.atBlockStart();
-    cursor.setPosition(m_endPos, QTextCursor::KeepAnchor);
-    const auto currentMarkdown = cursor.selectedText();
-    cursor.setPosition(m_endPos);
-    cursor.setPosition(m_endPos + 1, QTextCursor::KeepAnchor);
-    const auto nextChar = cursor.selectedText();
+    // The text between m_startPos and m_endPos is never longer than the longest sequence.
+    const auto &trie = MarkdownSyntaxTrie::instance();
+    auto state = MarkdownSyntaxTrie::Root;
+    for (auto position = m_startPos; position < m_endPos; ++position) {
+        state = trie.next(state, document->characterAt(position));
+    }
+    const auto atBlockStart = document->findBlock(m_startPos).position() == m_startPos;
+    QChar nextChar;
+    QStringView nextCharView;
+    if (m_endPos + 1 < document->characterCount()) {
+        nextChar = document->characterAt(m_endPos);
+        nextCharView = QStringView(&nextChar, 1);
+    }
 
-    const auto result = checkSequence(currentMarkdown, nextChar, atBlockStart);
+    const auto result = trie.check(state, nextCharView, atBlockStart);
     if (!result) {
         ++m_startPos;
         m_endPos = m_startPos;
@@ -265,7 +147,8 @@ void ChatMarkdownHelper::complete()
     cursor.beginEditBlock();
     cursor.setPosition(m_startPos);
     cursor.setPosition(m_endPos, QTextCursor::KeepAnchor);
-    const auto syntax = syntaxForSequence(cursor.selectedText());
+    const auto &trie = MarkdownSyntaxTrie::instance();
+    const auto syntax = trie.match(trie.walk(cursor.selectedText()));
     if (!syntax) {
         return;
     }
@@ -274,7 +157,7 @@ void ChatMarkdownHelper::complete()
     cursor.setPosition(m_startPos);
     cursor.movePosition(QTextCursor::NextCharacter, QTextCursor::KeepAnchor);
     const auto nextChar = cursor.selectedText();
-    const auto result = checkSequence({}, nextChar, cursor.atBlockStart());
+    const auto result = trie.check(MarkdownSyntaxTrie::Root, nextChar, cursor.atBlockStart());
 
     cursor.setPosition(m_startPos);
     cursor.movePosition(QTextCursor::NextWord, QTextCursor::KeepAnchor);
@@ -109,6 +109,11 @@ void ChatTextItemHelper::setInitialFragment(const QTextDocumentFragment &fragmen
     initialize();
 }
 
+void ChatTextItemHelper::setInitialCursorPosition(int position)
+{
+    m_initialCursorPosition = position;
+}
+
 void ChatTextItemHelper::initialize()
 {
     const auto doc = document();
@@ -153,6 +158,13 @@ void ChatTextItemHelper::initialize()
             cursor.insertText(m_fixedEndChars);
         }
     }
+
+    if (m_initialCursorPosition) {
+        const int start = m_fixedStartChars.length();
+        const int end = std::max(start, doc->characterCount() - 1 - int(m_fixedEndChars.length()));
+        finalCursorPos = std::clamp(*m_initialCursorPosition, start, end);
+        m_initialCursorPosition.reset();
+    }
     setCursorPosition(finalCursorPos);
     cursor.endEditBlock();
 
@@ -309,6 +321,35 @@ void ChatTextItemHelper::insertFragment(const QTextDocumentFragment fragment, In
     setCursorPosition(cursor.position());
 }
 
+void ChatTextItemHelper::appendFragment(const QTextDocumentFragment &fragment)
+{
+    if (fragment.isEmpty()) {
+        return;
+    }
+
+    const auto doc = document();
+    if (!doc) {
+        QTextDocument combined;
+        QTextCursor cursor(&combined);
+        if (!m_initialFragment.isEmpty()) {
+            cursor.insertFragment(m_initialFragment);
+            cursor.insertBlock();
+        }
+        cursor.insertFragment(fragment);
+        m_initialFragment = QTextDocumentFragment(&combined);
+        return;
+    }
+
+    QTextCursor cursor(doc);
+    cursor.setPosition(doc->characterCount() - 1 - m_fixedEndChars.length());
+    cursor.beginEditBlock();
+    if (!doc->isEmpty()) {
+        cursor.insertBlock();
+    }
+    cursor.insertFragment(fragment);
+    cursor.endEditBlock();
+}
+
 std::optional<int> ChatTextItemHelper::cursorPosition() const
 {
     if (!m_textItem) {
@@ -93,6 +93,13 @@ public:
      */
     void setInitialFragment(const QTextDocumentFragment &fragment);
 
+    /**
+     * @brief Set where the cursor is placed when the initial fragment is inserted.
+     *
+     * By default the cursor is placed at the end of the fragment.
+     */
+    void setInitialCursorPosition(int position);
+
     /**
      * @brief The underlying QTextDocument.
      *
@@ -140,6 +147,15 @@ public:
      */
     void insertFragment(const QTextDocumentFragment fragment, InsertPosition position = Cursor, bool keepPosition = false);
 
+    /**
+     * @brief Append the given QTextDocumentFragment as new blocks at the end of the text item.
+     *
+     * Unlike insertFragment() the fragment formatting is always kept and the cursor
+     * isn't moved. If there is no text item yet the fragment is added to the initial
+     * fragment instead.
+     */
+    void appendFragment(const QTextDocumentFragment &fragment);
+
     /**
      * @brief Return a QTextCursor pointing to the current cursor position.
      */
@@ -299,6 +315,7 @@ private:
     QString m_fixedStartChars = {};
     QString m_fixedEndChars = {};
     QTextDocumentFragment m_initialFragment = {};
+    std::optional<int> m_initialCursorPosition;
     void initialize();
     bool m_initializingChars = false;
 
@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "downloadindex.h"
+
+#include <QFileInfo>
+
+using namespace Qt::StringLiterals;
+
+DownloadIndex &DownloadIndex::instance()
+{
+    static DownloadIndex _instance(KSharedConfig::openStateConfig(u"neochatdownloads"_s));
+    return _instance;
+}
+
+DownloadIndex::DownloadIndex(KSharedConfig::Ptr config, QObject *parent)
+    : QObject(parent)
+    , m_config(config)
+    , m_group(m_config, u"downloads"_s)
+{
+    connect(&m_watcher, &QFileSystemWatcher::directoryChanged, this, &DownloadIndex::invalidate);
+}
+
+DownloadIndex::~DownloadIndex()
+{
+    m_config->sync();
+}
+
+void DownloadIndex::load()
+{
+    if (m_loaded) {
+        return;
+    }
+    m_loaded = true;
+
+    const auto keys = m_group.keyList();
+    m_items.reserve(keys.size());
+    for (const auto &key : keys) {
+        m_items.insert(key, {m_group.readPathEntry(key, QString()), std::nullopt});
+    }
+}
+
+std::optional<DownloadIndex::Entry> DownloadIndex::find(const QString &mediaId)
+{
+    load();
+
+    const auto it = m_items.find(mediaId);
+    if (it == m_items.end()) {
+        return std::nullopt;
+    }
+    if (it->entry) {
+        return it->entry;
+    }
+
+    const QFileInfo info(it->path);
+    if (!info.isFile()) {
+        m_group.deleteEntry(mediaId);
+        m_items.erase(it);
+        return std::nullopt;
+    }
+    it->entry = Entry{
+        .path = it->path,
+        .directory = info.absolutePath(),
+        .size = info.size(),
+        .lastModified = info.lastModified(),
+    };
+    watch(it->entry->directory);
+    return it->entry;
+}
+
+void DownloadIndex::insert(const QString &mediaId, const QString &path)
+{
+    load();
+
+    m_group.writePathEntry(mediaId, path);
+    m_items.insert(mediaId, {path, std::nullopt});
+}
+
+void DownloadIndex::remove(const QString &mediaId)
+{
+    load();
+
+    m_group.deleteEntry(mediaId);
+    m_items.remove(mediaId);
+}
+
+void DownloadIndex::watch(const QString &directory)
+{
+    if (!m_watcher.directories().contains(directory)) {
+        m_watcher.addPath(directory);
+    }
+}
+
+void DownloadIndex::invalidate(const QString &directory)
+{
+    for (auto &item : m_items) {
+        if (item.entry && item.entry->directory == directory) {
+            item.entry.reset();
+        }
+    }
+}
+
+#include "moc_downloadindex.cpp"
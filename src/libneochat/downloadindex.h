@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QDateTime>
+#include <QFileSystemWatcher>
+#include <QHash>
+#include <QObject>
+
+#include <KConfigGroup>
+#include <KSharedConfig>
+
+#include <optional>
+
+/**
+ * @class DownloadIndex
+ *
+ * An in-memory index of the media files that have been downloaded.
+ *
+ * Downloads are keyed by the media id (the mxc URI without the "mxc://" scheme)
+ * and persisted in the "neochatdownloads" state config, which is only read once.
+ *
+ * The existence of a download is checked the first time it is looked up and then
+ * remembered. The directories holding downloads are watched and any change in one
+ * makes its downloads get checked again on their next lookup.
+ *
+ * @note Not thread safe, use it from the GUI thread only.
+ */
+class DownloadIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief A downloaded file.
+     */
+    struct Entry {
+        QString path;
+        QString directory;
+        qint64 size = 0;
+        QDateTime lastModified;
+    };
+
+    static DownloadIndex &instance();
+
+    /**
+     * @brief Create an index stored in the "downloads" group of @p config.
+     */
+    explicit DownloadIndex(KSharedConfig::Ptr config, QObject *parent = nullptr);
+    ~DownloadIndex() override;
+
+    /**
+     * @brief The download of @p mediaId, if it has been downloaded and the file still exists.
+     *
+     * Downloads whose file has disappeared are forgotten.
+     */
+    std::optional<Entry> find(const QString &mediaId);
+
+    /**
+     * @brief Record that @p mediaId has been downloaded to @p path.
+     */
+    void insert(const QString &mediaId, const QString &path);
+
+    /**
+     * @brief Forget the download of @p mediaId.
+     */
+    void remove(const QString &mediaId);
+
+private:
+    struct Item {
+        QString path;
+        // Empty until the file has been checked.
+        std::optional<Entry> entry;
+    };
+
+    void load();
+    void watch(const QString &directory);
+    void invalidate(const QString &directory);
+
+    KSharedConfig::Ptr m_config;
+    KConfigGroup m_group;
+    bool m_loaded = false;
+    QHash<QString, Item> m_items;
+    QFileSystemWatcher m_watcher;
+};
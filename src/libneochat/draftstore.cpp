@@ -0,0 +1,265 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "draftstore.h"
+
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QUrl>
+#include <QtConcurrentRun>
+
+#include <algorithm>
+
+#include <Quotient/connection.h>
+#include <Quotient/room.h>
+
+using namespace Qt::StringLiterals;
+
+namespace
+{
+// A file written with another version is ignored.
+constexpr quint8 FormatVersion = 1;
+
+void writeDrafts(const QString &fileName, const QHash<QString, QByteArray> &drafts)
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream << FormatVersion << quint32(drafts.size());
+    for (const auto &[roomId, roomDrafts] : drafts.asKeyValueRange()) {
+        stream << roomId.toUtf8() << roomDrafts;
+    }
+
+    QDir().mkpath(QFileInfo(fileName).absolutePath());
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size() || !file.commit()) {
+        qWarning() << "Failed to write drafts to" << fileName << file.errorString();
+    }
+}
+
+// Whether the cache has anything other than empty text, which isn't worth keeping.
+bool hasContent(const Blocks::Cache *cache)
+{
+    return std::ranges::any_of(*cache, [](const Blocks::CacheItemPtr &item) {
+        const auto textItem = dynamic_cast<const Blocks::TextCacheItem *>(item.get());
+        return !textItem || !textItem->content.toPlainText().trimmed().isEmpty();
+    });
+}
+}
+
+DraftStore *DraftStore::forConnection(Quotient::Connection *connection)
+{
+    if (!connection) {
+        return nullptr;
+    }
+
+    static QHash<const Quotient::Connection *, DraftStore *> stores;
+    auto &store = stores[connection];
+    if (!store) {
+        const auto fileName = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + u"/drafts/"_s
+            + QString::fromLatin1(QUrl::toPercentEncoding(connection->userId())) + u".drafts"_s;
+        store = new DraftStore(fileName, connection);
+        connect(connection, &QObject::destroyed, [connection] {
+            stores.remove(connection);
+        });
+
+        // The rooms are only all known once the connection has synced.
+        connect(
+            connection,
+            &Quotient::Connection::syncDone,
+            store,
+            [connection, store = store] {
+                store->prune([connection](const QString &roomId) {
+                    const auto room = connection->room(roomId, Quotient::JoinState::Join);
+                    return room && !room->usesEncryption();
+                });
+            },
+            Qt::SingleShotConnection);
+        connect(connection, &Quotient::Connection::leftRoom, store, [store = store](Quotient::Room *room) {
+            store->remove(room->id());
+        });
+        connect(connection, &Quotient::Connection::loggedOut, store, &DraftStore::discard);
+    }
+    return store;
+}
+
+DraftStore::DraftStore(const QString &fileName, QObject *parent)
+    : QObject(parent)
+    , m_fileName(fileName)
+{
+    m_saveTimer.setSingleShot(true);
+    m_saveTimer.setInterval(SaveDelay);
+    connect(&m_saveTimer, &QTimer::timeout, this, &DraftStore::startWrite);
+    if (QCoreApplication::instance()) {
+        connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, this, &DraftStore::save);
+    }
+
+    load();
+}
+
+DraftStore::~DraftStore()
+{
+    save();
+}
+
+void DraftStore::load()
+{
+    QFile file(m_fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+    quint8 version = 0;
+    quint32 count = 0;
+    stream >> version >> count;
+    if (version != FormatVersion) {
+        return;
+    }
+
+    for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        QByteArray roomId;
+        QByteArray roomDrafts;
+        stream >> roomId >> roomDrafts;
+        if (stream.status() == QDataStream::Ok) {
+            m_drafts.insert(QString::fromUtf8(roomId), roomDrafts);
+        }
+    }
+}
+
+void DraftStore::track(const QString &roomId, Blocks::Cache *mainCache, Blocks::Cache *editCache, Blocks::Cache *threadCache)
+{
+    const auto caches = {mainCache, editCache, threadCache};
+    m_rooms.insert(roomId, {mainCache, editCache, threadCache});
+
+    if (const auto it = m_drafts.constFind(roomId); it != m_drafts.constEnd()) {
+        QDataStream stream(*it);
+        stream.setVersion(QDataStream::Qt_6_0);
+        for (const auto cache : caches) {
+            QByteArray data;
+            stream >> data;
+            if (!data.isEmpty() && !cache->deserialize(data)) {
+                qWarning() << "Dropping an invalid draft of" << roomId;
+            }
+        }
+    }
+
+    for (const auto cache : caches) {
+        connect(cache, &Blocks::Cache::changed, this, [this, roomId] {
+            m_changedRooms.insert(roomId);
+            m_saveTimer.start();
+        });
+    }
+}
+
+bool DraftStore::contains(const QString &roomId) const
+{
+    return m_drafts.contains(roomId);
+}
+
+void DraftStore::untrack(const QString &roomId)
+{
+    const auto caches = m_rooms.value(roomId);
+    if (m_changedRooms.remove(roomId)) {
+        collectRoom(roomId);
+    }
+    for (const auto &cache : {caches.mainCache, caches.editCache, caches.threadCache}) {
+        if (cache) {
+            disconnect(cache, nullptr, this, nullptr);
+        }
+    }
+    m_rooms.remove(roomId);
+}
+
+void DraftStore::remove(const QString &roomId)
+{
+    untrack(roomId);
+    if (m_drafts.remove(roomId)) {
+        m_saveTimer.start();
+    }
+}
+
+void DraftStore::prune(const std::function<bool(const QString &roomId)> &keep)
+{
+    const auto roomIds = m_drafts.keys();
+    for (const auto &roomId : roomIds) {
+        if (!keep(roomId)) {
+            remove(roomId);
+        }
+    }
+}
+
+void DraftStore::discard()
+{
+    const auto roomIds = m_rooms.keys();
+    for (const auto &roomId : roomIds) {
+        untrack(roomId);
+    }
+    m_saveTimer.stop();
+    m_write.waitForFinished();
+    m_changedRooms.clear();
+    m_drafts.clear();
+    QFile::remove(m_fileName);
+}
+
+void DraftStore::collect()
+{
+    for (const auto &roomId : std::as_const(m_changedRooms)) {
+        collectRoom(roomId);
+    }
+    m_changedRooms.clear();
+}
+
+void DraftStore::collectRoom(const QString &roomId)
+{
+    const auto caches = m_rooms.value(roomId);
+    // The room is gone, keep what was saved last.
+    if (!caches.mainCache || !caches.editCache || !caches.threadCache) {
+        return;
+    }
+
+    if (!hasContent(caches.mainCache) && !hasContent(caches.editCache) && !hasContent(caches.threadCache)) {
+        m_drafts.remove(roomId);
+        return;
+    }
+
+    QByteArray roomDrafts;
+    QDataStream stream(&roomDrafts, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream << caches.mainCache->serialize() << caches.editCache->serialize() << caches.threadCache->serialize();
+    m_drafts.insert(roomId, roomDrafts);
+}
+
+void DraftStore::startWrite()
+{
+    // Keep the writes in order, the next one starts once this one is done.
+    if (m_write.isRunning()) {
+        m_saveTimer.start();
+        return;
+    }
+
+    collect();
+    // The worker gets a shallow copy of the drafts, later changes detach from it.
+    m_write = QtConcurrent::run(&writeDrafts, m_fileName, m_drafts);
+}
+
+void DraftStore::save()
+{
+    const auto pending = m_saveTimer.isActive();
+    m_saveTimer.stop();
+    m_write.waitForFinished();
+    if (!pending) {
+        return;
+    }
+
+    collect();
+    writeDrafts(m_fileName, m_drafts);
+}
+
+#include "moc_draftstore.cpp"
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QByteArray>
+#include <QFuture>
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QSet>
+#include <QTimer>
+
+#include <functional>
+
+#include "blockcache.h"
+
+namespace Quotient
+{
+class Connection;
+}
+
+/**
+ * @class DraftStore
+ *
+ * The unsent chat bar contents of every room of an account, kept in a single file.
+ *
+ * The file is read once and the drafts are kept as the compact data of
+ * Blocks::Cache::serialize(); the caches of a room are only filled from it when the
+ * room first asks for them. Changed caches are serialized SaveDelay after the last
+ * change and the file is written in a worker thread, so typing and switching rooms
+ * never wait for the disk. Pending changes are written when the application quits
+ * and when the store is destroyed.
+ *
+ * The drafts are stored unencrypted, so encrypted rooms aren't tracked. The store of a
+ * connection drops the drafts of rooms that are left or that aren't joined anymore,
+ * and deletes its file when the account logs out.
+ *
+ * @sa Blocks::Cache, NeoChatRoom::mainCache()
+ */
+class DraftStore : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief The time between the last change and writing the drafts, in milliseconds.
+     */
+    static constexpr int SaveDelay = 1000;
+
+    /**
+     * @brief The store of the given connection, created on first use.
+     *
+     * The store is destroyed with the connection. After the first sync the drafts of
+     * rooms that aren't joined or that use encryption are removed.
+     */
+    static DraftStore *forConnection(Quotient::Connection *connection);
+
+    /**
+     * @brief Create a store that keeps the drafts in @p fileName.
+     */
+    explicit DraftStore(const QString &fileName, QObject *parent = nullptr);
+    ~DraftStore() override;
+
+    /**
+     * @brief Fill the caches of a room with its saved drafts and save them whenever they change.
+     */
+    void track(const QString &roomId, Blocks::Cache *mainCache, Blocks::Cache *editCache, Blocks::Cache *threadCache);
+
+    /**
+     * @brief Stop watching the caches of a room, e.g. because they are about to be destroyed.
+     *
+     * Changes that are waiting for SaveDelay are kept and written with the next save.
+     */
+    void untrack(const QString &roomId);
+
+    /**
+     * @brief Stop watching the caches of a room and drop its saved drafts.
+     */
+    void remove(const QString &roomId);
+
+    /**
+     * @brief Remove the drafts of every room for which @p keep returns false.
+     */
+    void prune(const std::function<bool(const QString &roomId)> &keep);
+
+    /**
+     * @brief Drop all drafts and delete the file, e.g. when the account logs out.
+     *
+     * Rooms that are tracked aren't saved anymore.
+     */
+    void discard();
+
+    /**
+     * @brief Whether there are saved drafts for the given room.
+     *
+     * Changes that are waiting for SaveDelay aren't included.
+     */
+    bool contains(const QString &roomId) const;
+
+    /**
+     * @brief Write any pending changes now and wait until they are written.
+     */
+    void save();
+
+private:
+    struct RoomCaches {
+        QPointer<Blocks::Cache> mainCache;
+        QPointer<Blocks::Cache> editCache;
+        QPointer<Blocks::Cache> threadCache;
+    };
+
+    void load();
+    // Serialize the caches of the changed rooms into m_drafts.
+    void collect();
+    void collectRoom(const QString &roomId);
+    void startWrite();
+
+    QString m_fileName;
+    // Room id to the serialized caches of the room.
+    QHash<QString, QByteArray> m_drafts;
+    QHash<QString, RoomCaches> m_rooms;
+    QSet<QString> m_changedRooms;
+    QTimer m_saveTimer;
+    QFuture<void> m_write;
+};
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "emojisearchindex.h"
+
+#include <algorithm>
+
+namespace
+{
+enum Match {
+    Exact,
+    ShortNamePrefix,
+    WordPrefix,
+    NoMatch,
+};
+
+QStringList words(QString text)
+{
+    return text.replace(u'_', u' ').replace(u'-', u' ').split(u' ', Qt::SkipEmptyParts);
+}
+
+template<typename Keys>
+auto prefixRange(const Keys &keys, QStringView prefix)
+{
+    const auto begin = std::lower_bound(keys.cbegin(), keys.cend(), prefix, [](const auto &key, QStringView prefix) {
+        return QStringView(key.key) < prefix;
+    });
+    auto end = begin;
+    while (end != keys.cend() && end->key.startsWith(prefix)) {
+        ++end;
+    }
+    return std::make_pair(begin, end);
+}
+}
+
+QString EmojiSearchIndex::normalize(QStringView shortName)
+{
+    if (shortName.startsWith(u':')) {
+        shortName = shortName.sliced(1);
+    }
+    if (shortName.endsWith(u':')) {
+        shortName.chop(1);
+    }
+    return shortName.toString().toLower();
+}
+
+EmojiSearchIndex::EmojiSearchIndex(const QList<Entry> &entries)
+    : m_recency(entries.size(), 0)
+{
+    m_shortNames.reserve(entries.size());
+    m_ids.reserve(entries.size());
+    for (int id = 0; id < entries.size(); ++id) {
+        const auto shortName = normalize(entries[id].shortName);
+        m_shortNames += {shortName, id};
+        m_ids.insert(shortName, id);
+
+        // Index the words of both, so that "smile" also finds "sweat_smile" and "grinning face with smiling eyes".
+        auto entryWords = words(shortName) + words(entries[id].description.toLower());
+        entryWords.removeDuplicates();
+        for (auto &word : entryWords) {
+            m_words += {std::move(word), id};
+        }
+    }
+
+    const auto byKey = [](const Key &left, const Key &right) {
+        return left.key < right.key || (left.key == right.key && left.id < right.id);
+    };
+    std::sort(m_shortNames.begin(), m_shortNames.end(), byKey);
+    std::sort(m_words.begin(), m_words.end(), byKey);
+}
+
+qsizetype EmojiSearchIndex::size() const
+{
+    return m_recency.size();
+}
+
+int EmojiSearchIndex::find(QStringView shortName) const
+{
+    return m_ids.value(normalize(shortName), -1);
+}
+
+void EmojiSearchIndex::setRecent(const QStringList &shortNames)
+{
+    std::fill(m_recency.begin(), m_recency.end(), 0);
+    for (qsizetype i = 0; i < shortNames.size(); ++i) {
+        if (const auto id = find(shortNames[i]); id >= 0 && m_recency[id] == 0) {
+            m_recency[id] = int(shortNames.size() - i);
+        }
+    }
+}
+
+QList<int> EmojiSearchIndex::search(QStringView text, qsizetype limit) const
+{
+    const auto query = normalize(text);
+    if (query.isEmpty() || limit == 0) {
+        return {};
+    }
+
+    QHash<int, Match> matches;
+    const auto add = [&matches](int id, Match match) {
+        if (const auto it = matches.find(id); it != matches.end()) {
+            *it = std::min(*it, match);
+        } else {
+            matches.insert(id, match);
+        }
+    };
+
+    const auto [shortNamesBegin, shortNamesEnd] = prefixRange(m_shortNames, query);
+    for (auto it = shortNamesBegin; it != shortNamesEnd; ++it) {
+        add(it->id, it->key.size() == query.size() ? Exact : ShortNamePrefix);
+    }
+    const auto [wordsBegin, wordsEnd] = prefixRange(m_words, query);
+    for (auto it = wordsBegin; it != wordsEnd; ++it) {
+        add(it->id, WordPrefix);
+    }
+
+    QList<std::pair<int, Match>> ranked;
+    ranked.reserve(matches.size());
+    for (const auto &[id, match] : matches.asKeyValueRange()) {
+        ranked += {id, match};
+    }
+    const auto better = [this](const std::pair<int, Match> &left, const std::pair<int, Match> &right) {
+        if (left.second != right.second) {
+            return left.second < right.second;
+        }
+        if (m_recency[left.first] != m_recency[right.first]) {
+            return m_recency[left.first] > m_recency[right.first];
+        }
+        return left.first < right.first;
+    };
+    if (limit > 0 && limit < ranked.size()) {
+        std::partial_sort(ranked.begin(), ranked.begin() + limit, ranked.end(), better);
+        ranked.resize(limit);
+    } else {
+        std::sort(ranked.begin(), ranked.end(), better);
+    }
+
+    QList<int> result;
+    result.reserve(ranked.size());
+    for (const auto &[id, match] : std::as_const(ranked)) {
+        result += id;
+    }
+    return result;
+}
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @class EmojiSearchIndex
+ *
+ * A search index over emoji shortcodes and descriptions.
+ *
+ * The shortcodes and the words of the shortcodes and descriptions are kept in two
+ * sorted arrays, which act as flattened prefix tries: all the keys starting with a
+ * prefix form one contiguous range found with two binary searches. A search only
+ * looks at the matching keys, not at every emoji.
+ *
+ * Results are ranked by how they match (the whole shortcode, the start of the
+ * shortcode, then the start of one of the words) and within that by how recently
+ * the emoji was used, falling back to the order the entries were given in.
+ */
+class EmojiSearchIndex
+{
+public:
+    struct Entry {
+        /**
+         * @brief The shortcode, with or without the surrounding colons.
+         */
+        QString shortName;
+        QString description;
+    };
+
+    EmojiSearchIndex() = default;
+    explicit EmojiSearchIndex(const QList<Entry> &entries);
+
+    /**
+     * @brief The number of entries in the index.
+     */
+    qsizetype size() const;
+
+    /**
+     * @brief The index of the entry with the given shortcode, or -1.
+     */
+    int find(QStringView shortName) const;
+
+    /**
+     * @brief Set the recently used shortcodes, most recent first.
+     */
+    void setRecent(const QStringList &shortNames);
+
+    /**
+     * @brief The indices of the entries matching @p text, best match first.
+     *
+     * Surrounding colons in @p text are ignored and matching is case insensitive.
+     *
+     * @param limit The maximum number of results, or -1 for all of them.
+     */
+    QList<int> search(QStringView text, qsizetype limit = -1) const;
+
+private:
+    struct Key {
+        QString key;
+        int id;
+    };
+
+    static QString normalize(QStringView shortName);
+
+    QList<Key> m_shortNames;
+    QList<Key> m_words;
+    QHash<QString, int> m_ids;
+    // Higher for more recently used entries, 0 if unused.
+    QList<int> m_recency;
+};
@@ -3,6 +3,9 @@
 
 #include "emojitones.h"
 
+#include <algorithm>
+#include <string_view>
+
 struct {
     const char8_t *name;
     const char8_t *escaped_sequence;
@@ -12,16 +15,26 @@ struct {
 #include "emojitones_data.h"
 };
 
-using namespace Qt::StringLiterals;
+namespace
+{
+constexpr auto toneName = [](const auto &tone) {
+    return std::u8string_view(tone.name);
+};
+}
+
+static_assert(std::ranges::is_sorted(tones_data, {}, toneName), "emojitones_data.h must be sorted by name, see tools/update-emojis.py");
 
-QMultiHash<QString, Emoji> EmojiTones::tones()
+QList<Emoji> EmojiTones::tones(QStringView name)
 {
-    static QMultiHash<QString, Emoji> _tones;
-    if (_tones.isEmpty()) {
-        for (const auto &tone : tones_data) {
-            _tones.insert(QString::fromUtf8(tone.name),
-                          Emoji(QString::fromUtf8(tone.escaped_sequence), QString::fromUtf8(tone.shortcode), QString::fromUtf8(tone.description)));
-        }
+    const auto utf8Name = name.toUtf8();
+    const std::u8string_view key(reinterpret_cast<const char8_t *>(utf8Name.constData()), utf8Name.size());
+    const auto [begin, end] = std::ranges::equal_range(tones_data, key, {}, toneName);
+
+    QList<Emoji> result;
+    result.reserve(end - begin);
+    for (auto it = end; it != begin;) {
+        --it;
+        result += Emoji(QString::fromUtf8(it->escaped_sequence), QString::fromUtf8(it->shortcode), QString::fromUtf8(it->description));
     }
-    return _tones;
+    return result;
 }
@@ -5,19 +5,22 @@
 
 #include "models/emojimodel.h"
 
-#include <QMultiHash>
-
 /**
  * @class EmojiTones
  *
- * This class provides a _tones variable with the available emoji tones to EmojiModel.
+ * This class provides the available emoji tones to EmojiModel.
+ *
+ * The tones are kept in a static table sorted by the name of their base emoji.
  *
  * @sa EmojiModel
  */
 class EmojiTones
 {
 private:
-    static QMultiHash<QString, Emoji> tones();
+    /**
+     * @brief The skin tone variants of the emoji with the given name, darkest first.
+     */
+    static QList<Emoji> tones(QStringView name);
 
     friend class EmojiModel;
 };
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "emojiusagehistory.h"
+
+#include <QCoreApplication>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Qt::StringLiterals;
+
+EmojiUsageHistory::EmojiUsageHistory(KSharedConfig::Ptr config, QObject *parent)
+    : QObject(parent)
+    , m_config(std::move(config))
+    , m_configGroup(m_config, u"Editor"_s)
+{
+    m_saveTimer.setSingleShot(true);
+    m_saveTimer.setInterval(SaveDelay);
+    connect(&m_saveTimer, &QTimer::timeout, this, &EmojiUsageHistory::save);
+    if (QCoreApplication::instance()) {
+        connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, this, &EmojiUsageHistory::save);
+    }
+
+    load();
+}
+
+EmojiUsageHistory::~EmojiUsageHistory()
+{
+    save();
+}
+
+const QStringList &EmojiUsageHistory::shortNames() const
+{
+    return m_shortNames;
+}
+
+double EmojiUsageHistory::score(const QString &shortName, qint64 time) const
+{
+    const auto it = m_entries.constFind(shortName);
+    if (it == m_entries.cend()) {
+        return 0;
+    }
+    return it->score * std::exp2(double(it->time - time) / HalfLife);
+}
+
+void EmojiUsageHistory::recordUse(const QString &shortName, qint64 time)
+{
+    m_entries[shortName] = Entry{score(shortName, time) + 1, time};
+    updateShortNames();
+    m_saveTimer.start();
+    Q_EMIT changed();
+}
+
+void EmojiUsageHistory::save()
+{
+    if (!m_saveTimer.isActive()) {
+        return;
+    }
+    m_saveTimer.stop();
+
+    QList<double> scores;
+    QList<qint64> times;
+    scores.reserve(m_shortNames.size());
+    times.reserve(m_shortNames.size());
+    for (const auto &shortName : std::as_const(m_shortNames)) {
+        const auto entry = m_entries.value(shortName);
+        scores += entry.score;
+        times += entry.time;
+    }
+    m_configGroup.writeEntry(u"lastUsedEmojis"_s, m_shortNames);
+    m_configGroup.writeEntry(u"lastUsedEmojiScores"_s, scores);
+    m_configGroup.writeEntry(u"lastUsedEmojiTimes"_s, times);
+    m_config->sync();
+}
+
+double EmojiUsageHistory::rank(const Entry &entry)
+{
+    // log2 of the score at any fixed time, up to a constant shared by all entries.
+    return std::log2(entry.score) + double(entry.time) / HalfLife;
+}
+
+void EmojiUsageHistory::load()
+{
+    const auto shortNames = m_configGroup.readEntry(u"lastUsedEmojis"_s, QStringList());
+    const auto scores = m_configGroup.readEntry(u"lastUsedEmojiScores"_s, QList<double>());
+    const auto times = m_configGroup.readEntry(u"lastUsedEmojiTimes"_s, QList<qint64>());
+
+    // Without scores the list is the plain history written by older versions, most recent first.
+    const bool hasScores = scores.size() == shortNames.size() && times.size() == shortNames.size();
+    const auto now = QDateTime::currentMSecsSinceEpoch();
+    for (qsizetype i = 0; i < shortNames.size(); ++i) {
+        if (m_entries.contains(shortNames[i])) {
+            continue;
+        }
+        if (hasScores && scores[i] > 0) {
+            m_entries.insert(shortNames[i], Entry{scores[i], times[i]});
+        } else if (!hasScores) {
+            m_entries.insert(shortNames[i], Entry{1, now - i});
+        }
+    }
+    updateShortNames();
+}
+
+void EmojiUsageHistory::updateShortNames()
+{
+    m_shortNames = m_entries.keys();
+    std::ranges::sort(m_shortNames, [this](const QString &left, const QString &right) {
+        const auto leftRank = rank(m_entries.value(left));
+        const auto rightRank = rank(m_entries.value(right));
+        return leftRank != rightRank ? leftRank > rightRank : left < right;
+    });
+
+    while (m_shortNames.size() > MaxEntries) {
+        m_entries.remove(m_shortNames.takeLast());
+    }
+}
+
+#include "moc_emojiusagehistory.cpp"
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <KConfigGroup>
+#include <KSharedConfig>
+#include <QDateTime>
+#include <QHash>
+#include <QObject>
+#include <QStringList>
+#include <QTimer>
+
+/**
+ * @class EmojiUsageHistory
+ *
+ * How often and how recently each emoji was used.
+ *
+ * Every use adds one to the score of the emoji and scores halve every HalfLife, so an
+ * emoji used a lot last month can rank below one used a few times this week. The
+ * ranking only depends on the scores and when they were last updated, so it is kept
+ * sorted in memory and only changes when an emoji is used.
+ *
+ * The history is read from the "Editor" group of the config once and written back
+ * SaveDelay after the last use, when the application quits and when the history is
+ * destroyed, instead of on every use.
+ */
+class EmojiUsageHistory : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief The time after which a score is halved, in milliseconds.
+     */
+    static constexpr qint64 HalfLife = 14LL * 24 * 60 * 60 * 1000;
+
+    /**
+     * @brief The number of emojis remembered; the lowest ranked are forgotten first.
+     */
+    static constexpr qsizetype MaxEntries = 100;
+
+    /**
+     * @brief The time between the last use and writing the history, in milliseconds.
+     */
+    static constexpr int SaveDelay = 2000;
+
+    explicit EmojiUsageHistory(KSharedConfig::Ptr config, QObject *parent = nullptr);
+    ~EmojiUsageHistory() override;
+
+    /**
+     * @brief The short names of the used emojis, highest ranked first.
+     */
+    const QStringList &shortNames() const;
+
+    /**
+     * @brief The score of the given emoji at @p time, 0 if it wasn't used.
+     */
+    double score(const QString &shortName, qint64 time = QDateTime::currentMSecsSinceEpoch()) const;
+
+    /**
+     * @brief Record a use of the given emoji at @p time and schedule a save.
+     */
+    void recordUse(const QString &shortName, qint64 time = QDateTime::currentMSecsSinceEpoch());
+
+    /**
+     * @brief Write any unsaved uses to the config now.
+     */
+    void save();
+
+Q_SIGNALS:
+    /**
+     * @brief The ranking changed.
+     */
+    void changed();
+
+private:
+    struct Entry {
+        // The score at time.
+        double score = 0;
+        qint64 time = 0;
+    };
+
+    // The ranking key: higher is better and it doesn't change as time passes.
+    static double rank(const Entry &entry);
+
+    void load();
+    void updateShortNames();
+
+    KSharedConfig::Ptr m_config;
+    KConfigGroup m_configGroup;
+    QHash<QString, Entry> m_entries;
+    QStringList m_shortNames;
+    QTimer m_saveTimer;
+};
@@ -5,6 +5,8 @@
 
 #include <algorithm>
 
+#include <QCollator>
+
 #include "enums/roomsortorder.h"
 #include "neochatroom.h"
 
@@ -47,17 +49,29 @@ static const QList<RoomSortParameter::Parameter> activitySortPriorities = {
 static const QList<RoomSortParameter::Parameter> lastMessageSortPriorities = {
     RoomSortParameter::LastActive,
 };
+
+QCollator &nameCollator()
+{
+    static QCollator collator;
+    return collator;
+}
 }
 
 RoomSortOrder::Order RoomSortParameter::m_sortOrder = RoomSortOrder::Activity;
 QList<RoomSortParameter::Parameter> RoomSortParameter::m_customSortOrder = activitySortPriorities;
+QList<RoomSortParameter::Parameter> RoomSortParameter::m_currentParameterList = activitySortPriorities;
 
 QList<RoomSortParameter::Parameter> RoomSortParameter::allParameterList()
 {
     return allSortPriorities;
 }
 
-QList<RoomSortParameter::Parameter> RoomSortParameter::currentParameterList()
+const QList<RoomSortParameter::Parameter> &RoomSortParameter::currentParameterList()
+{
+    return m_currentParameterList;
+}
+
+void RoomSortParameter::updateCurrentParameterList()
 {
     QList<RoomSortParameter::Parameter> configParamList;
     switch (m_sortOrder) {
@@ -79,9 +93,9 @@ QList<RoomSortParameter::Parameter> RoomSortParameter::currentParameterList()
     }
 
     if (configParamList.isEmpty()) {
-        return activitySortPriorities;
+        configParamList = activitySortPriorities;
     }
-    return configParamList;
+    m_currentParameterList = configParamList;
 }
 
 int RoomSortParameter::compareParameter(Parameter parameter, NeoChatRoom *leftRoom, NeoChatRoom *rightRoom)
@@ -106,6 +120,38 @@ int RoomSortParameter::compareParameter(Parameter parameter, NeoChatRoom *leftRo
     }
 }
 
+int RoomSortParameter::compareParameter(Parameter parameter, const SortKey &left, const SortKey &right)
+{
+    switch (parameter) {
+    case AlphabeticalAscending:
+        return -typeCompare(left.name->compare(*right.name), 0);
+    case AlphabeticalDescending:
+        return typeCompare(left.name->compare(*right.name), 0);
+    case HasUnread:
+        return typeCompare(left.notificationCount > 0, right.notificationCount > 0);
+    case MostUnread:
+        return typeCompare(left.notificationCount, right.notificationCount);
+    case HasHighlight:
+        return typeCompare(left.highlightCount > 0 && left.notificationCount > 0, right.highlightCount > 0 && right.notificationCount > 0);
+    case MostHighlights:
+        return typeCompare(left.highlightCount, right.highlightCount);
+    case LastActive:
+        return typeCompare(left.lastActive, right.lastActive);
+    default:
+        return 0;
+    }
+}
+
+void RoomSortParameter::updateSortKey(SortKey &key, NeoChatRoom *room, bool updateName)
+{
+    if (updateName || !key.name) {
+        key.name = nameCollator().sortKey(room->displayName());
+    }
+    key.notificationCount = room->contextAwareNotificationCount();
+    key.highlightCount = int(room->highlightCount());
+    key.lastActive = room->lastActiveTime();
+}
+
 template<>
 int RoomSortParameter::compareParameter<RoomSortParameter::AlphabeticalAscending>(NeoChatRoom *leftRoom, NeoChatRoom *rightRoom)
 {
@@ -153,11 +199,13 @@ int RoomSortParameter::compareParameter<RoomSortParameter::LastActive>(NeoChatRo
 void RoomSortParameter::setSortOrder(RoomSortOrder::Order order)
 {
     RoomSortParameter::m_sortOrder = order;
+    updateCurrentParameterList();
 }
 
 void RoomSortParameter::setCustomSortOrder(QList<Parameter> order)
 {
     RoomSortParameter::m_customSortOrder = order;
+    updateCurrentParameterList();
 }
 
 #include "moc_roomsortparameter.cpp"
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "roomsortorder.h"
+#include <QCollatorSortKey>
+#include <QDateTime>
 #include <QObject>
 #include <QQmlEngine>
 
@@ -41,6 +43,22 @@ public:
     };
     Q_ENUM(Parameter)
 
+    /**
+     * @brief The values of a room that are used for sorting.
+     *
+     * Computing these for a room is comparatively expensive (e.g. the last active
+     * time has to search the timeline) so models should keep the key for each room
+     * and only update it when the room changes.
+     *
+     * @sa updateSortKey
+     */
+    struct SortKey {
+        std::optional<QCollatorSortKey> name;
+        int notificationCount = 0;
+        int highlightCount = 0;
+        QDateTime lastActive;
+    };
+
     /**
      * @brief Translate the Parameter enum value to a human readable name string.
      *
@@ -102,8 +120,10 @@ public:
 
     /**
      * @brief The current Parameter sort order list.
+     *
+     * The list is only recalculated when the sort order is changed.
      */
-    static QList<Parameter> currentParameterList();
+    static const QList<Parameter> &currentParameterList();
 
     /**
      * @brief Compare the given parameter of the two given rooms.
@@ -114,12 +134,32 @@ public:
      */
     static int compareParameter(Parameter parameter, NeoChatRoom *leftRoom, NeoChatRoom *rightRoom);
 
+    /**
+     * @brief Compare the given parameter of the two given sort keys.
+     *
+     * @return 0 if they are equal, 1 if the left is greater and -1 if the right is greater.
+     *
+     * @sa Parameter, SortKey
+     */
+    static int compareParameter(Parameter parameter, const SortKey &left, const SortKey &right);
+
+    /**
+     * @brief Update the given sort key with the current values of the room.
+     *
+     * The collation key for the name is only regenerated if updateName is true or
+     * there is none yet.
+     */
+    static void updateSortKey(SortKey &key, NeoChatRoom *room, bool updateName);
+
     static void setSortOrder(RoomSortOrder::Order order);
     static void setCustomSortOrder(QList<Parameter> order);
 
 private:
     static RoomSortOrder::Order m_sortOrder;
     static QList<Parameter> m_customSortOrder;
+    static QList<Parameter> m_currentParameterList;
+
+    static void updateCurrentParameterList();
 
     template<Parameter parameter>
     static int compareParameter(NeoChatRoom *, NeoChatRoom *)
@@ -31,6 +31,7 @@
 #include "events/pollevent.h"
 #include "events/widgetevent.h"
 #include "fileinfo.h"
+#include "mediathumbnailcache.h"
 #include "neochatroom.h"
 #include "pollblock.h"
 #include "texthandler.h"
@@ -898,7 +899,7 @@ Blocks::Block *EventHandler::fileBlockFromFileContent(QObject *parent,
 
         QUrl thumbnailSource;
         if (const auto thumbnail = imageContent->thumbnail; thumbnail.url().isValid() && thumbnail.url().scheme() == u"mxc"_s && !eventId.isEmpty()) {
-            thumbnailSource = room->makeMediaUrl(eventId, thumbnail.url());
+            thumbnailSource = MediaThumbnailCache::imageUrl(room->makeMediaUrl(eventId, thumbnail.url()));
         } else {
             if (const auto blurhash = imageContent->originalInfoJson["xyz.amorgan.blurhash"_L1].toString(); !blurhash.isEmpty()) {
                 thumbnailSource = QUrl("image://blurhash/"_L1 + blurhash);
@@ -918,7 +919,7 @@ Blocks::Block *EventHandler::fileBlockFromFileContent(QObject *parent,
 
         QUrl thumbnailSource;
         if (const auto thumbnail = videoContent->thumbnail; thumbnail.url().isValid() && thumbnail.url().scheme() == u"mxc"_s && !eventId.isEmpty()) {
-            thumbnailSource = room->makeMediaUrl(eventId, thumbnail.url());
+            thumbnailSource = MediaThumbnailCache::imageUrl(room->makeMediaUrl(eventId, thumbnail.url()));
         } else {
             if (const auto blurhash = videoContent->originalInfoJson["xyz.amorgan.blurhash"_L1].toString(); !blurhash.isEmpty()) {
                 thumbnailSource = QUrl("image://blurhash/"_L1 + blurhash);
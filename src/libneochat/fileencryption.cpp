@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "fileencryption.h"
+
+#include <QCryptographicHash>
+#include <QFile>
+#include <QRandomGenerator>
+
+#include <Quotient/e2ee/cryptoutils.h>
+
+using namespace Qt::StringLiterals;
+
+namespace
+{
+QByteArray randomBytes(qsizetype size)
+{
+    QByteArray bytes(size, Qt::Uninitialized);
+    QRandomGenerator::system()->fillRange(reinterpret_cast<quint32 *>(bytes.data()), size / sizeof(quint32));
+    return bytes;
+}
+
+// Add @p blocks to the 128 bit big endian counter in @p iv, like AES-CTR does after each block.
+QByteArray advanceCounter(QByteArray iv, quint64 blocks)
+{
+    for (auto i = iv.size() - 1; i >= 0 && blocks > 0; --i) {
+        const auto sum = quint64(quint8(iv[i])) + (blocks & 0xff);
+        iv[i] = char(sum & 0xff);
+        blocks = (blocks >> 8) + (sum >> 8);
+    }
+    return iv;
+}
+}
+
+QByteArray FileEncryption::encrypt(QIODevice &input, QIODevice &output, const QByteArray &key, const QByteArray &iv, qint64 chunkSize)
+{
+    Q_ASSERT(chunkSize > 0 && chunkSize % Quotient::AesBlockSize == 0);
+    if (key.size() != Quotient::Aes256KeySize || iv.size() != Quotient::AesBlockSize) {
+        return {};
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    quint64 blocks = 0;
+    while (!input.atEnd()) {
+        const auto plainText = input.read(chunkSize);
+        if (plainText.isEmpty()) {
+            break;
+        }
+        const auto chunkIv = advanceCounter(iv, blocks);
+        const auto cipherText = Quotient::aesCtr256Encrypt(plainText, Quotient::asCBytes<Quotient::Aes256KeySize>(key), Quotient::asCBytes<Quotient::AesBlockSize>(chunkIv));
+        if (!cipherText || output.write(*cipherText) != cipherText->size()) {
+            return {};
+        }
+        hash.addData(*cipherText);
+        blocks += plainText.size() / Quotient::AesBlockSize;
+    }
+    return hash.result();
+}
+
+std::optional<Quotient::EncryptedFileMetadata> FileEncryption::encryptFile(const QString &inputPath, const QString &outputPath)
+{
+    QFile input(inputPath);
+    QFile output(outputPath);
+    if (!input.open(QIODevice::ReadOnly) || !output.open(QIODevice::WriteOnly)) {
+        return std::nullopt;
+    }
+
+    const auto key = randomBytes(Quotient::Aes256KeySize);
+    const auto iv = randomBytes(Quotient::AesBlockSize);
+    const auto hash = encrypt(input, output, key, iv);
+    if (hash.isEmpty()) {
+        return std::nullopt;
+    }
+
+    const Quotient::JWK jwk{
+        u"oct"_s,
+        {u"encrypt"_s, u"decrypt"_s},
+        u"A256CTR"_s,
+        QString::fromLatin1(key.toBase64(QByteArray::Base64UrlEncoding | QByteArray::OmitTrailingEquals)),
+        true,
+    };
+    return Quotient::EncryptedFileMetadata{
+        {},
+        jwk,
+        QString::fromLatin1(iv.toBase64(QByteArray::OmitTrailingEquals)),
+        {{u"sha256"_s, QString::fromLatin1(hash.toBase64(QByteArray::OmitTrailingEquals))}},
+        u"v2"_s,
+    };
+}
@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QByteArray>
+#include <QIODevice>
+#include <QString>
+
+#include <Quotient/events/filesourceinfo.h>
+
+#include <optional>
+
+/**
+ * @brief Encryption of attachments that streams through the file in chunks.
+ *
+ * This produces the same AES-256-CTR ciphertext and metadata as Quotient::encryptFile()
+ * but never holds more than one chunk of the file in memory, so it can be used on
+ * large files and from a worker thread.
+ */
+namespace FileEncryption
+{
+/**
+ * @brief The number of bytes encrypted at a time, a multiple of the AES block size.
+ */
+inline constexpr qint64 defaultChunkSize = 64 * 1024;
+
+/**
+ * @brief Encrypt everything read from @p input with @p key and @p iv and write it to @p output.
+ *
+ * @p chunkSize must be a multiple of the 16 byte AES block size.
+ *
+ * @return The SHA-256 hash of the ciphertext, or an empty array on failure.
+ */
+QByteArray encrypt(QIODevice &input, QIODevice &output, const QByteArray &key, const QByteArray &iv, qint64 chunkSize = defaultChunkSize);
+
+/**
+ * @brief Encrypt the file at @p inputPath with a new random key into @p outputPath.
+ *
+ * @return The metadata needed to decrypt the file once its URL has been set,
+ *         or std::nullopt on failure.
+ */
+std::optional<Quotient::EncryptedFileMetadata> encryptFile(const QString &inputPath, const QString &outputPath);
+}
@@ -3,11 +3,23 @@
 
 #include "filepreview.h"
 
+#include <QGuiApplication>
 #include <QImageReader>
+#include <QPalette>
+#include <QPromise>
+#include <QStringTokenizer>
+#include <QTextCursor>
+#include <QTextDocument>
+#include <QThreadPool>
+#include <QtConcurrentRun>
 
 #ifndef Q_OS_ANDROID
+#include <KSyntaxHighlighting/AbstractHighlighter>
 #include <KSyntaxHighlighting/Definition>
+#include <KSyntaxHighlighting/Format>
 #include <KSyntaxHighlighting/Repository>
+#include <KSyntaxHighlighting/State>
+#include <KSyntaxHighlighting/Theme>
 #endif
 
 #include "fileinfo.h"
@@ -15,6 +27,143 @@
 
 using namespace Blocks;
 
+#ifndef Q_OS_ANDROID
+namespace
+{
+/**
+ * The single thread that all text previews are highlighted on.
+ *
+ * A Repository is expensive to build and is not thread safe, so one is shared by
+ * every preview and only ever touched from this thread.
+ */
+QThreadPool *highlightPool()
+{
+    static QThreadPool *pool = [] {
+        const auto pool = new QThreadPool(qApp);
+        pool->setMaxThreadCount(1);
+        pool->setExpiryTimeout(-1);
+        return pool;
+    }();
+    return pool;
+}
+
+KSyntaxHighlighting::Repository &syntaxRepository()
+{
+    static KSyntaxHighlighting::Repository repository;
+    return repository;
+}
+
+/**
+ * Writes highlighted lines into a QTextDocument using the char formats of the theme.
+ */
+class FragmentHighlighter : public KSyntaxHighlighting::AbstractHighlighter
+{
+public:
+    void highlight(QTextCursor &cursor, const QString &line)
+    {
+        m_cursor = &cursor;
+        m_lineStart = cursor.position();
+        cursor.insertText(line, QTextCharFormat());
+        m_state = highlightLine(line, m_state);
+        m_cursor = nullptr;
+    }
+
+protected:
+    void applyFormat(int offset, int length, const KSyntaxHighlighting::Format &format) override
+    {
+        if (length == 0 || format.isDefaultTextStyle(theme())) {
+            return;
+        }
+
+        QTextCharFormat charFormat;
+        if (format.hasTextColor(theme())) {
+            charFormat.setForeground(format.textColor(theme()));
+        }
+        if (format.hasBackgroundColor(theme())) {
+            charFormat.setBackground(format.backgroundColor(theme()));
+        }
+        if (format.isBold(theme())) {
+            charFormat.setFontWeight(QFont::Bold);
+        }
+        if (format.isItalic(theme())) {
+            charFormat.setFontItalic(true);
+        }
+        if (format.isUnderline(theme())) {
+            charFormat.setFontUnderline(true);
+        }
+        if (format.isStrikeThrough(theme())) {
+            charFormat.setFontStrikeOut(true);
+        }
+
+        QTextCursor cursor(*m_cursor);
+        cursor.setPosition(m_lineStart + offset);
+        cursor.setPosition(m_lineStart + offset + length, QTextCursor::KeepAnchor);
+        cursor.mergeCharFormat(charFormat);
+    }
+
+private:
+    QTextCursor *m_cursor = nullptr;
+    int m_lineStart = 0;
+    KSyntaxHighlighting::State m_state;
+};
+
+void highlightFile(QPromise<FilePreviewBlockLoader::Chunk> &promise, const QString &path, const QString &mimeTypeName, const QPalette &palette)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Failed to open" << path << file.errorString();
+        promise.addResult({});
+        return;
+    }
+
+    auto data = file.read(FilePreviewBlockLoader::MaxPreviewBytes);
+    if (!file.atEnd()) {
+        // Don't leave a partial line (or a partial UTF-8 sequence) at the end.
+        const auto lastNewLine = data.lastIndexOf('\n');
+        if (lastNewLine > 0) {
+            data.truncate(lastNewLine);
+        }
+    }
+    const auto text = QString::fromUtf8(data);
+    data.clear();
+
+    auto &repository = syntaxRepository();
+    auto definition = repository.definitionForFileName(path);
+    if (!definition.isValid()) {
+        definition = repository.definitionForMimeType(mimeTypeName);
+    }
+
+    FragmentHighlighter highlighter;
+    highlighter.setDefinition(definition);
+    highlighter.setTheme(repository.themeForPalette(palette));
+
+    QTextDocument document;
+    QTextCursor cursor(&document);
+    int lines = 0;
+    bool first = true;
+    for (const auto line : QStringTokenizer{text, u'\n'}) {
+        if (promise.isCanceled()) {
+            return;
+        }
+        if (lines > 0) {
+            cursor.insertBlock();
+        }
+        highlighter.highlight(cursor, line.toString());
+        if (++lines == FilePreviewBlockLoader::ChunkLines) {
+            promise.addResult({first ? definition.name() : QString(), QTextDocumentFragment(&document)});
+            first = false;
+            document.clear();
+            cursor = QTextCursor(&document);
+            lines = 0;
+        }
+    }
+    if (lines > 0 || first) {
+        promise.addResult({first ? definition.name() : QString(), QTextDocumentFragment(&document)});
+    }
+}
+}
+#endif
+
 FilePreviewBlockLoader::FilePreviewBlockLoader(QObject *parent, const QUrl &source)
     : QObject(parent)
     , m_source(source)
@@ -51,29 +200,23 @@ FilePreviewBlockLoader::FilePreviewBlockLoader(QObject *parent, const QUrl &sour
 #endif
 }
 
+FilePreviewBlockLoader::~FilePreviewBlockLoader()
+{
+#ifndef Q_OS_ANDROID
+    if (m_highlightWatcher) {
+        m_highlightWatcher->cancel();
+    }
+#endif
+}
+
 void FilePreviewBlockLoader::blockForFile()
 {
 #ifndef Q_OS_ANDROID
     const QMimeType mimeType = FileType::instance().mimeTypeForFile(m_source.toString());
     if (mimeType.inherits(u"text/plain"_s)) {
-        KSyntaxHighlighting::Repository repository;
-        KSyntaxHighlighting::Definition definitionForFile = repository.definitionForFileName(m_source.toString());
-        if (!definitionForFile.isValid()) {
-            definitionForFile = repository.definitionForMimeType(mimeType.name());
-        }
-
-        QFile file(m_source.path());
-        auto ok = file.open(QIODevice::ReadOnly);
-        if (!ok) {
-            qWarning() << "Failed to open" << m_source.path() << file.errorString();
-        }
-
-        m_previewBlock = new Blocks::CodeBlock(Blocks::Code,
-                                               QTextDocumentFragment::fromPlainText(QString::fromStdString(file.readAll().toStdString())),
-                                               definitionForFile.name(),
-                                               parent());
-        m_state = Available;
-        Q_EMIT blockAvailable();
+        m_highlightWatcher = new QFutureWatcher<Chunk>(this);
+        connect(m_highlightWatcher, &QFutureWatcher<Chunk>::resultReadyAt, this, &FilePreviewBlockLoader::chunkReady);
+        m_highlightWatcher->setFuture(QtConcurrent::run(highlightPool(), &highlightFile, m_source.path(), mimeType.name(), QGuiApplication::palette()));
         return;
     }
 #endif
@@ -92,6 +235,21 @@ void FilePreviewBlockLoader::blockForFile()
     Q_EMIT blockUnavailable();
 }
 
+#ifndef Q_OS_ANDROID
+void FilePreviewBlockLoader::chunkReady(int index)
+{
+    const auto chunk = m_highlightWatcher->resultAt(index);
+    if (const auto codeBlock = qobject_cast<CodeBlock *>(m_previewBlock)) {
+        codeBlock->appendFragment(chunk.fragment);
+        return;
+    }
+
+    m_previewBlock = new Blocks::CodeBlock(Blocks::Code, chunk.fragment, chunk.language, true, parent());
+    m_state = Available;
+    Q_EMIT blockAvailable();
+}
+#endif
+
 Block *FilePreviewBlockLoader::previewBlock()
 {
     return m_previewBlock;
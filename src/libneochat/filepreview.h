@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <QFutureWatcher>
 #include <QObject>
+#include <QTextDocumentFragment>
 #include <QUrl>
 
 #include "block.h"
@@ -24,6 +26,10 @@ namespace Blocks
  *  - Text (or anything that can be opened as such)
  *  - Pdfs
  *  - Itinerary - anything that KItinerary's extractor can produce a model for
+ *
+ * Text files are read and highlighted on a worker thread. Only the first
+ * MaxPreviewBytes of the file are shown and the block becomes available as soon
+ * as the first ChunkLines lines are ready, with the rest appended as they arrive.
  */
 class FilePreviewBlockLoader : public QObject
 {
@@ -40,7 +46,28 @@ public:
         Unavailable, /**< The loader has failed to load a block for the given source. */
     };
 
+    /**
+     * @brief The maximum number of bytes of a text file that will be previewed.
+     */
+    static constexpr qint64 MaxPreviewBytes = 256 * 1024;
+
+    /**
+     * @brief The number of highlighted lines delivered to a text preview at a time.
+     */
+    static constexpr int ChunkLines = 200;
+
+    /**
+     * @brief A highlighted part of a text file.
+     *
+     * The language is only set for the first chunk.
+     */
+    struct Chunk {
+        QString language;
+        QTextDocumentFragment fragment;
+    };
+
     FilePreviewBlockLoader(QObject *parent, const QUrl &source);
+    ~FilePreviewBlockLoader() override;
 
     /**
      * @brief The block to preview the file.
@@ -71,6 +98,9 @@ private:
     Block *m_previewBlock = nullptr;
     void blockForFile();
 
+    QFutureWatcher<Chunk> *m_highlightWatcher = nullptr;
+    void chunkReady(int index);
+
     State m_state = NotStarted;
 };
 }
@@ -51,9 +51,31 @@ void FileTransferPseudoJob::fileTransferCanceled(const QString &id)
     emitResult();
 }
 
+void FileTransferPseudoJob::setEventId(const QString &eventId)
+{
+    m_eventId = eventId;
+    emitDescription();
+}
+
+void FileTransferPseudoJob::setPreparationProgress(int progress, int total)
+{
+    if (total > 0) {
+        setPercent(progress * 100 / total);
+    }
+}
+
 void FileTransferPseudoJob::start()
 {
     setTotalAmount(Unit::Files, 1);
+    emitDescription();
+}
+
+void FileTransferPseudoJob::emitDescription()
+{
+    if (m_operation == Upload && m_eventId.isEmpty()) {
+        Q_EMIT description(this, i18nc("Job heading, like 'Copying'", "Preparing upload"), {i18nc("The URL being downloaded/uploaded", "Source"), m_path});
+        return;
+    }
     Q_EMIT description(this,
                        m_operation == Download ? i18nc("Job heading, like 'Copying'", "Downloading") : i18nc("Job heading, like 'Copying'", "Uploading"),
                        {i18nc("The URL being downloaded/uploaded", "Source"), m_path},
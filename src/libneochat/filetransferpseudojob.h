@@ -44,6 +44,18 @@ public:
      */
     void fileTransferCanceled(const QString &id);
 
+    /**
+     * @brief Set the id of the transfer to follow.
+     *
+     * Used for uploads, which only get an id once the file has been prepared and posted.
+     */
+    void setEventId(const QString &eventId);
+
+    /**
+     * @brief Report how far preparing the file for upload has got.
+     */
+    void setPreparationProgress(int progress, int total);
+
     /**
      * @brief Start the file transfer.
      */
@@ -56,6 +68,8 @@ Q_SIGNALS:
     void cancelRequested(const QString &id);
 
 private:
+    void emitDescription();
+
     QString m_path;
     QString m_eventId;
     Operation m_operation;
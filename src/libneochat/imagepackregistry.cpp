@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "imagepackregistry.h"
+
+#include <QJsonObject>
+
+#include <algorithm>
+
+#include <Quotient/connection.h>
+#include <Quotient/room.h>
+
+using namespace Quotient;
+using namespace Qt::StringLiterals;
+
+ImagePackRegistry *ImagePackRegistry::forConnection(Connection *connection)
+{
+    if (!connection) {
+        return nullptr;
+    }
+
+    static QHash<const Connection *, ImagePackRegistry *> registries;
+    auto &registry = registries[connection];
+    if (!registry) {
+        registry = new ImagePackRegistry(connection);
+        connect(connection, &QObject::destroyed, [connection] {
+            registries.remove(connection);
+        });
+    }
+    return registry;
+}
+
+ImagePackRegistry::ImagePackRegistry(Connection *connection)
+    : QObject(connection)
+    , m_connection(connection)
+{
+    connect(connection, &Connection::accountDataChanged, this, [this](const QString &type) {
+        if (type == "im.ponies.user_emotes"_L1) {
+            loadAccountPack();
+            Q_EMIT accountPackChanged();
+        } else if (type == "im.ponies.emote_rooms"_L1) {
+            loadSubscriptions();
+            Q_EMIT packsChanged();
+        }
+    });
+    connect(connection, &Connection::newRoom, this, [this](Room *room) {
+        if (m_subscriptions.contains(room->id())) {
+            trackRoom(room);
+            Q_EMIT packsChanged();
+        }
+    });
+    connect(connection, &Connection::aboutToDeleteRoom, this, [this](Room *room) {
+        m_rooms.remove(room->id());
+    });
+
+    loadAccountPack();
+    loadSubscriptions();
+}
+
+ImagePackRegistry::Usages ImagePackRegistry::usages(const std::optional<QStringList> &usage)
+{
+    if (!usage) {
+        return Emoticon | Sticker;
+    }
+    Usages usages;
+    if (usage->contains("emoticon"_L1)) {
+        usages |= Emoticon;
+    }
+    if (usage->contains("sticker"_L1)) {
+        usages |= Sticker;
+    }
+    return usages;
+}
+
+const std::optional<ImagePackEventContent> &ImagePackRegistry::accountPack() const
+{
+    return m_accountPack;
+}
+
+QList<ImagePackRegistry::Pack> ImagePackRegistry::subscribedPacks(Usages usages) const
+{
+    QList<Pack> packs;
+    for (auto it = m_subscriptions.cbegin(); it != m_subscriptions.cend(); ++it) {
+        const auto roomIt = m_rooms.constFind(it.key());
+        if (roomIt == m_rooms.cend()) {
+            continue;
+        }
+        for (const auto &stateKey : it.value()) {
+            const auto pack = std::ranges::find(roomIt->packs, stateKey, &Pack::stateKey);
+            if (pack != roomIt->packs.cend() && (pack->usages & usages) && !pack->content.images.isEmpty()) {
+                packs += *pack;
+            }
+        }
+    }
+    return packs;
+}
+
+QList<ImagePackRegistry::Pack> ImagePackRegistry::roomPacks(Room *room)
+{
+    if (!room) {
+        return {};
+    }
+    return trackRoom(room).packs;
+}
+
+void ImagePackRegistry::loadAccountPack()
+{
+    m_accountPack.reset();
+    const auto &data = m_connection->accountData("im.ponies.user_emotes"_L1);
+    if (!data) {
+        return;
+    }
+
+    auto json = data->contentJson();
+    auto images = json["images"_L1].toObject();
+    // TODO: Remove with stable migration
+    const auto legacyImages = json["emoticons"_L1].toObject();
+    for (auto it = legacyImages.constBegin(); it != legacyImages.constEnd(); ++it) {
+        if (!images.contains(it.key())) {
+            images.insert(it.key(), it.value());
+        }
+    }
+    json["images"_L1] = images;
+    m_accountPack.emplace(json);
+}
+
+void ImagePackRegistry::loadSubscriptions()
+{
+    m_subscriptions.clear();
+    const auto &data = m_connection->accountData("im.ponies.emote_rooms"_L1);
+    if (!data) {
+        return;
+    }
+
+    const auto rooms = data->contentJson()["rooms"_L1].toObject();
+    for (auto it = rooms.constBegin(); it != rooms.constEnd(); ++it) {
+        m_subscriptions.insert(it.key(), it.value().toObject().keys());
+        if (const auto room = m_connection->room(it.key())) {
+            trackRoom(room);
+        }
+    }
+}
+
+const ImagePackRegistry::RoomPacks &ImagePackRegistry::trackRoom(Room *room)
+{
+    if (const auto it = m_rooms.constFind(room->id()); it != m_rooms.cend()) {
+        return *it;
+    }
+
+    connect(room, &Room::changed, this, [this, room] {
+        if (updateRoom(room)) {
+            Q_EMIT packsChanged();
+        }
+    });
+    updateRoom(room);
+    return m_rooms[room->id()];
+}
+
+bool ImagePackRegistry::updateRoom(Room *room)
+{
+    auto events = room->currentState().eventsOfType("im.ponies.room_emotes"_L1);
+    std::ranges::sort(events, {}, &StateEvent::stateKey);
+    QStringList eventIds;
+    eventIds.reserve(events.size());
+    for (const auto &event : events) {
+        eventIds += event->id();
+    }
+
+    auto &roomPacks = m_rooms[room->id()];
+    if (eventIds == roomPacks.eventIds) {
+        return false;
+    }
+
+    roomPacks.eventIds = eventIds;
+    roomPacks.packs.clear();
+    for (const auto &event : events) {
+        const auto content = eventCast<const ImagePackEvent>(event)->content();
+        roomPacks.packs += Pack{
+            room->id(),
+            event->stateKey(),
+            content.pack ? usages(content.pack->usage) : (Emoticon | Sticker),
+            content,
+        };
+    }
+    return true;
+}
+
+#include "moc_imagepackregistry.cpp"
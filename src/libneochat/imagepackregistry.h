@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QObject>
+#include <QStringList>
+
+#include <optional>
+
+#include "events/imagepackevent.h"
+
+namespace Quotient
+{
+class Connection;
+class Room;
+}
+
+/**
+ * @class ImagePackRegistry
+ *
+ * The image packs available to an account: the account's own pack, the packs of
+ * rooms and the room packs the account subscribed to in "im.ponies.emote_rooms".
+ *
+ * Packs are parsed once and then only parsed again when the account data or the
+ * pack state events of a room change, so listing them doesn't touch any JSON.
+ * The usage of each pack is parsed into flags as well.
+ *
+ * See Matrix MSC2545 for more details on image packs.
+ * https://github.com/Sorunome/matrix-doc/blob/soru/emotes/proposals/2545-emotes.md
+ *
+ * @sa ImagePacksModel, CustomEmojiModel
+ */
+class ImagePackRegistry : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief What a pack can be used for.
+     */
+    enum Usage {
+        Emoticon = 0x1,
+        Sticker = 0x2,
+    };
+    Q_DECLARE_FLAGS(Usages, Usage)
+
+    /**
+     * @brief A pack defined in the state of a room.
+     */
+    struct Pack {
+        QString roomId;
+        QString stateKey;
+        /**
+         * @brief The usages of the pack; both if the pack doesn't say.
+         */
+        Usages usages;
+        Quotient::ImagePackEventContent content;
+    };
+
+    /**
+     * @brief The registry of the given connection, created on first use.
+     *
+     * The registry is destroyed with the connection.
+     */
+    static ImagePackRegistry *forConnection(Quotient::Connection *connection);
+
+    /**
+     * @brief Parse the "usage" key of a pack into flags.
+     *
+     * No usage means both; an empty list means none.
+     */
+    static Usages usages(const std::optional<QStringList> &usage);
+
+    /**
+     * @brief The account's own pack from "im.ponies.user_emotes", if there is one.
+     *
+     * Images in the legacy "emoticons" key are included.
+     */
+    const std::optional<Quotient::ImagePackEventContent> &accountPack() const;
+
+    /**
+     * @brief The subscribed packs that have images and one of the given usages.
+     *
+     * The packs are ordered by room id and then state key.
+     */
+    QList<Pack> subscribedPacks(Usages usages) const;
+
+    /**
+     * @brief All packs defined in the state of the given room, ordered by state key.
+     *
+     * From now on, the packs of the room are kept up to date.
+     */
+    QList<Pack> roomPacks(Quotient::Room *room);
+
+Q_SIGNALS:
+    /**
+     * @brief The account's own pack changed.
+     */
+    void accountPackChanged();
+
+    /**
+     * @brief The subscriptions or the packs of a tracked room changed.
+     */
+    void packsChanged();
+
+private:
+    explicit ImagePackRegistry(Quotient::Connection *connection);
+
+    struct RoomPacks {
+        // The ids of the pack state events the packs were parsed from.
+        QStringList eventIds;
+        QList<Pack> packs;
+    };
+
+    void loadAccountPack();
+    void loadSubscriptions();
+    const RoomPacks &trackRoom(Quotient::Room *room);
+    // Returns whether the packs changed.
+    bool updateRoom(Quotient::Room *room);
+
+    Quotient::Connection *m_connection;
+    std::optional<Quotient::ImagePackEventContent> m_accountPack;
+    // Room id to the subscribed state keys.
+    QMap<QString, QStringList> m_subscriptions;
+    QHash<QString, RoomPacks> m_rooms;
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(ImagePackRegistry::Usages)
@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "itineraryextractor.h"
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QJsonDocument>
+#include <QProcess>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QtConcurrentRun>
+
+#include "config-neochat.h"
+
+using namespace Qt::StringLiterals;
+
+namespace
+{
+struct Lookup {
+    QByteArray hash;
+    ItineraryExtractor::Result cached;
+};
+
+Lookup lookup(const QString &path, const QString &cacheDirectory)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return {};
+    }
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    if (!hash.addData(&file)) {
+        return {};
+    }
+
+    Lookup result{hash.result().toHex(), std::nullopt};
+    QFile cacheFile(cacheDirectory + u'/' + QString::fromLatin1(result.hash) + u".json"_s);
+    if (cacheFile.open(QIODevice::ReadOnly)) {
+        const auto document = QJsonDocument::fromJson(cacheFile.readAll());
+        if (document.isArray()) {
+            result.cached = document.array();
+        }
+    }
+    return result;
+}
+}
+
+ItineraryExtractor &ItineraryExtractor::instance()
+{
+    static ItineraryExtractor _instance(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + u"/itinerary"_s);
+    return _instance;
+}
+
+ItineraryExtractor::ItineraryExtractor(const QString &cacheDirectory, QObject *parent)
+    : QObject(parent)
+    , m_cacheDirectory(cacheDirectory)
+    , m_extractorPath("%1%2"_L1.arg(CMAKE_INSTALL_FULL_LIBEXECDIR_KF6, "/kitinerary-extractor"_L1))
+{
+}
+
+QString ItineraryExtractor::extractorPath() const
+{
+    return m_extractorPath;
+}
+
+void ItineraryExtractor::setExtractorPath(const QString &extractorPath)
+{
+    m_extractorPath = extractorPath;
+}
+
+int ItineraryExtractor::maxProcesses() const
+{
+    return m_maxProcesses;
+}
+
+void ItineraryExtractor::setMaxProcesses(int maxProcesses)
+{
+    m_maxProcesses = std::max(1, maxProcesses);
+    startNext();
+}
+
+int ItineraryExtractor::runningCount() const
+{
+    return m_running;
+}
+
+int ItineraryExtractor::queuedCount() const
+{
+    return m_queue.size();
+}
+
+QFuture<ItineraryExtractor::Result> ItineraryExtractor::extract(const QString &path)
+{
+    const auto promise = std::make_shared<QPromise<Result>>();
+    promise->start();
+    const auto future = promise->future();
+
+    QtConcurrent::run(&lookup, path, m_cacheDirectory).then(this, [this, path, promise](const Lookup &lookup) {
+        if (lookup.hash.isEmpty() || lookup.cached) {
+            promise->addResult(lookup.cached);
+            promise->finish();
+            return;
+        }
+        enqueue(lookup.hash, path, promise);
+    });
+    return future;
+}
+
+void ItineraryExtractor::clearCache()
+{
+    QDir(m_cacheDirectory).removeRecursively();
+}
+
+QString ItineraryExtractor::cacheFile(const QByteArray &hash) const
+{
+    return m_cacheDirectory + u'/' + QString::fromLatin1(hash) + u".json"_s;
+}
+
+void ItineraryExtractor::enqueue(const QByteArray &hash, const QString &path, const PromisePtr &promise)
+{
+    // The same file is already queued or being extracted, wait for that instead.
+    if (const auto it = m_requests.find(hash); it != m_requests.end()) {
+        it->waiters += promise;
+        return;
+    }
+
+    m_requests.insert(hash, {path, {promise}});
+    m_queue.enqueue(hash);
+    startNext();
+}
+
+void ItineraryExtractor::startNext()
+{
+    while (m_running < m_maxProcesses && !m_queue.isEmpty()) {
+        const auto hash = m_queue.dequeue();
+        ++m_running;
+
+        auto process = new QProcess(this);
+        connect(process, &QProcess::finished, this, [this, process, hash](int exitCode, QProcess::ExitStatus exitStatus) {
+            process->deleteLater();
+            --m_running;
+
+            if (exitStatus != QProcess::NormalExit || exitCode != 0) {
+                finish(hash, std::nullopt);
+            } else {
+                const auto data = QJsonDocument::fromJson(process->readAllStandardOutput()).array();
+                QDir().mkpath(m_cacheDirectory);
+                QSaveFile file(cacheFile(hash));
+                if (file.open(QIODevice::WriteOnly)) {
+                    file.write(QJsonDocument(data).toJson(QJsonDocument::Compact));
+                    file.commit();
+                }
+                finish(hash, data);
+            }
+            startNext();
+        });
+        connect(process, &QProcess::errorOccurred, this, [this, process, hash](QProcess::ProcessError error) {
+            // Every other error is followed by finished().
+            if (error != QProcess::FailedToStart) {
+                return;
+            }
+            qWarning() << "Failed to start" << m_extractorPath << process->errorString();
+            process->deleteLater();
+            --m_running;
+            finish(hash, std::nullopt);
+            startNext();
+        });
+        process->start(m_extractorPath, {m_requests[hash].path});
+    }
+}
+
+void ItineraryExtractor::finish(const QByteArray &hash, const Result &result)
+{
+    const auto request = m_requests.take(hash);
+    for (const auto &promise : request.waiters) {
+        promise->addResult(result);
+        promise->finish();
+    }
+}
+
+#include "moc_itineraryextractor.cpp"
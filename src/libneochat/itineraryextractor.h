@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QByteArray>
+#include <QFuture>
+#include <QHash>
+#include <QJsonArray>
+#include <QObject>
+#include <QPromise>
+#include <QQueue>
+
+#include <memory>
+#include <optional>
+
+/**
+ * @class ItineraryExtractor
+ *
+ * Runs kitinerary-extractor over local files and remembers what it found.
+ *
+ * Results are cached on disk by the SHA-256 hash of the file contents, so a file
+ * is only ever extracted once, also across restarts. Requests for a file that is
+ * already being extracted share the running extraction, and no more than
+ * maxProcesses() extractor processes run at the same time; the rest are queued.
+ *
+ * @note Not thread safe, use it from the GUI thread only.
+ */
+class ItineraryExtractor : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief The reservations found in a file, or std::nullopt if the extractor could not be run.
+     */
+    using Result = std::optional<QJsonArray>;
+
+    static ItineraryExtractor &instance();
+
+    /**
+     * @brief Create an extractor that caches its results in @p cacheDirectory.
+     */
+    explicit ItineraryExtractor(const QString &cacheDirectory, QObject *parent = nullptr);
+
+    /**
+     * @brief The path of the extractor executable.
+     *
+     * Defaults to the kitinerary-extractor installed with KItinerary.
+     */
+    QString extractorPath() const;
+    void setExtractorPath(const QString &extractorPath);
+
+    /**
+     * @brief The maximum number of extractor processes running at the same time.
+     */
+    int maxProcesses() const;
+    void setMaxProcesses(int maxProcesses);
+
+    /**
+     * @brief The number of extractor processes currently running.
+     */
+    int runningCount() const;
+
+    /**
+     * @brief The number of files waiting for a free extractor process.
+     */
+    int queuedCount() const;
+
+    /**
+     * @brief Extract the reservations from the file at @p path.
+     *
+     * The file is hashed on a worker thread; the returned future finishes on the
+     * GUI thread.
+     */
+    QFuture<Result> extract(const QString &path);
+
+    /**
+     * @brief Remove all cached results.
+     */
+    void clearCache();
+
+private:
+    using PromisePtr = std::shared_ptr<QPromise<Result>>;
+
+    struct Request {
+        QString path;
+        QList<PromisePtr> waiters;
+    };
+
+    QString cacheFile(const QByteArray &hash) const;
+    void enqueue(const QByteArray &hash, const QString &path, const PromisePtr &promise);
+    void startNext();
+    void finish(const QByteArray &hash, const Result &result);
+
+    QString m_cacheDirectory;
+    QString m_extractorPath;
+    int m_maxProcesses = 2;
+    int m_running = 0;
+    QHash<QByteArray, Request> m_requests;
+    QQueue<QByteArray> m_queue;
+};
@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "markdownsyntaxtrie.h"
+
+#include <algorithm>
+
+using namespace Qt::StringLiterals;
+
+const QList<MarkdownSyntaxTrie::Syntax> &MarkdownSyntaxTrie::syntax()
+{
+    static const QList<Syntax> syntax = {
+        Syntax{.sequence = "*"_L1, .closable = true, .format = RichFormat::Italic},
+        Syntax{.sequence = "**"_L1, .closable = true, .format = RichFormat::Bold},
+        Syntax{.sequence = "# "_L1, .lineStart = true, .format = RichFormat::Heading1},
+        Syntax{.sequence = " # "_L1, .lineStart = true, .format = RichFormat::Heading1},
+        Syntax{.sequence = "  # "_L1, .lineStart = true, .format = RichFormat::Heading1},
+        Syntax{.sequence = "   # "_L1, .lineStart = true, .format = RichFormat::Heading1},
+        Syntax{.sequence = "## "_L1, .lineStart = true, .format = RichFormat::Heading2},
+        Syntax{.sequence = " ## "_L1, .lineStart = true, .format = RichFormat::Heading2},
+        Syntax{.sequence = "  ## "_L1, .lineStart = true, .format = RichFormat::Heading2},
+        Syntax{.sequence = "   ## "_L1, .lineStart = true, .format = RichFormat::Heading2},
+        Syntax{.sequence = "### "_L1, .lineStart = true, .format = RichFormat::Heading3},
+        Syntax{.sequence = " ### "_L1, .lineStart = true, .format = RichFormat::Heading3},
+        Syntax{.sequence = "  ### "_L1, .lineStart = true, .format = RichFormat::Heading3},
+        Syntax{.sequence = "   ### "_L1, .lineStart = true, .format = RichFormat::Heading3},
+        Syntax{.sequence = "#### "_L1, .lineStart = true, .format = RichFormat::Heading4},
+        Syntax{.sequence = " #### "_L1, .lineStart = true, .format = RichFormat::Heading4},
+        Syntax{.sequence = "  #### "_L1, .lineStart = true, .format = RichFormat::Heading4},
+        Syntax{.sequence = "   #### "_L1, .lineStart = true, .format = RichFormat::Heading4},
+        Syntax{.sequence = "##### "_L1, .lineStart = true, .format = RichFormat::Heading5},
+        Syntax{.sequence = " ##### "_L1, .lineStart = true, .format = RichFormat::Heading5},
+        Syntax{.sequence = "  ##### "_L1, .lineStart = true, .format = RichFormat::Heading5},
+        Syntax{.sequence = "   ##### "_L1, .lineStart = true, .format = RichFormat::Heading5},
+        Syntax{.sequence = "###### "_L1, .lineStart = true, .format = RichFormat::Heading6},
+        Syntax{.sequence = " ###### "_L1, .lineStart = true, .format = RichFormat::Heading6},
+        Syntax{.sequence = "  ###### "_L1, .lineStart = true, .format = RichFormat::Heading6},
+        Syntax{.sequence = "   ###### "_L1, .lineStart = true, .format = RichFormat::Heading6},
+        Syntax{.sequence = ">"_L1, .lineStart = true, .format = RichFormat::Quote},
+        Syntax{.sequence = " >"_L1, .lineStart = true, .format = RichFormat::Quote},
+        Syntax{.sequence = "  >"_L1, .lineStart = true, .format = RichFormat::Quote},
+        Syntax{.sequence = "   >"_L1, .lineStart = true, .format = RichFormat::Quote},
+        Syntax{.sequence = "> "_L1, .lineStart = true, .format = RichFormat::Quote},
+        Syntax{.sequence = " > "_L1, .lineStart = true, .format = RichFormat::Quote},
+        Syntax{.sequence = "  > "_L1, .lineStart = true, .format = RichFormat::Quote},
+        Syntax{.sequence = "   > "_L1, .lineStart = true, .format = RichFormat::Quote},
+        Syntax{.sequence = "* "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
+        Syntax{.sequence = " * "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
+        Syntax{.sequence = "  * "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
+        Syntax{.sequence = "   * "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
+        Syntax{.sequence = "- "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
+        Syntax{.sequence = " - "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
+        Syntax{.sequence = "  - "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
+        Syntax{.sequence = "   - "_L1, .lineStart = true, .format = RichFormat::UnorderedList},
+        Syntax{.sequence = "1. "_L1, .lineStart = true, .format = RichFormat::OrderedList},
+        Syntax{.sequence = " 1. "_L1, .lineStart = true, .format = RichFormat::OrderedList},
+        Syntax{.sequence = "  1. "_L1, .lineStart = true, .format = RichFormat::OrderedList},
+        Syntax{.sequence = "   1. "_L1, .lineStart = true, .format = RichFormat::OrderedList},
+        Syntax{.sequence = "1) "_L1, .lineStart = true, .format = RichFormat::OrderedList},
+        Syntax{.sequence = " 1) "_L1, .lineStart = true, .format = RichFormat::OrderedList},
+        Syntax{.sequence = "  1) "_L1, .lineStart = true, .format = RichFormat::OrderedList},
+        Syntax{.sequence = "   1) "_L1, .lineStart = true, .format = RichFormat::OrderedList},
+        Syntax{.sequence = "`"_L1, .closable = true, .format = RichFormat::InlineCode},
+        Syntax{.sequence = "```"_L1, .lineStart = true, .format = RichFormat::Code},
+        Syntax{.sequence = " ```"_L1, .lineStart = true, .format = RichFormat::Code},
+        Syntax{.sequence = "  ```"_L1, .lineStart = true, .format = RichFormat::Code},
+        Syntax{.sequence = "   ```"_L1, .lineStart = true, .format = RichFormat::Code},
+        Syntax{.sequence = "~~"_L1, .closable = true, .format = RichFormat::Strikethrough},
+        Syntax{.sequence = "_"_L1, .closable = true, .format = RichFormat::Underline},
+    };
+    return syntax;
+}
+
+const MarkdownSyntaxTrie &MarkdownSyntaxTrie::instance()
+{
+    static const MarkdownSyntaxTrie trie(syntax());
+    return trie;
+}
+
+MarkdownSyntaxTrie::MarkdownSyntaxTrie(const QList<Syntax> &syntax)
+    : m_syntax(syntax)
+{
+    QList<int> parents;
+    QList<int> reversedParents;
+    insert(m_nodes, parents, {});
+    insert(m_reversedNodes, reversedParents, {});
+
+    for (int i = 0; i < m_syntax.size(); ++i) {
+        const QString sequence = m_syntax[i].sequence;
+        auto &node = m_nodes[insert(m_nodes, parents, sequence)];
+        node.syntax = i;
+        node.reachable = {!m_syntax[i].lineStart, true};
+
+        auto reversed = sequence;
+        std::reverse(reversed.begin(), reversed.end());
+        insert(m_reversedNodes, reversedParents, reversed);
+    }
+
+    // Children always come after their parent.
+    for (auto i = m_nodes.size() - 1; i > 0; --i) {
+        auto &parent = m_nodes[parents[i]];
+        for (int lineStart = 0; lineStart < 2; ++lineStart) {
+            m_nodes[i].reachable[lineStart] = m_nodes[i].reachable[lineStart] || m_nodes[i].reachableBelow[lineStart];
+            parent.reachableBelow[lineStart] = parent.reachableBelow[lineStart] || m_nodes[i].reachable[lineStart];
+        }
+    }
+}
+
+int MarkdownSyntaxTrie::insert(QList<Node> &nodes, QList<int> &parents, QStringView sequence)
+{
+    const auto newNode = [&nodes, &parents](int parent) {
+        Node node;
+        node.children.fill(Dead);
+        nodes += node;
+        parents += parent;
+        return int(nodes.size() - 1);
+    };
+
+    if (nodes.isEmpty()) {
+        newNode(Dead);
+    }
+
+    int state = Root;
+    for (const auto c : sequence) {
+        Q_ASSERT(c.unicode() < AlphabetSize);
+        auto next = nodes[state].children[c.unicode()];
+        if (next == Dead) {
+            next = newNode(state);
+            nodes[state].children[c.unicode()] = next;
+        }
+        state = next;
+    }
+    return state;
+}
+
+int MarkdownSyntaxTrie::child(const QList<Node> &nodes, int state, QChar c)
+{
+    if (state == Dead || c.unicode() >= AlphabetSize) {
+        return Dead;
+    }
+    return nodes[state].children[c.unicode()];
+}
+
+int MarkdownSyntaxTrie::next(int state, QChar c) const
+{
+    return child(m_nodes, state, c);
+}
+
+int MarkdownSyntaxTrie::walk(QStringView text, int state) const
+{
+    for (const auto c : text) {
+        state = next(state, c);
+    }
+    return state;
+}
+
+const MarkdownSyntaxTrie::Syntax *MarkdownSyntaxTrie::match(int state) const
+{
+    if (state == Dead || m_nodes[state].syntax < 0) {
+        return nullptr;
+    }
+    return &m_syntax[m_nodes[state].syntax];
+}
+
+std::optional<bool> MarkdownSyntaxTrie::check(int state, QStringView nextChar, bool lineStart) const
+{
+    if (state == Dead) {
+        return std::nullopt;
+    }
+
+    const auto &node = m_nodes[state];
+    bool longerMatch = false;
+    if (nextChar.isEmpty()) {
+        longerMatch = node.reachableBelow[lineStart];
+    } else if (nextChar.size() == 1) {
+        const auto nextState = next(state, nextChar[0]);
+        longerMatch = nextState != Dead && m_nodes[nextState].reachable[lineStart];
+    }
+    if (longerMatch) {
+        return false;
+    }
+
+    if (node.syntax >= 0 && (!m_syntax[node.syntax].lineStart || lineStart)) {
+        return true;
+    }
+    return std::nullopt;
+}
+
+int MarkdownSyntaxTrie::previous(int state, QChar c) const
+{
+    return child(m_reversedNodes, state, c);
+}
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QList>
+#include <QString>
+
+#include <array>
+#include <optional>
+
+#include "enums/richformat.h"
+
+/**
+ * @class MarkdownSyntaxTrie
+ *
+ * The markdown sequences that ChatMarkdownHelper turns into formatting, compiled into
+ * two tries: one over the sequences and one over the reversed sequences.
+ *
+ * A state is a node of a trie, i.e. a text that starts (or, for the reversed trie,
+ * ends) some sequence. Moving to the next state for a character is a single table
+ * lookup, and everything ChatMarkdownHelper needs to know about the sequences below a
+ * state is precomputed, so no check ever looks at the whole table.
+ *
+ * @sa ChatMarkdownHelper
+ */
+class MarkdownSyntaxTrie
+{
+public:
+    /**
+     * @brief A markdown sequence.
+     */
+    struct Syntax {
+        QLatin1String sequence;
+        /**
+         * @brief Whether the same sequence also ends the format.
+         */
+        bool closable = false;
+        /**
+         * @brief Whether the sequence only counts at the start of a block.
+         */
+        bool lineStart = false;
+        RichFormat::Format format;
+    };
+
+    /**
+     * @brief A state that no text leads out of.
+     */
+    static constexpr int Dead = -1;
+
+    /**
+     * @brief The state of the empty text.
+     */
+    static constexpr int Root = 0;
+
+    /**
+     * @brief The tries of syntax().
+     */
+    static const MarkdownSyntaxTrie &instance();
+
+    /**
+     * @brief The sequences supported in the chat bar.
+     */
+    static const QList<Syntax> &syntax();
+
+    explicit MarkdownSyntaxTrie(const QList<Syntax> &syntax);
+
+    /**
+     * @brief The state after @p state followed by @p c, in the trie of the sequences.
+     */
+    int next(int state, QChar c) const;
+
+    /**
+     * @brief The state after @p state followed by all of @p text.
+     */
+    int walk(QStringView text, int state = Root) const;
+
+    /**
+     * @brief The sequence that ends exactly at @p state, if any.
+     */
+    const Syntax *match(int state) const;
+
+    /**
+     * @brief Check the text of @p state, followed by @p nextChar.
+     *
+     * @return false if a longer sequence starts with the text followed by @p nextChar,
+     *         otherwise true if the text is a sequence itself and std::nullopt if not.
+     *         With an empty @p nextChar, any longer sequence starting with the text counts.
+     *
+     * @param lineStart Whether the text is at the start of a block; otherwise the
+     *                  sequences that only count there are ignored.
+     */
+    std::optional<bool> check(int state, QStringView nextChar, bool lineStart) const;
+
+    /**
+     * @brief The state after @p state preceded by @p c, in the trie of the reversed sequences.
+     *
+     * Anything other than Dead means that the text read so far ends some sequence.
+     */
+    int previous(int state, QChar c) const;
+
+private:
+    // The sequences only use ASCII characters.
+    static constexpr int AlphabetSize = 128;
+
+    struct Node {
+        std::array<qint16, AlphabetSize> children;
+        // The index of the sequence ending here in m_syntax, or -1.
+        int syntax = -1;
+        // Whether this node or one below ends a sequence that counts outside (index 0)
+        // or at (index 1) the start of a block.
+        std::array<bool, 2> reachable = {false, false};
+        // The same, but only counting the nodes below.
+        std::array<bool, 2> reachableBelow = {false, false};
+    };
+
+    // Returns the node the sequence ends at.
+    static int insert(QList<Node> &nodes, QList<int> &parents, QStringView sequence);
+    static int child(const QList<Node> &nodes, int state, QChar c);
+
+    QList<Syntax> m_syntax;
+    QList<Node> m_nodes;
+    QList<Node> m_reversedNodes;
+};
@@ -0,0 +1,235 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "mediathumbnailcache.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QNetworkReply>
+#include <QPromise>
+#include <QStandardPaths>
+#include <QUrlQuery>
+
+#include <Quotient/connection.h>
+#include <Quotient/networkaccessmanager.h>
+
+#include <qcoro/qcorofuture.h>
+#include <qcoro/qcorosignal.h>
+
+using namespace Qt::StringLiterals;
+
+// 200 MiB unless configured otherwise.
+static constexpr qint64 defaultMaxSize = 200 * 1024 * 1024;
+
+MediaThumbnailCache &MediaThumbnailCache::instance()
+{
+    static MediaThumbnailCache _instance(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + u"/thumbnails"_s);
+    return _instance;
+}
+
+QUrl MediaThumbnailCache::imageUrl(const QUrl &mediaUrl)
+{
+    return QUrl(u"image://mxcthumbnail/"_s + mediaUrl.toString(QUrl::RemoveScheme).mid(2));
+}
+
+MediaThumbnailCache::MediaThumbnailCache(const QString &directory, QObject *parent)
+    : QObject(parent)
+    , m_directory(directory)
+    , m_maxSize(defaultMaxSize)
+{
+    QDir().mkpath(m_directory);
+    load();
+}
+
+qint64 MediaThumbnailCache::maxSize() const
+{
+    return m_maxSize;
+}
+
+void MediaThumbnailCache::setMaxSize(qint64 maxSize)
+{
+    m_maxSize = maxSize;
+    evict();
+}
+
+qint64 MediaThumbnailCache::size() const
+{
+    return m_size;
+}
+
+QString MediaThumbnailCache::fileName(const Key &key)
+{
+    const auto id = u"%1\n%2x%3\n%4"_s.arg(key.mxc.toString(QUrl::RemoveQuery | QUrl::RemoveFragment),
+                                           QString::number(key.size.width()),
+                                           QString::number(key.size.height()),
+                                           key.method);
+    return QString::fromLatin1(QCryptographicHash::hash(id.toUtf8(), QCryptographicHash::Sha256).toHex());
+}
+
+void MediaThumbnailCache::load()
+{
+    const auto files = QDir(m_directory).entryInfoList(QDir::Files, QDir::Time | QDir::Reversed);
+    for (const auto &file : files) {
+        const auto position = m_order.insert(m_order.end(), file.fileName());
+        m_entries.insert(file.fileName(), {.size = file.size(), .position = position});
+        m_size += file.size();
+    }
+    evict();
+}
+
+bool MediaThumbnailCache::contains(const Key &key) const
+{
+    return m_entries.contains(fileName(key));
+}
+
+QByteArray MediaThumbnailCache::find(const Key &key)
+{
+    const auto name = fileName(key);
+    if (!m_entries.contains(name)) {
+        return {};
+    }
+
+    QFile file(m_directory + u'/' + name);
+    if (!file.open(QIODevice::ReadWrite)) {
+        // Removed behind our back.
+        remove(key);
+        return {};
+    }
+    const auto data = file.readAll();
+    file.setFileTime(QDateTime::currentDateTimeUtc(), QFileDevice::FileModificationTime);
+    touch(name);
+    return data;
+}
+
+void MediaThumbnailCache::touch(const QString &name)
+{
+    auto &entry = m_entries[name];
+    m_order.splice(m_order.end(), m_order, entry.position);
+}
+
+void MediaThumbnailCache::insert(const Key &key, const QByteArray &data)
+{
+    if (data.isEmpty() || data.size() > m_maxSize) {
+        return;
+    }
+
+    const auto name = fileName(key);
+    QFile file(m_directory + u'/' + name);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(data) != data.size()) {
+        qWarning() << "Failed to write thumbnail to" << file.fileName() << file.errorString();
+        file.remove();
+        return;
+    }
+
+    if (const auto it = m_entries.find(name); it != m_entries.end()) {
+        m_size -= it->size;
+        it->size = data.size();
+        touch(name);
+    } else {
+        const auto position = m_order.insert(m_order.end(), name);
+        m_entries.insert(name, {.size = data.size(), .position = position});
+    }
+    m_size += data.size();
+    evict();
+}
+
+void MediaThumbnailCache::remove(const Key &key)
+{
+    const auto name = fileName(key);
+    const auto it = m_entries.find(name);
+    if (it == m_entries.end()) {
+        return;
+    }
+    QFile::remove(m_directory + u'/' + name);
+    m_size -= it->size;
+    m_order.erase(it->position);
+    m_entries.erase(it);
+}
+
+void MediaThumbnailCache::clear()
+{
+    for (const auto &name : std::as_const(m_order)) {
+        QFile::remove(m_directory + u'/' + name);
+    }
+    m_order.clear();
+    m_entries.clear();
+    m_size = 0;
+}
+
+void MediaThumbnailCache::evict()
+{
+    while (m_size > m_maxSize && !m_order.empty()) {
+        const auto name = m_order.front();
+        QFile::remove(m_directory + u'/' + name);
+        m_size -= m_entries.take(name).size;
+        m_order.pop_front();
+    }
+}
+
+QCoro::Task<QByteArray> MediaThumbnailCache::fetch(Quotient::Connection *connection, const Key &key, bool download)
+{
+    auto url = connection->homeserver();
+    if (download) {
+        url.setPath(u"/_matrix/client/v1/media/download/%1%2"_s.arg(key.mxc.authority(), key.mxc.path()));
+    } else {
+        url.setPath(u"/_matrix/client/v1/media/thumbnail/%1%2"_s.arg(key.mxc.authority(), key.mxc.path()));
+        url.setQuery(QUrlQuery{
+            {u"width"_s, QString::number(key.size.width())},
+            {u"height"_s, QString::number(key.size.height())},
+            {u"method"_s, key.method},
+        });
+    }
+    QNetworkRequest request(url);
+    request.setRawHeader("Authorization", "Bearer " + connection->accessToken());
+
+    const auto reply = Quotient::NetworkAccessManager::instance()->get(request);
+    co_await qCoro(reply, &QNetworkReply::finished);
+    reply->deleteLater();
+    if (reply->error() != QNetworkReply::NoError) {
+        qWarning() << "Failed to load thumbnail" << key.mxc << reply->errorString();
+        co_return {};
+    }
+    co_return reply->readAll();
+}
+
+QCoro::Task<QByteArray> MediaThumbnailCache::thumbnail(Quotient::Connection *connection, Key key, std::optional<Quotient::EncryptedFileMetadata> encryptedFile)
+{
+    if (encryptedFile) {
+        key.size = {};
+        key.method.clear();
+    }
+
+    auto data = find(key);
+    if (data.isEmpty()) {
+        if (!connection || key.mxc.scheme() != u"mxc"_s) {
+            co_return {};
+        }
+
+        const auto name = fileName(key);
+        if (const auto it = m_pendingFetches.constFind(name); it != m_pendingFetches.constEnd()) {
+            // Someone else already asked for it, wait for their answer.
+            data = co_await QFuture<QByteArray>(*it);
+        } else {
+            QPromise<QByteArray> promise;
+            promise.start();
+            m_pendingFetches.insert(name, promise.future());
+            data = co_await fetch(connection, key, encryptedFile.has_value());
+            m_pendingFetches.remove(name);
+            insert(key, data);
+            promise.addResult(data);
+            promise.finish();
+        }
+    }
+
+    if (data.isEmpty()) {
+        co_return {};
+    }
+    if (encryptedFile) {
+        co_return Quotient::decryptFile(data, *encryptedFile);
+    }
+    co_return data;
+}
+
+#include "moc_mediathumbnailcache.cpp"
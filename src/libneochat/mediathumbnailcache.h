@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QByteArray>
+#include <QFuture>
+#include <QHash>
+#include <QObject>
+#include <QSize>
+#include <QUrl>
+
+#include <QCoroTask>
+
+#include <Quotient/events/filesourceinfo.h>
+
+#include <list>
+
+namespace Quotient
+{
+class Connection;
+}
+
+/**
+ * @class MediaThumbnailCache
+ *
+ * An on-disk cache for media thumbnails.
+ *
+ * Entries are keyed by the mxc URI, the thumbnail size and the resize method and
+ * stored in files named after the SHA-256 hash of that key. When the cache grows
+ * past its size budget the least recently used entries are removed. The order of
+ * use is kept in the files' modification times, so it survives restarts.
+ *
+ * Media from encrypted rooms is stored as the ciphertext that came from the server
+ * and decrypted when it is read, so it is never written to disk in the clear.
+ *
+ * @note Not thread safe, use it from the GUI thread only.
+ */
+class MediaThumbnailCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Identifies a cached thumbnail.
+     *
+     * Encrypted media can't be thumbnailed by the server and uses an empty size and method.
+     */
+    struct Key {
+        QUrl mxc;
+        QSize size;
+        QString method;
+    };
+
+    static MediaThumbnailCache &instance();
+
+    /**
+     * @brief The image provider URL that loads the thumbnail for @p mediaUrl through the cache.
+     *
+     * @param mediaUrl An mxc URL as made by NeoChatRoom::makeMediaUrl().
+     */
+    static QUrl imageUrl(const QUrl &mediaUrl);
+
+    /**
+     * @brief Create a cache that stores its files in @p directory.
+     */
+    explicit MediaThumbnailCache(const QString &directory, QObject *parent = nullptr);
+
+    /**
+     * @brief The maximum number of bytes stored before old entries are evicted.
+     */
+    qint64 maxSize() const;
+    void setMaxSize(qint64 maxSize);
+
+    /**
+     * @brief The number of bytes currently stored.
+     */
+    qint64 size() const;
+
+    bool contains(const Key &key) const;
+
+    /**
+     * @brief The stored data for @p key, or an empty array if there is none.
+     *
+     * Marks the entry as the most recently used one.
+     */
+    QByteArray find(const Key &key);
+
+    void insert(const Key &key, const QByteArray &data);
+    void remove(const Key &key);
+    void clear();
+
+    /**
+     * @brief Get the thumbnail for @p key, from the cache if possible and otherwise from the server.
+     *
+     * If @p encryptedFile is set the media is downloaded as a whole and decrypted with it,
+     * the size and method of @p key are ignored. Concurrent calls for the same key share
+     * a single request.
+     *
+     * Returns an empty array if the thumbnail could not be loaded.
+     */
+    QCoro::Task<QByteArray> thumbnail(Quotient::Connection *connection, Key key, std::optional<Quotient::EncryptedFileMetadata> encryptedFile = std::nullopt);
+
+private:
+    struct Entry {
+        qint64 size = 0;
+        std::list<QString>::iterator position;
+    };
+
+    static QString fileName(const Key &key);
+    static QCoro::Task<QByteArray> fetch(Quotient::Connection *connection, const Key &key, bool download);
+    void load();
+    void touch(const QString &name);
+    void evict();
+
+    QString m_directory;
+    qint64 m_maxSize;
+    qint64 m_size = 0;
+    // Least recently used first.
+    std::list<QString> m_order;
+    QHash<QString, Entry> m_entries;
+    // The requests to the server that are on their way, by file name.
+    QHash<QString, QFuture<QByteArray>> m_pendingFetches;
+};
@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "membersearchindex.h"
+
+#include <QSet>
+
+#include <algorithm>
+
+namespace
+{
+enum Match {
+    Exact,
+    Prefix,
+    WordPrefix,
+};
+
+void addWords(QSet<QString> &keys, QStringView text)
+{
+    qsizetype start = -1;
+    for (qsizetype i = 0; i <= text.size(); ++i) {
+        const bool isWordCharacter = i < text.size() && text[i].isLetterOrNumber();
+        if (isWordCharacter && start < 0) {
+            start = i;
+        } else if (!isWordCharacter && start >= 0) {
+            keys.insert(text.sliced(start, i - start).toString());
+            start = -1;
+        }
+    }
+}
+
+QStringView localpart(QStringView id)
+{
+    const auto colon = id.indexOf(u':');
+    return colon < 0 ? id : id.first(colon);
+}
+}
+
+qsizetype MemberSearchIndex::size() const
+{
+    return m_members.size();
+}
+
+bool MemberSearchIndex::contains(const QString &userId) const
+{
+    return m_members.contains(userId);
+}
+
+QString MemberSearchIndex::normalize(QStringView text)
+{
+    const auto decomposed = text.toString().normalized(QString::NormalizationForm_KD);
+    QString result;
+    result.reserve(decomposed.size());
+    for (const auto c : decomposed) {
+        if (c.category() != QChar::Mark_NonSpacing) {
+            result += c;
+        }
+    }
+    return result.toCaseFolded();
+}
+
+void MemberSearchIndex::insert(const QString &userId, const QString &displayName)
+{
+    remove(userId);
+
+    Member member{
+        .name = normalize(displayName),
+        .id = normalize(userId.startsWith(u'@') ? QStringView(userId).sliced(1) : QStringView(userId)),
+        .keys = {},
+    };
+
+    QSet<QString> keys{member.name, member.id};
+    addWords(keys, member.name);
+    addWords(keys, localpart(member.id));
+    keys.remove(QString());
+
+    member.keys = keys.values();
+    for (const auto &key : std::as_const(member.keys)) {
+        m_keys.insert(key, userId);
+    }
+    m_members.insert(userId, std::move(member));
+    ++m_revision;
+}
+
+void MemberSearchIndex::remove(const QString &userId)
+{
+    const auto it = m_members.constFind(userId);
+    if (it == m_members.cend()) {
+        return;
+    }
+    for (const auto &key : it->keys) {
+        m_keys.remove(key, userId);
+    }
+    m_members.erase(it);
+    ++m_revision;
+}
+
+void MemberSearchIndex::setLastActive(const QString &userId, qint64 timestamp)
+{
+    auto &lastActive = m_lastActive[userId];
+    lastActive = std::max(lastActive, timestamp);
+}
+
+quint64 MemberSearchIndex::revision() const
+{
+    return m_revision;
+}
+
+QStringList MemberSearchIndex::search(QStringView text, qsizetype limit) const
+{
+    const auto query = normalize(text.startsWith(u'@') ? text.sliced(1) : text);
+
+    struct Result {
+        Match match;
+        qint64 lastActive;
+        const QString *userId;
+        const Member *member;
+    };
+    QList<Result> results;
+    QSet<QString> seen;
+
+    const auto addResult = [&](const QString &userId, const Member &member) {
+        Match match = WordPrefix;
+        if (member.name == query || member.id == query || localpart(member.id) == query) {
+            match = Exact;
+        } else if (member.name.startsWith(query) || member.id.startsWith(query)) {
+            match = Prefix;
+        }
+        results += Result{match, m_lastActive.value(userId), &userId, &member};
+    };
+
+    if (query.isEmpty()) {
+        results.reserve(m_members.size());
+        for (auto it = m_members.cbegin(); it != m_members.cend(); ++it) {
+            addResult(it.key(), it.value());
+        }
+    } else {
+        for (auto it = m_keys.lowerBound(query); it != m_keys.cend() && it.key().startsWith(query); ++it) {
+            if (seen.contains(it.value())) {
+                continue;
+            }
+            seen.insert(it.value());
+            const auto member = m_members.constFind(it.value());
+            addResult(member.key(), member.value());
+        }
+    }
+
+    const auto lessThan = [](const Result &left, const Result &right) {
+        if (left.match != right.match) {
+            return left.match < right.match;
+        }
+        if (left.lastActive != right.lastActive) {
+            return left.lastActive > right.lastActive;
+        }
+        if (left.member->name != right.member->name) {
+            return left.member->name < right.member->name;
+        }
+        return *left.userId < *right.userId;
+    };
+    if (limit >= 0 && limit < results.size()) {
+        std::partial_sort(results.begin(), results.begin() + limit, results.end(), lessThan);
+        results.resize(limit);
+    } else {
+        std::sort(results.begin(), results.end(), lessThan);
+    }
+
+    QStringList userIds;
+    userIds.reserve(results.size());
+    for (const auto &result : std::as_const(results)) {
+        userIds += *result.userId;
+    }
+    return userIds;
+}
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QMultiMap>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @class MemberSearchIndex
+ *
+ * A search index over the display names and user ids of the members of a room.
+ *
+ * The display name, the user id and the words of both are normalized (case folded,
+ * without diacritics) and kept in one ordered map. All the keys starting with a
+ * prefix are next to each other, so a search only visits the keys that match rather
+ * than every member. Members can be added, renamed and removed one at a time.
+ *
+ * Results are ranked by how they match (the whole name or id, the start of the name
+ * or id, then the start of one of their words) and within that by how recently the
+ * member was active in the room.
+ *
+ * @sa NeoChatRoom::memberSearchIndex()
+ */
+class MemberSearchIndex
+{
+public:
+    /**
+     * @brief The number of members in the index.
+     */
+    qsizetype size() const;
+
+    /**
+     * @brief Whether @p userId is in the index.
+     */
+    bool contains(const QString &userId) const;
+
+    /**
+     * @brief Add @p userId, or update their display name if they are already in the index.
+     */
+    void insert(const QString &userId, const QString &displayName);
+
+    /**
+     * @brief Remove @p userId from the index.
+     *
+     * Their last activity is kept for when they come back.
+     */
+    void remove(const QString &userId);
+
+    /**
+     * @brief Record that @p userId was active at @p timestamp, in milliseconds since the epoch.
+     *
+     * Older timestamps than the one already recorded are ignored.
+     */
+    void setLastActive(const QString &userId, qint64 timestamp);
+
+    /**
+     * @brief Incremented whenever members are added, renamed or removed.
+     *
+     * Tells whether the set of members matching a text may have changed. Activity
+     * only changes the order of the results, so it doesn't count.
+     */
+    quint64 revision() const;
+
+    /**
+     * @brief The ids of the members matching @p text, best match first.
+     *
+     * A leading "@" in @p text is ignored and matching is case and diacritic
+     * insensitive. An empty @p text matches every member.
+     *
+     * @param limit The maximum number of results, or -1 for all of them.
+     */
+    QStringList search(QStringView text, qsizetype limit = -1) const;
+
+    /**
+     * @brief @p text in the form the keys of the index are stored in.
+     */
+    static QString normalize(QStringView text);
+
+private:
+    struct Member {
+        QString name;
+        QString id;
+        QStringList keys;
+    };
+
+    QHash<QString, Member> m_members;
+    // Normalized key -> user id.
+    QMultiMap<QString, QString> m_keys;
+    QHash<QString, qint64> m_lastActive;
+    quint64 m_revision = 0;
+};
@@ -351,17 +351,11 @@ QList<ActionsModel::Action> actions{
     Action{
         u"react"_s,
         [](const QString &text, NeoChatRoom *room, PostMessageHelper *helper) {
-            const auto replyCache = helper->cache()->at<Blocks::ReplyCacheItem>(0);
-            if (!replyCache) {
-                for (auto it = room->messageEvents().crbegin(); it != room->messageEvents().crend(); it++) {
-                    const auto &evt = **it;
-                    if (const auto event = eventCast<const RoomMessageEvent>(&evt)) {
-                        room->toggleReaction(event->id(), text);
-                        return QString();
-                    }
-                }
+            if (const auto replyCache = helper->cache()->at<Blocks::ReplyCacheItem>(0)) {
+                room->toggleReaction(replyCache->id, text);
+            } else if (const auto event = room->lastMessageEvent()) {
+                room->toggleReaction(event->id(), text);
             }
-            room->toggleReaction(replyCache->id, text);
             return QString();
         },
         std::nullopt,
@@ -500,19 +494,45 @@ QHash<int, QByteArray> ActionsModel::roleNames() const
     };
 }
 
-QList<Action> &ActionsModel::allActions()
+const QList<Action> &ActionsModel::allActions()
 {
     return actions;
 }
 
+std::optional<ActionsModel::Command> ActionsModel::parseCommand(const QString &text)
+{
+    if (!text.startsWith(u'/')) {
+        return std::nullopt;
+    }
+
+    static const auto commands = [] {
+        QHash<QString, const Action *> commands;
+        commands.reserve(actions.size());
+        for (const auto &action : std::as_const(actions)) {
+            commands.insert(action.prefix, &action);
+        }
+        return commands;
+    }();
+
+    auto prefixEnd = text.indexOf(u' ');
+    if (prefixEnd < 0) {
+        prefixEnd = text.size();
+    }
+    const auto action = commands.value(text.sliced(1, prefixEnd - 1));
+    if (!action) {
+        return std::nullopt;
+    }
+    return Command{action, text.sliced(prefixEnd).trimmed()};
+}
+
 bool ActionsModel::handleQuickEditAction(NeoChatRoom *room, const QString &messageText)
 {
     if (room == nullptr) {
         return false;
     }
 
-    if (m_allowQuickEdit) {
-        QRegularExpression sed(u"^s/([^/]*)/([^/]*)(/g)?$"_s);
+    if (m_allowQuickEdit && messageText.startsWith("s/"_L1)) {
+        static const QRegularExpression sed(u"^s/([^/]*)/([^/]*)(/g)?$"_s);
         auto match = sed.match(messageText);
         if (match.hasMatch()) {
             const QString regex = match.captured(1);
@@ -559,21 +579,13 @@ std::pair<std::optional<QString>, std::optional<Quotient::RoomMessageEvent::MsgT
         return std::make_pair(std::nullopt, std::nullopt);
     }
 
-    std::optional<Quotient::RoomMessageEvent::MsgType> messageType = Quotient::RoomMessageEvent::MsgType::Text;
-    if (sendText.startsWith(QLatin1Char('/'))) {
-        for (const auto &action : ActionsModel::instance().allActions()) {
-            if (sendText.indexOf(action.prefix) == 1
-                && (sendText.indexOf(" "_L1) == action.prefix.length() + 1 || sendText.length() == action.prefix.length() + 1)) {
-                sendText = action.handle(sendText.mid(action.prefix.length() + 1).trimmed(), room, helper);
-                if (action.messageType.has_value()) {
-                    messageType = action.messageType;
-                } else {
-                    messageType = std::nullopt;
-                }
-            }
-        }
+    const auto command = parseCommand(sendText);
+    if (!command) {
+        return std::make_pair(std::make_optional(sendText), std::make_optional(Quotient::RoomMessageEvent::MsgType::Text));
     }
 
+    sendText = command->action->handle(command->arguments, room, helper);
+    const auto messageType = command->action->messageType;
     return std::make_pair(messageType.has_value() ? std::make_optional(sendText) : std::nullopt, messageType);
 }
 
@@ -42,6 +42,15 @@ public:
         KLazyLocalizedString parameters; /**< The input parameters expected by the action. */
         KLazyLocalizedString description; /**< The description of the action. */
     };
+
+    /**
+     * @brief An action invoked by a message, with its arguments.
+     */
+    struct Command {
+        const Action *action = nullptr; /**< The action the message starts with. */
+        QString arguments; /**< The rest of the message, trimmed. */
+    };
+
     static ActionsModel &instance()
     {
         static ActionsModel _instance;
@@ -83,7 +92,18 @@ public:
     /**
      * @brief Return a vector with all supported actions.
      */
-    static QList<Action> &allActions();
+    static const QList<Action> &allActions();
+
+    /**
+     * @brief Find the action that the given message invokes.
+     *
+     * The prefix is looked up in a table of all actions that is built on first use,
+     * so the cost doesn't depend on the number of actions.
+     *
+     * @return The action and its arguments, or std::nullopt if the message doesn't
+     *         start with '/' followed by the prefix of an action and a space or the end.
+     */
+    static std::optional<Command> parseCommand(const QString &text);
 
     /**
      * @brief Handle special sed style edit action.
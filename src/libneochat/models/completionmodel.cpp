@@ -10,25 +10,17 @@
 #include "chattextitemhelper.h"
 #include "completionproxymodel.h"
 #include "models/actionsmodel.h"
-#include "models/customemojimodel.h"
-#include "models/emojimodel.h"
+#include "models/emojicompletionmodel.h"
+#include "models/membercompletionmodel.h"
 #include "models/roomlistmodel.h"
 #include "userfiltermodel.h"
-#include "userlistmodel.h"
 
 CompletionModel::CompletionModel(QObject *parent)
     : QAbstractListModel(parent)
     , m_textItem(new ChatTextItemHelper(this))
-    , m_emojiModel(new QConcatenateTablesProxyModel(this))
+    , m_memberCompletionModel(new MemberCompletionModel(this))
+    , m_emojiCompletionModel(new EmojiCompletionModel(this))
 {
-    m_emojiModel->addSourceModel(&CustomEmojiModel::instance());
-    m_emojiModel->addSourceModel(&EmojiModel::instance());
-
-    m_userFilterModel = new CompletionProxyModel(this);
-    m_userFilterModel->setSourceModel(m_userListModel);
-    m_userFilterModel->setFilterRole(UserListModel::UserIdRole);
-    m_userFilterModel->setSecondaryFilterRole(UserListModel::DisplayNameRole);
-
     m_commandFilterModel = new CompletionProxyModel(this);
     m_commandFilterModel->setSourceModel(&ActionsModel::instance());
     m_commandFilterModel->setFilterRole(ActionsModel::Prefix);
@@ -38,11 +30,6 @@ CompletionModel::CompletionModel(QObject *parent)
     m_roomFilterModel->setSourceModel(m_roomListModel);
     m_roomFilterModel->setFilterRole(RoomListModel::CanonicalAliasRole);
     m_roomFilterModel->setSecondaryFilterRole(RoomListModel::DisplayNameRole);
-
-    m_emojiFilterModel = new CompletionProxyModel(this);
-    m_emojiFilterModel->setSourceModel(m_emojiModel);
-    m_emojiFilterModel->setFilterRole(CustomEmojiModel::Name);
-    m_emojiFilterModel->setSecondaryFilterRole(EmojiModel::DescriptionRole);
 }
 
 ChatTextItemHelper *CompletionModel::textItem() const
@@ -87,15 +74,15 @@ void CompletionModel::ignoreCurrentCompletion()
     }
 }
 
-CompletionProxyModel *CompletionModel::modelForCurrentType() const
+QAbstractItemModel *CompletionModel::modelForCurrentType() const
 {
     switch (m_autoCompletionType) {
     case User:
-        return m_userFilterModel;
+        return m_memberCompletionModel;
     case Room:
         return m_roomFilterModel;
     case Emoji:
-        return m_emojiFilterModel;
+        return m_emojiCompletionModel;
     case Command:
         return m_commandFilterModel;
     default:
@@ -105,8 +92,10 @@ CompletionProxyModel *CompletionModel::modelForCurrentType() const
     return nullptr;
 }
 
-void CompletionModel::connectModelSignals(CompletionProxyModel *model)
+void CompletionModel::connectModelSignals(QAbstractItemModel *model)
 {
+    connect(model, &QAbstractItemModel::modelAboutToBeReset, this, &CompletionModel::beginResetModel);
+    connect(model, &QAbstractItemModel::modelReset, this, &CompletionModel::endResetModel);
     connect(model, &QAbstractItemModel::rowsAboutToBeInserted, this, &CompletionModel::rowsAboutToBeInserted);
     connect(model, &QAbstractItemModel::rowsInserted, this, &CompletionModel::rowsInserted);
     connect(model, &QAbstractItemModel::rowsAboutToBeRemoved, this, &CompletionModel::rowsAboutToBeRemoved);
@@ -116,8 +105,10 @@ void CompletionModel::connectModelSignals(CompletionProxyModel *model)
     connect(model, &QAbstractItemModel::dataChanged, this, &CompletionModel::dataChanged);
 }
 
-void CompletionModel::disconnectModelSignals(CompletionProxyModel *model)
+void CompletionModel::disconnectModelSignals(QAbstractItemModel *model)
 {
+    disconnect(model, &QAbstractItemModel::modelAboutToBeReset, this, &CompletionModel::beginResetModel);
+    disconnect(model, &QAbstractItemModel::modelReset, this, &CompletionModel::endResetModel);
     disconnect(model, &QAbstractItemModel::rowsAboutToBeInserted, this, &CompletionModel::rowsAboutToBeInserted);
     disconnect(model, &QAbstractItemModel::rowsInserted, this, &CompletionModel::rowsInserted);
     disconnect(model, &QAbstractItemModel::rowsAboutToBeRemoved, this, &CompletionModel::rowsAboutToBeRemoved);
@@ -163,19 +154,19 @@ QVariant CompletionModel::data(const QModelIndex &index, int role) const
     auto filterIndex = model->index(index.row(), 0);
     if (m_autoCompletionType == User) {
         if (role == DisplayNameRole) {
-            return m_userFilterModel->data(filterIndex, UserListModel::DisplayNameRole);
+            return m_memberCompletionModel->data(filterIndex, MemberCompletionModel::DisplayNameRole);
         }
         if (role == SubtitleRole) {
-            return m_userFilterModel->data(filterIndex, UserListModel::UserIdRole);
+            return m_memberCompletionModel->data(filterIndex, MemberCompletionModel::UserIdRole);
         }
         if (role == IconNameRole) {
-            return m_userFilterModel->data(filterIndex, UserListModel::AvatarRole);
+            return m_memberCompletionModel->data(filterIndex, MemberCompletionModel::AvatarRole);
         }
         if (role == ReplacedTextRole) {
-            return m_userFilterModel->data(filterIndex, UserListModel::DisplayNameRole);
+            return m_memberCompletionModel->data(filterIndex, MemberCompletionModel::DisplayNameRole);
         }
         if (role == HRefRole) {
-            return u"https://matrix.to/#/%1"_s.arg(m_userFilterModel->data(filterIndex, UserListModel::UserIdRole).toString());
+            return u"https://matrix.to/#/%1"_s.arg(m_memberCompletionModel->data(filterIndex, MemberCompletionModel::UserIdRole).toString());
         }
     }
 
@@ -213,16 +204,16 @@ QVariant CompletionModel::data(const QModelIndex &index, int role) const
     }
     if (m_autoCompletionType == Emoji) {
         if (role == DisplayNameRole) {
-            return m_emojiFilterModel->data(filterIndex, CustomEmojiModel::DisplayRole);
+            return m_emojiCompletionModel->data(filterIndex, EmojiCompletionModel::DisplayNameRole);
         }
         if (role == IconNameRole) {
-            return m_emojiFilterModel->data(filterIndex, CustomEmojiModel::MxcUrl);
+            return m_emojiCompletionModel->data(filterIndex, EmojiCompletionModel::IconNameRole);
         }
         if (role == ReplacedTextRole) {
-            return m_emojiFilterModel->data(filterIndex, CustomEmojiModel::ReplacedTextRole);
+            return m_emojiCompletionModel->data(filterIndex, EmojiCompletionModel::ReplacedTextRole);
         }
         if (role == SubtitleRole) {
-            return m_emojiFilterModel->data(filterIndex, EmojiModel::DescriptionRole);
+            return m_emojiCompletionModel->data(filterIndex, EmojiCompletionModel::SubtitleRole);
         }
     }
 
@@ -291,7 +282,8 @@ void CompletionModel::updateCompletion()
     if (text.size() > 1) {
         if (text.startsWith(QLatin1Char('@'))) {
             // Users
-            m_userFilterModel->setFilterText(text);
+            m_memberCompletionModel->setRoom(m_userListModel ? m_userListModel->room() : nullptr);
+            m_memberCompletionModel->setFilterText(text);
 
             setNewAutoCompletion(User);
             return;
@@ -316,7 +308,7 @@ void CompletionModel::updateCompletion()
             const qsizetype locationOfSpace = fullText.indexOf(QLatin1Char(' '));
 
             if (locationOfEndColon == -1 || locationOfEndColon + 1 == fullText.size() || (locationOfSpace != -1 && locationOfEndColon > locationOfSpace)) {
-                m_emojiFilterModel->setFilterText(text);
+                m_emojiCompletionModel->setFilterText(text);
 
                 setNewAutoCompletion(Emoji);
                 return;
@@ -355,7 +347,6 @@ void CompletionModel::setUserFilterModel(UserFilterModel *userListModel)
     }
 
     m_userListModel = userListModel;
-    m_userFilterModel->setSourceModel(m_userListModel);
     Q_EMIT userListModelChanged();
 }
 
@@ -3,7 +3,6 @@
 
 #pragma once
 
-#include <QConcatenateTablesProxyModel>
 #include <QQmlEngine>
 #include <QQuickItem>
 #include <QSortFilterProxyModel>
@@ -11,6 +10,8 @@
 #include "chattextitemhelper.h"
 
 class CompletionProxyModel;
+class EmojiCompletionModel;
+class MemberCompletionModel;
 class UserFilterModel;
 class RoomListModel;
 
@@ -38,7 +39,7 @@ class CompletionModel : public QAbstractListModel
     Q_PROPERTY(RoomListModel *roomListModel READ roomListModel WRITE setRoomListModel NOTIFY roomListModelChanged)
 
     /**
-     * @brief The UserFilterModel to be used for room completions.
+     * @brief The UserFilterModel whose room is used for user completions.
      */
     Q_PROPERTY(UserFilterModel *userListModel READ userListModel WRITE setUserFilterModel NOTIFY userListModelChanged)
 
@@ -120,9 +121,9 @@ Q_SIGNALS:
     void isCompletingChanged();
 
 private:
-    CompletionProxyModel *modelForCurrentType() const;
-    void connectModelSignals(CompletionProxyModel *model);
-    void disconnectModelSignals(CompletionProxyModel *model);
+    QAbstractItemModel *modelForCurrentType() const;
+    void connectModelSignals(QAbstractItemModel *model);
+    void disconnectModelSignals(QAbstractItemModel *model);
 
     QPointer<ChatTextItemHelper> m_textItem;
 
@@ -130,10 +131,10 @@ private:
     int m_textStart = 0;
     void updateTextStart();
 
-    CompletionProxyModel *m_userFilterModel = nullptr;
+    MemberCompletionModel *m_memberCompletionModel = nullptr;
     CompletionProxyModel *m_commandFilterModel = nullptr;
     CompletionProxyModel *m_roomFilterModel = nullptr;
-    CompletionProxyModel *m_emojiFilterModel = nullptr;
+    EmojiCompletionModel *m_emojiCompletionModel = nullptr;
 
     AutoCompletionType m_autoCompletionType = None;
 
@@ -141,5 +142,4 @@ private:
 
     UserFilterModel *m_userListModel = nullptr;
     RoomListModel *m_roomListModel = nullptr;
-    QConcatenateTablesProxyModel *m_emojiModel = nullptr;
 };
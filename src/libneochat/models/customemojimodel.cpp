@@ -7,6 +7,7 @@
 #include <QMimeDatabase>
 
 #include "emojimodel.h"
+#include "imagepackregistry.h"
 
 #include <Quotient/csapi/account-data.h>
 #include <Quotient/csapi/content-repo.h>
@@ -18,7 +19,13 @@ void CustomEmojiModel::setConnection(NeoChatConnection *connection)
     if (connection == m_connection) {
         return;
     }
+    if (m_connection) {
+        disconnect(ImagePackRegistry::forConnection(m_connection), nullptr, this, nullptr);
+    }
     m_connection = connection;
+    if (m_connection) {
+        connect(ImagePackRegistry::forConnection(m_connection), &ImagePackRegistry::accountPackChanged, this, &CustomEmojiModel::fetchEmojis);
+    }
     Q_EMIT connectionChanged();
     fetchEmojis();
 }
@@ -34,31 +41,20 @@ void CustomEmojiModel::fetchEmojis()
         return;
     }
 
-    const auto &data = m_connection->accountData("im.ponies.user_emotes"_L1);
-    if (data == nullptr) {
-        return;
-    }
-    QJsonObject emojis = data->contentJson()["images"_L1].toObject();
-
-    // TODO: Remove with stable migration
-    const auto legacyEmojis = data->contentJson()["emoticons"_L1].toObject();
-    for (const auto &emoji : legacyEmojis.keys()) {
-        if (!emojis.contains(emoji)) {
-            emojis[emoji] = legacyEmojis[emoji];
-        }
-    }
-
     beginResetModel();
     m_emojis.clear();
 
-    for (const auto &emoji : emojis.keys()) {
-        const auto &data = emojis[emoji];
-        if (data["usage"_L1].toArray().contains("emoticon"_L1)) {
-            const auto e = emoji.startsWith(":"_L1) ? emoji : (u":"_s + emoji + u":"_s);
+    QList<EmojiSearchIndex::Entry> entries;
+    const auto &pack = ImagePackRegistry::forConnection(m_connection)->accountPack();
+    for (const auto &image : pack ? pack->images : QList<ImagePackEventContent::ImagePackImage>()) {
+        if (image.usage && image.usage->contains("emoticon"_L1)) {
+            const auto e = image.shortcode.startsWith(":"_L1) ? image.shortcode : (u":"_s + image.shortcode + u":"_s);
 
-            m_emojis << CustomEmoji{e, data.toObject().value("url"_L1).toString(), QRegularExpression(e)};
+            m_emojis << CustomEmoji{e, image.url.toString(), QRegularExpression(e)};
+            entries += EmojiSearchIndex::Entry{e, QString()};
         }
     }
+    m_searchIndex = EmojiSearchIndex(entries);
 
     endResetModel();
 }
@@ -127,19 +123,6 @@ void CustomEmojiModel::removeEmoji(const QString &name)
 CustomEmojiModel::CustomEmojiModel(QObject *parent)
     : QAbstractListModel(parent)
 {
-    connect(this, &CustomEmojiModel::connectionChanged, this, [this]() {
-        if (!m_connection) {
-            return;
-        }
-        CustomEmojiModel::fetchEmojis();
-        connect(m_connection, &Connection::accountDataChanged, this, [this](const QString &id) {
-            if (id != u"im.ponies.user_emotes"_s) {
-                return;
-            }
-            fetchEmojis();
-        });
-    });
-    CustomEmojiModel::fetchEmojis();
 }
 
 QVariant CustomEmojiModel::data(const QModelIndex &idx, int role) const
@@ -197,13 +180,32 @@ QString CustomEmojiModel::preprocessText(QString text)
 QVariantList CustomEmojiModel::filterModel(const QString &filter)
 {
     QVariantList results;
-    for (const auto &emoji : std::as_const(m_emojis)) {
-        if (results.length() >= 10)
-            break;
-        if (!emoji.name.contains(filter, Qt::CaseInsensitive))
-            continue;
+    if (filter.isEmpty()) {
+        for (const auto &emoji : m_emojis.first(std::min<qsizetype>(m_emojis.size(), 10))) {
+            results << QVariant::fromValue(Emoji(m_connection->makeMediaUrl(QUrl(emoji.url)).toString(), emoji.name, true));
+        }
+        return results;
+    }
 
-        results << QVariant::fromValue(Emoji(m_connection->makeMediaUrl(QUrl(emoji.url)).toString(), emoji.name, true));
+    const auto emojis = search(filter, 10);
+    results.reserve(emojis.size());
+    for (const auto &emoji : emojis) {
+        results << QVariant::fromValue(emoji);
+    }
+    return results;
+}
+
+QList<Emoji> CustomEmojiModel::search(const QString &text, qsizetype limit) const
+{
+    QList<Emoji> results;
+    if (!m_connection) {
+        return results;
+    }
+    const auto ids = m_searchIndex.search(text, limit);
+    results.reserve(ids.size());
+    for (const auto id : ids) {
+        const auto &emoji = m_emojis[id];
+        results += Emoji(m_connection->makeMediaUrl(QUrl(emoji.url)).toString(), emoji.name, true);
     }
     return results;
 }
@@ -7,6 +7,7 @@
 #include <QQmlEngine>
 #include <QRegularExpression>
 
+#include "emojimodel.h"
 #include "neochatconnection.h"
 
 struct CustomEmoji {
@@ -25,6 +26,9 @@ struct CustomEmoji {
  * This class defines the model for custom user emojis.
  *
  * This is based upon the im.ponies.user_emotes spec (MSC2545).
+ *
+ * The emojis come from the account's own pack in the ImagePackRegistry of the
+ * connection and are searched by name through an EmojiSearchIndex.
  */
 class CustomEmojiModel : public QAbstractListModel
 {
@@ -87,10 +91,24 @@ public:
     Q_INVOKABLE QString preprocessText(QString text);
 
     /**
-     * @brief Return a list of custom emojis where the name contains the filter text.
+     * @brief Return at most 10 custom emojis matching the filter text, best match first.
+     *
+     * An empty filter returns the first 10 emojis.
+     *
+     * @sa search()
      */
     Q_INVOKABLE QVariantList filterModel(const QString &filter);
 
+    /**
+     * @brief The custom emojis whose name, or a word of it, starts with the given text.
+     *
+     * Surrounding colons are ignored and matching is case insensitive. The whole
+     * name matching comes first, then the start of the name, then the start of a word.
+     *
+     * @param limit The maximum number of results, or -1 for all of them.
+     */
+    QList<Emoji> search(const QString &text, qsizetype limit = -1) const;
+
     /**
      * @brief Add a new emoji to the model.
      */
@@ -110,6 +128,7 @@ Q_SIGNALS:
 private:
     explicit CustomEmojiModel(QObject *parent = nullptr);
     QList<CustomEmoji> m_emojis;
+    EmojiSearchIndex m_searchIndex;
     QPointer<NeoChatConnection> m_connection;
 
     void fetchEmojis();
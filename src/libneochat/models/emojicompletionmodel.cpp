@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "emojicompletionmodel.h"
+
+#include "customemojimodel.h"
+
+using namespace Qt::StringLiterals;
+
+EmojiCompletionModel::EmojiCompletionModel(QObject *parent)
+    : QAbstractListModel(parent)
+{
+    const auto &customEmojis = CustomEmojiModel::instance();
+    connect(&customEmojis, &QAbstractItemModel::modelReset, this, &EmojiCompletionModel::update);
+    connect(&customEmojis, &QAbstractItemModel::rowsInserted, this, &EmojiCompletionModel::update);
+    connect(&customEmojis, &QAbstractItemModel::rowsRemoved, this, &EmojiCompletionModel::update);
+}
+
+QString EmojiCompletionModel::filterText() const
+{
+    return m_filterText;
+}
+
+void EmojiCompletionModel::setFilterText(const QString &filterText)
+{
+    if (filterText == m_filterText) {
+        return;
+    }
+    m_filterText = filterText;
+    update();
+}
+
+void EmojiCompletionModel::update()
+{
+    beginResetModel();
+    m_emojis.clear();
+
+    if (!m_filterText.isEmpty()) {
+        m_emojis += CustomEmojiModel::instance().search(m_filterText);
+        m_emojis += EmojiModel::instance().search(m_filterText);
+    }
+
+    endResetModel();
+}
+
+QVariant EmojiCompletionModel::data(const QModelIndex &index, int role) const
+{
+    if (index.row() < 0 || index.row() >= m_emojis.size()) {
+        return {};
+    }
+    const auto &emoji = m_emojis[index.row()];
+
+    switch (role) {
+    case DisplayNameRole:
+        return emoji.isCustom ? emoji.shortName : u"%2   %1"_s.arg(emoji.shortName, emoji.unicode);
+    case SubtitleRole:
+        return emoji.description;
+    case IconNameRole:
+        return emoji.isCustom ? emoji.unicode : u"invalid"_s;
+    case ReplacedTextRole:
+        return emoji.isCustom ? emoji.shortName : emoji.unicode;
+    }
+    return {};
+}
+
+int EmojiCompletionModel::rowCount(const QModelIndex &parent) const
+{
+    Q_UNUSED(parent)
+    return m_emojis.size();
+}
+
+QHash<int, QByteArray> EmojiCompletionModel::roleNames() const
+{
+    return {
+        {DisplayNameRole, "displayName"},
+        {SubtitleRole, "subtitle"},
+        {IconNameRole, "iconName"},
+        {ReplacedTextRole, "replacedText"},
+    };
+}
+
+#include "moc_emojicompletionmodel.cpp"
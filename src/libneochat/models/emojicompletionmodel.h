@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QAbstractListModel>
+
+#include "emojimodel.h"
+
+/**
+ * @class EmojiCompletionModel
+ *
+ * The emojis matching a ":shortcode" being typed, for CompletionModel.
+ *
+ * Custom emojis whose name starts with the filter text come first, followed by the
+ * standard emojis found by EmojiModel::search(), best match first.
+ *
+ * The model is reset whenever the filter text changes.
+ */
+class EmojiCompletionModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Defines the model roles.
+     */
+    enum Roles {
+        DisplayNameRole = Qt::DisplayRole, /**< The text to show for the emoji. */
+        SubtitleRole = Qt::UserRole, /**< The description of the emoji. */
+        IconNameRole, /**< The image URL of a custom emoji, "invalid" otherwise. */
+        ReplacedTextRole, /**< The text to replace the shortcode with. */
+    };
+    Q_ENUM(Roles)
+
+    explicit EmojiCompletionModel(QObject *parent = nullptr);
+
+    /**
+     * @brief Get the current text being used to filter the emojis.
+     */
+    QString filterText() const;
+
+    /**
+     * @brief Set the text to be used to filter the emojis.
+     *
+     * An empty text matches nothing.
+     */
+    void setFilterText(const QString &filterText);
+
+    /**
+     * @brief Get the given role value at the given index.
+     *
+     * @sa QAbstractItemModel::data
+     */
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    /**
+     * @brief Number of rows in the model.
+     *
+     * @sa  QAbstractItemModel::rowCount
+     */
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /**
+     * @brief Returns a mapping from Role enum values to role names.
+     *
+     * @sa Roles, QAbstractItemModel::roleNames()
+     */
+    QHash<int, QByteArray> roleNames() const override;
+
+private:
+    void update();
+
+    QString m_filterText;
+    QList<Emoji> m_emojis;
+};
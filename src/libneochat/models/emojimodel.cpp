@@ -8,6 +8,7 @@
 #include <QDebug>
 
 #include <algorithm>
+#include <array>
 
 #include "customemojimodel.h"
 #include <KLocalizedString>
@@ -23,52 +24,75 @@ struct {
 
 using namespace Qt::StringLiterals;
 
-EmojiModel::EmojiModel(QObject *parent)
-    : QAbstractListModel(parent)
-    , m_config(KSharedConfig::openStateConfig())
-    , m_configGroup(KConfigGroup(m_config, u"Editor"_s))
+namespace
 {
-    if (_emojis.isEmpty()) {
-        for (const auto &emoji : emoji_data) {
-            _emojis[emoji.category].push_back(QVariant::fromValue(Emoji(QString::fromUtf8(emoji.escaped_sequence),
-                                                                        QStringLiteral(":%1:").arg(QString::fromUtf8(emoji.shortcode)),
-                                                                        QString::fromUtf8(emoji.description))));
+// emojis.h lists the emojis of each category together, so a category is a slice of emoji_data.
+struct CategoryRange {
+    qsizetype begin = 0;
+    qsizetype end = 0;
+};
+
+constexpr auto categoryRanges = [] {
+    std::array<CategoryRange, EmojiModel::Component + 1> ranges{};
+    for (qsizetype i = 0; i < qsizetype(std::size(emoji_data)); ++i) {
+        auto &range = ranges[emoji_data[i].category];
+        if (range.begin == range.end) {
+            range = {i, i + 1};
+        } else {
+            range.end = i + 1;
         }
     }
+    return ranges;
+}();
+
+static_assert(
+    [] {
+        qsizetype total = 0;
+        for (const auto &range : categoryRanges) {
+            total += range.end - range.begin;
+        }
+        return total == qsizetype(std::size(emoji_data));
+    }(),
+    "The emojis of a category must be contiguous in emojis.h, see tools/update-emojis.py");
+
+Emoji emojiAt(qsizetype row)
+{
+    const auto &emoji = emoji_data[row];
+    return Emoji(QString::fromUtf8(emoji.escaped_sequence), u":%1:"_s.arg(QString::fromUtf8(emoji.shortcode)), QString::fromUtf8(emoji.description));
+}
+}
+
+EmojiModel::EmojiModel(QObject *parent)
+    : QAbstractListModel(parent)
+    , m_history(KSharedConfig::openStateConfig())
+{
 }
 
 int EmojiModel::rowCount(const QModelIndex &parent) const
 {
     Q_UNUSED(parent);
-    int total = 0;
-    for (const auto &category : std::as_const(_emojis)) {
-        total += category.count();
-    }
-    return total;
+    return int(std::size(emoji_data));
 }
 
 QVariant EmojiModel::data(const QModelIndex &index, int role) const
 {
-    auto row = index.row();
-    for (const auto &category : std::as_const(_emojis)) {
-        if (row >= category.count()) {
-            row -= category.count();
-            continue;
-        }
-        auto emoji = category[row].value<Emoji>();
-        switch (role) {
-        case ShortNameRole:
-            return emoji.shortName;
-        case UnicodeRole:
-        case ReplacedTextRole:
-            return emoji.unicode;
-        case InvalidRole:
-            return u"invalid"_s;
-        case DisplayRole:
-            return u"%2   %1"_s.arg(emoji.shortName, emoji.unicode);
-        case DescriptionRole:
-            return emoji.description;
-        }
+    const auto row = index.row();
+    if (row < 0 || row >= rowCount()) {
+        return {};
+    }
+    const auto emoji = emojiAt(row);
+    switch (role) {
+    case ShortNameRole:
+        return emoji.shortName;
+    case UnicodeRole:
+    case ReplacedTextRole:
+        return emoji.unicode;
+    case InvalidRole:
+        return u"invalid"_s;
+    case DisplayRole:
+        return u"%2   %1"_s.arg(emoji.shortName, emoji.unicode);
+    case DescriptionRole:
+        return emoji.description;
     }
     return {};
 }
@@ -80,7 +104,7 @@ QHash<int, QByteArray> EmojiModel::roleNames() const
 
 QStringList EmojiModel::lastUsedEmojis() const
 {
-    return m_configGroup.readEntry(u"lastUsedEmojis"_s, QStringList());
+    return m_history.shortNames();
 }
 
 QVariantList EmojiModel::filterModel(const QString &filter, bool limit)
@@ -93,39 +117,32 @@ QVariantList EmojiModel::filterModel(const QString &filter, bool limit)
 QVariantList EmojiModel::filterModelNoCustom(const QString &filter, bool limit)
 {
     QVariantList result;
+    const auto emojis = instance().search(filter, limit ? 11 : -1);
+    result.reserve(emojis.size());
+    for (const auto &emoji : emojis) {
+        result.append(QVariant::fromValue(emoji));
+    }
+    return result;
+}
 
-    const auto &values = _emojis.values();
-    for (const auto &e : values) {
-        for (const auto &variant : e) {
-            const auto &emoji = qvariant_cast<Emoji>(variant);
-            if (emoji.shortName.contains(filter, Qt::CaseInsensitive)) {
-                result.append(variant);
-                if (result.length() > 10 && limit) {
-                    return result;
-                }
-            }
-        }
+QList<Emoji> EmojiModel::search(const QString &text, qsizetype limit) const
+{
+    QList<Emoji> result;
+    const auto ids = searchIndex().search(text, limit);
+    result.reserve(ids.size());
+    for (const auto id : ids) {
+        result += emojiAt(id);
     }
     return result;
 }
 
 void EmojiModel::emojiUsed(const QString &shortName)
 {
-    auto list = lastUsedEmojis();
-
-    auto it = list.begin();
-    while (it != list.end()) {
-        if (*it == shortName) {
-            it = list.erase(it);
-        } else {
-            it++;
-        }
+    m_history.recordUse(shortName);
+    if (s_index.size() > 0) {
+        s_index.setRecent(m_history.shortNames());
     }
 
-    list.push_front(shortName);
-
-    m_configGroup.writeEntry(u"lastUsedEmojis"_s, list);
-
     Q_EMIT historyChanged();
 }
 
@@ -137,18 +154,39 @@ QVariantList EmojiModel::emojis(Category category) const
     if (category == Custom) {
         return CustomEmojiModel::instance().filterModel({});
     }
-    return _emojis[category];
+
+    QVariantList result;
+    const auto range = categoryRanges[category];
+    result.reserve(range.end - range.begin);
+    for (auto row = range.begin; row < range.end; ++row) {
+        result += QVariant::fromValue(emojiAt(row));
+    }
+    return result;
 }
 
 QList<Emoji> EmojiModel::tones(const QString &baseEmoji) const
 {
     if (baseEmoji.endsWith(u"tone"_s)) {
-        return EmojiTones::tones().values(baseEmoji.split(u":"_s)[0]);
+        return EmojiTones::tones(baseEmoji.section(u':', 0, 0));
     }
-    return EmojiTones::tones().values(baseEmoji);
+    return EmojiTones::tones(baseEmoji);
 }
 
-QHash<EmojiModel::Category, QVariantList> EmojiModel::_emojis;
+EmojiSearchIndex EmojiModel::s_index;
+
+EmojiSearchIndex &EmojiModel::searchIndex() const
+{
+    if (s_index.size() == 0) {
+        QList<EmojiSearchIndex::Entry> entries;
+        entries.reserve(std::size(emoji_data));
+        for (const auto &emoji : emoji_data) {
+            entries += {QString::fromUtf8(emoji.shortcode), QString::fromUtf8(emoji.description)};
+        }
+        s_index = EmojiSearchIndex(entries);
+        s_index.setRecent(lastUsedEmojis());
+    }
+    return s_index;
+}
 
 QVariantList EmojiModel::categories() const
 {
@@ -229,11 +267,12 @@ QVariantList EmojiModel::categoriesWithCustom() const
 QVariantList EmojiModel::quickReactions() const
 {
     QVariantList reactions;
-    reactions.append(filterModel(QStringLiteral(":thumbsup:"), true));
-    reactions.append(filterModel(QStringLiteral(":thumbsdown:"), true));
-    reactions.append(filterModel(QStringLiteral(":smile:"), true));
-    reactions.append(filterModel(QStringLiteral(":tada:"), true));
-    reactions.append(filterModel(QStringLiteral(":red heart:"), true));
+    // Looked up exactly, a search would also return every emoji starting with the same shortcode.
+    for (const auto &shortName : {u"thumbsup"_s, u"thumbsdown"_s, u"smile"_s, u"tada"_s, u"red heart"_s}) {
+        if (const auto id = searchIndex().find(shortName); id >= 0) {
+            reactions.append(QVariant::fromValue(emojiAt(id)));
+        }
+    }
 
     return reactions;
 }
@@ -244,11 +283,9 @@ QVariantList EmojiModel::emojiHistory() const
     const auto &lastUsed = lastUsedEmojis();
     const auto &customEmojis = CustomEmojiModel::instance().filterModel({});
     for (const auto &historicEmoji : lastUsed) {
-        for (const auto &emojiCategory : std::as_const(_emojis)) {
-            for (const auto &emoji : emojiCategory) {
-                if (qvariant_cast<Emoji>(emoji).shortName == historicEmoji) {
-                    list.append(emoji);
-                }
+        if (const auto id = searchIndex().find(historicEmoji); id >= 0) {
+            if (auto emoji = emojiAt(id); emoji.shortName == historicEmoji) {
+                list.append(QVariant::fromValue(emoji));
             }
         }
         for (const auto &emoji : customEmojis) {
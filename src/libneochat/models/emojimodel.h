@@ -3,12 +3,13 @@
 
 #pragma once
 
-#include <KConfigGroup>
-#include <KSharedConfig>
 #include <QAbstractListModel>
 #include <QObject>
 #include <QQmlEngine>
 
+#include "emojisearchindex.h"
+#include "emojiusagehistory.h"
+
 struct Emoji {
     Emoji(QString unicode, QString shortname, bool isCustom = false)
         : unicode(std::move(unicode))
@@ -152,6 +153,19 @@ public:
      */
     Q_INVOKABLE static QVariantList filterModelNoCustom(const QString &filter, bool limit = true);
 
+    /**
+     * @brief Search the emojis (without custom emojis) for @p text, best match first.
+     *
+     * Emojis match when their shortcode or a word of their shortcode or description
+     * starts with @p text. Exact and shortcode matches come first and recently used
+     * emojis are ranked higher within each.
+     *
+     * @param limit The maximum number of results, or -1 for all of them.
+     *
+     * @sa EmojiSearchIndex
+     */
+    QList<Emoji> search(const QString &text, qsizetype limit = -1) const;
+
     /**
      * @brief Return a list of emojis for the given category.
      */
@@ -163,7 +177,9 @@ public:
     Q_INVOKABLE [[nodiscard]] QList<Emoji> tones(const QString &baseEmoji) const;
 
     /**
-     * @brief Return a list of the last used emoji shortnames
+     * @brief Return a list of the last used emoji shortnames, most frequently and recently used first.
+     *
+     * @sa EmojiUsageHistory
      */
     QStringList lastUsedEmojis() const;
 
@@ -178,17 +194,18 @@ public Q_SLOTS:
     /**
      * @brief Add the specified emoji @p shortname to the history.
      *
-     * @note If the emoji was already in the recent history, it moves to the front.
+     * @note The history is written to the config shortly after, not immediately.
      */
     void emojiUsed(const QString &shortName);
 
 private:
-    static QHash<Category, QVariantList> _emojis;
+    // Built on first use, the emojis themselves are only converted when asked for.
+    static EmojiSearchIndex s_index;
+    EmojiSearchIndex &searchIndex() const;
 
     /// Returns QVariants containing the last used Emojis
     QVariantList emojiHistory() const;
 
-    KSharedConfig::Ptr m_config;
-    KConfigGroup m_configGroup;
+    EmojiUsageHistory m_history;
     EmojiModel(QObject *parent = nullptr);
 };
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LGPL-2.0-or-later
 
 #include "imagepacksmodel.h"
+#include "imagepackregistry.h"
 #include "neochatroom.h"
 
 #include <KLocalizedString>
@@ -59,19 +60,15 @@ NeoChatRoom *ImagePacksModel::room() const
 void ImagePacksModel::setRoom(NeoChatRoom *room)
 {
     if (m_room) {
-        disconnect(m_room, nullptr, this, nullptr);
-        disconnect(m_room->connection(), nullptr, this, nullptr);
+        disconnect(ImagePackRegistry::forConnection(m_room->connection()), nullptr, this, nullptr);
     }
     m_room = room;
 
     if (m_room) {
-        connect(m_room->connection(), &Connection::accountDataChanged, this, [this](const QString &type) {
-            if (type == "im.ponies.user_emotes"_L1) {
-                reloadImages();
-            }
-        });
+        const auto registry = ImagePackRegistry::forConnection(m_room->connection());
+        connect(registry, &ImagePackRegistry::accountPackChanged, this, &ImagePacksModel::reloadImages);
+        connect(registry, &ImagePackRegistry::packsChanged, this, &ImagePacksModel::reloadImages);
     }
-    // TODO listen to packs changing
     reloadImages();
     Q_EMIT roomChanged();
 }
@@ -84,54 +81,35 @@ void ImagePacksModel::reloadImages()
     beginResetModel();
     m_events.clear();
 
+    const auto registry = ImagePackRegistry::forConnection(m_room->connection());
+    ImagePackRegistry::Usages usages;
+    if (m_showEmoticons) {
+        usages |= ImagePackRegistry::Emoticon;
+    }
+    if (m_showStickers) {
+        usages |= ImagePackRegistry::Sticker;
+    }
+
     // Load emoticons from the account data
-    if (m_room->connection()->hasAccountData("im.ponies.user_emotes"_L1)) {
-        auto json = m_room->connection()->accountData("im.ponies.user_emotes"_L1)->contentJson();
-        json["pack"_L1] = QJsonObject{
-            {"display_name"_L1,
-             m_showStickers ? i18nc("As in 'The user's own Stickers'", "Own Stickers") : i18nc("As in 'The user's own emojis", "Own Emojis")},
-        };
-        const auto &content = ImagePackEventContent(json);
-        if (!content.images.isEmpty()) {
-            m_events += ImagePackEventContent(json);
-        }
+    if (const auto &accountPack = registry->accountPack(); accountPack && !accountPack->images.isEmpty()) {
+        auto content = *accountPack;
+        content.pack = ImagePackEventContent::Pack{};
+        content.pack->displayName =
+            m_showStickers ? i18nc("As in 'The user's own Stickers'", "Own Stickers") : i18nc("As in 'The user's own emojis", "Own Emojis");
+        m_events += content;
     }
 
     // Load emoticons from the saved rooms
-    const auto &accountData = m_room->connection()->accountData("im.ponies.emote_rooms"_L1);
-    if (accountData) {
-        const auto &rooms = accountData->contentJson()["rooms"_L1].toObject();
-        for (const auto &roomId : rooms.keys()) {
-            if (roomId == m_room->id()) {
-                continue;
-            }
-            auto packs = rooms[roomId].toObject();
-            const auto &stickerRoom = m_room->connection()->room(roomId);
-            if (!stickerRoom) {
-                continue;
-            }
-            for (const auto &packKey : packs.keys()) {
-                if (const auto &pack = stickerRoom->currentState().get<ImagePackEvent>(packKey)) {
-                    const auto packContent = pack->content();
-                    if ((!packContent.pack || !packContent.pack->usage || (packContent.pack->usage->contains("emoticon"_L1) && showEmoticons())
-                         || (packContent.pack->usage->contains("sticker"_L1) && showStickers()))
-                        && !packContent.images.isEmpty()) {
-                        m_events += packContent;
-                    }
-                }
-            }
+    for (const auto &pack : registry->subscribedPacks(usages)) {
+        if (pack.roomId != m_room->id()) {
+            m_events += pack.content;
         }
     }
 
     // Load emoticons from the current room
-    auto events = m_room->currentState().eventsOfType("im.ponies.room_emotes"_L1);
-    for (const auto &event : events) {
-        auto packContent = eventCast<const ImagePackEvent>(event)->content();
-        if (packContent.pack.has_value()) {
-            if (!packContent.pack->usage || (packContent.pack->usage->contains("emoticon"_L1) && showEmoticons())
-                || (packContent.pack->usage->contains("sticker"_L1) && showStickers())) {
-                m_events += packContent;
-            }
+    for (const auto &pack : registry->roomPacks(m_room)) {
+        if (pack.content.pack.has_value() && (pack.usages & usages)) {
+            m_events += pack.content;
         }
     }
     Q_EMIT imagesLoaded();
@@ -145,8 +123,12 @@ bool ImagePacksModel::showStickers() const
 
 void ImagePacksModel::setShowStickers(bool showStickers)
 {
+    if (showStickers == m_showStickers) {
+        return;
+    }
     m_showStickers = showStickers;
     Q_EMIT showStickersChanged();
+    reloadImages();
 }
 
 bool ImagePacksModel::showEmoticons() const
@@ -156,8 +138,12 @@ bool ImagePacksModel::showEmoticons() const
 
 void ImagePacksModel::setShowEmoticons(bool showEmoticons)
 {
+    if (showEmoticons == m_showEmoticons) {
+        return;
+    }
     m_showEmoticons = showEmoticons;
     Q_EMIT showEmoticonsChanged();
+    reloadImages();
 }
 QList<Quotient::ImagePackEventContent::ImagePackImage> ImagePacksModel::images(int index)
 {
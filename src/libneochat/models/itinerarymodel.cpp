@@ -3,11 +3,7 @@
 
 #include "itinerarymodel.h"
 
-#include <QJsonDocument>
-#include <QProcess>
-#include <QStandardPaths>
-
-#include "config-neochat.h"
+#include "itineraryextractor.h"
 
 #ifndef Q_OS_ANDROID
 #include <KIO/ApplicationLauncherJob>
@@ -178,21 +174,18 @@ bool ItineraryModel::loading() const
 void ItineraryModel::loadData()
 {
     m_loading = true;
-    auto process = new QProcess(this);
-    process->start("%1%2"_L1.arg(CMAKE_INSTALL_FULL_LIBEXECDIR_KF6, "/kitinerary-extractor"_L1), {m_source.path()});
-    connect(process, &QProcess::finished, this, [this, process]() {
-        auto data = process->readAllStandardOutput();
+    ItineraryExtractor::instance().extract(m_source.path()).then(this, [this](const ItineraryExtractor::Result &result) {
+        m_loading = false;
+        if (!result) {
+            Q_EMIT loadErrorOccurred();
+            return;
+        }
+
         beginResetModel();
-        m_data = QJsonDocument::fromJson(data).array();
+        m_data = *result;
         endResetModel();
-
-        m_loading = false;
         Q_EMIT loaded();
     });
-    connect(process, &QProcess::errorOccurred, this, [this]() {
-        m_loading = false;
-        Q_EMIT loadErrorOccurred();
-    });
 }
 
 void ItineraryModel::sendToItinerary()
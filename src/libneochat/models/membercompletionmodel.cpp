@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "membercompletionmodel.h"
+
+#include "neochatroom.h"
+
+MemberCompletionModel::MemberCompletionModel(QObject *parent)
+    : QAbstractListModel(parent)
+{
+}
+
+NeoChatRoom *MemberCompletionModel::room() const
+{
+    return m_room;
+}
+
+void MemberCompletionModel::setRoom(NeoChatRoom *room)
+{
+    if (room == m_room) {
+        return;
+    }
+    m_room = room;
+    update();
+}
+
+QString MemberCompletionModel::filterText() const
+{
+    return m_filterText;
+}
+
+void MemberCompletionModel::setFilterText(const QString &filterText)
+{
+    if (filterText == m_filterText) {
+        return;
+    }
+    m_filterText = filterText;
+    update();
+}
+
+void MemberCompletionModel::update()
+{
+    beginResetModel();
+    m_userIds.clear();
+    if (m_room && !m_filterText.isEmpty()) {
+        m_userIds = m_room->memberSearchIndex().search(m_filterText, MaxResults);
+    }
+    endResetModel();
+}
+
+QVariant MemberCompletionModel::data(const QModelIndex &index, int role) const
+{
+    if (!m_room || index.row() < 0 || index.row() >= m_userIds.size()) {
+        return {};
+    }
+    const auto &userId = m_userIds[index.row()];
+
+    switch (role) {
+    case DisplayNameRole:
+        return m_room->member(userId).disambiguatedName();
+    case UserIdRole:
+        return userId;
+    case AvatarRole:
+        return m_room->member(userId).avatarUrl();
+    }
+    return {};
+}
+
+int MemberCompletionModel::rowCount(const QModelIndex &parent) const
+{
+    Q_UNUSED(parent)
+    return m_userIds.size();
+}
+
+QHash<int, QByteArray> MemberCompletionModel::roleNames() const
+{
+    return {
+        {DisplayNameRole, "displayName"},
+        {UserIdRole, "userId"},
+        {AvatarRole, "avatar"},
+    };
+}
+
+#include "moc_membercompletionmodel.cpp"
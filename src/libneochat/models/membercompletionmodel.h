@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QAbstractListModel>
+#include <QPointer>
+
+class NeoChatRoom;
+
+/**
+ * @class MemberCompletionModel
+ *
+ * The members of a room matching an "@mention" being typed, for CompletionModel.
+ *
+ * The members are found with the MemberSearchIndex of the room, so the best matches
+ * come first and, among equally good matches, the members that were active most
+ * recently. Only the first MaxResults matches are listed.
+ *
+ * The model is reset whenever the room or the filter text changes.
+ */
+class MemberCompletionModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Defines the model roles.
+     */
+    enum Roles {
+        DisplayNameRole = Qt::DisplayRole, /**< The display name of the member. */
+        UserIdRole = Qt::UserRole, /**< The matrix ID of the member. */
+        AvatarRole, /**< The source URL for the avatar of the member. */
+    };
+    Q_ENUM(Roles)
+
+    /**
+     * @brief The maximum number of members listed.
+     */
+    static constexpr qsizetype MaxResults = 50;
+
+    explicit MemberCompletionModel(QObject *parent = nullptr);
+
+    NeoChatRoom *room() const;
+    void setRoom(NeoChatRoom *room);
+
+    /**
+     * @brief Get the current text being used to filter the members.
+     */
+    QString filterText() const;
+
+    /**
+     * @brief Set the text to be used to filter the members.
+     *
+     * An empty text matches nothing.
+     */
+    void setFilterText(const QString &filterText);
+
+    /**
+     * @brief Get the given role value at the given index.
+     *
+     * @sa QAbstractItemModel::data
+     */
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    /**
+     * @brief Number of rows in the model.
+     *
+     * @sa  QAbstractItemModel::rowCount
+     */
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /**
+     * @brief Returns a mapping from Role enum values to role names.
+     *
+     * @sa Roles, QAbstractItemModel::roleNames()
+     */
+    QHash<int, QByteArray> roleNames() const override;
+
+private:
+    void update();
+
+    QPointer<NeoChatRoom> m_room;
+    QString m_filterText;
+    QStringList m_userIds;
+};
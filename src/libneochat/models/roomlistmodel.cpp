@@ -24,6 +24,14 @@ std::function<bool(const Quotient::RoomEvent *)> RoomListModel::m_hiddenFilter =
 
 RoomListModel::RoomListModel(QObject *parent)
     : QAbstractListModel(parent)
+    , m_changeCoalescer(
+          [this](NeoChatRoom *room) {
+              const auto row = rowForRoom(room);
+              return row >= 0 ? index(row) : QModelIndex();
+          },
+          [this](int firstRow, int lastRow, const QModelIndex &, const QList<int> &roles) {
+              Q_EMIT dataChanged(index(firstRow), index(lastRow), roles);
+          })
 {
     connect(&SpaceHierarchyCache::instance(), &SpaceHierarchyCache::spaceHierarchyChanged, this, [this]() {
         if (!m_rooms.isEmpty()) {
@@ -47,6 +55,7 @@ void RoomListModel::setConnection(NeoChatConnection *connection)
     if (m_connection) {
         m_connection->disconnect(this);
     }
+    m_changeCoalescer.setConnection(connection);
     if (!connection) {
         qCDebug(RoomList) << "Removing current connection";
         m_connection = nullptr;
@@ -88,6 +97,7 @@ void RoomListModel::setConnection(NeoChatConnection *connection)
 
 void RoomListModel::doResetModel()
 {
+    m_changeCoalescer.clear();
     beginResetModel();
     m_rooms.clear();
     const auto rooms = m_connection->allRooms();
@@ -175,6 +185,7 @@ void RoomListModel::updateRoom(Room *room, Room *prev)
         // There's no guarantee that prev != newRoom
         if (*it == prev && *it != newRoom) {
             prev->disconnect(this);
+            m_changeCoalescer.remove(static_cast<NeoChatRoom *>(prev));
             m_rooms.replace(row, newRoom);
             connectRoomSignals(newRoom);
         }
@@ -195,6 +206,7 @@ void RoomListModel::deleteRoom(Room *room)
     }
     qCDebug(RoomList) << "Erasing room" << room->id();
     const int row = it - m_rooms.begin();
+    m_changeCoalescer.remove(static_cast<NeoChatRoom *>(room));
     beginRemoveRows(QModelIndex(), row, row);
     m_rooms.erase(it);
     endRemoveRows();
@@ -291,13 +303,8 @@ QVariant RoomListModel::data(const QModelIndex &index, int role) const
 
 void RoomListModel::refresh(NeoChatRoom *room, const QList<int> &roles)
 {
-    const auto it = std::find(m_rooms.begin(), m_rooms.end(), room);
-    if (it == m_rooms.end()) {
-        qCCritical(RoomList) << "Room" << room->id() << "not found in the room list";
-        return;
-    }
-    const auto idx = index(it - m_rooms.begin());
-    Q_EMIT dataChanged(idx, idx, roles);
+    // Emitted in batches so that the proxy models only re-sort once per sync.
+    m_changeCoalescer.add(room, roles);
 }
 
 QHash<int, QByteArray> RoomListModel::roleNames() const
@@ -6,6 +6,8 @@
 #include <QAbstractListModel>
 #include <QQmlEngine>
 
+#include "roomchangecoalescer.h"
+
 class NeoChatRoom;
 
 namespace Quotient
@@ -114,6 +116,7 @@ private Q_SLOTS:
 private:
     QPointer<NeoChatConnection> m_connection;
     QList<NeoChatRoom *> m_rooms;
+    RoomChangeCoalescer m_changeCoalescer;
 
     QString m_activeSpaceId;
 
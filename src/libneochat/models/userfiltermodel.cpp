@@ -4,18 +4,36 @@
 #include "userfiltermodel.h"
 
 #include "models/userlistmodel.h"
+#include "neochatroom.h"
 
 bool UserFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
 {
     Q_UNUSED(sourceParent);
-    if (!m_allowEmpty && m_filterText.isEmpty()) {
-        return false;
+    if (m_filterText.isEmpty()) {
+        return m_allowEmpty
+            && sourceModel()->data(sourceModel()->index(sourceRow, 0), UserListModel::MembershipRole).value<Quotient::Membership>()
+            == Quotient::Membership::Join;
     }
-    if (sourceModel()->data(sourceModel()->index(sourceRow, 0), UserListModel::MembershipRole).value<Quotient::Membership>() != Quotient::Membership::Join) {
+
+    const auto currentRoom = room();
+    if (!currentRoom) {
         return false;
     }
-    return sourceModel()->data(sourceModel()->index(sourceRow, 0), UserListModel::DisplayNameRole).toString().contains(m_filterText, Qt::CaseInsensitive)
-        || sourceModel()->data(sourceModel()->index(sourceRow, 0), UserListModel::UserIdRole).toString().contains(m_filterText, Qt::CaseInsensitive);
+    // The index only has joined members.
+    const auto &index = currentRoom->memberSearchIndex();
+    if (m_matchesRoom != currentRoom || m_matchesRevision != index.revision()) {
+        const auto matches = index.search(m_filterText);
+        m_matches = QSet<QString>(matches.cbegin(), matches.cend());
+        m_matchesRoom = currentRoom;
+        m_matchesRevision = index.revision();
+    }
+    return m_matches.contains(sourceModel()->data(sourceModel()->index(sourceRow, 0), UserListModel::UserIdRole).toString());
+}
+
+NeoChatRoom *UserFilterModel::room() const
+{
+    const auto userListModel = qobject_cast<UserListModel *>(sourceModel());
+    return userListModel ? userListModel->room() : nullptr;
 }
 
 QString UserFilterModel::filterText() const
@@ -27,6 +45,7 @@ void UserFilterModel::setFilterText(const QString &filterText)
 {
     beginFilterChange();
     m_filterText = filterText;
+    m_matchesRoom = nullptr;
     endFilterChange();
     Q_EMIT filterTextChanged();
 }
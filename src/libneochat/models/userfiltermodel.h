@@ -3,15 +3,25 @@
 
 #pragma once
 
+#include <QPointer>
 #include <QQmlEngine>
+#include <QSet>
 #include <QSortFilterProxyModel>
 
+class NeoChatRoom;
+
 /**
  * @class UserFilterModel
  *
  * This class creates a custom QSortFilterProxyModel for filtering a users by either
  * display name or matrix ID. The filter can accept a full matrix id i.e. example:kde.org
  * to separate between accounts on different servers with similar names.
+ *
+ * The source model must be a UserListModel. The matching members are looked up in
+ * the MemberSearchIndex of its room once per filter text, and again only when the
+ * members of the room change, so a row is accepted with a single hash lookup.
+ *
+ * @sa MemberSearchIndex
  */
 class UserFilterModel : public QSortFilterProxyModel
 {
@@ -30,7 +40,7 @@ public:
     using QSortFilterProxyModel::QSortFilterProxyModel;
 
     /**
-     * @brief Custom filter function checking boith the display name and matrix ID.
+     * @brief Custom filter function checking whether the display name or matrix ID, or one of their words, start with the filter text.
      *
      * @note The filter cannot be modified and will always use the same filter properties.
      */
@@ -42,6 +52,11 @@ public:
     bool allowEmpty() const;
     void setAllowEmpty(bool allowEmpty);
 
+    /**
+     * @brief The room of the source UserListModel, if any.
+     */
+    NeoChatRoom *room() const;
+
 Q_SIGNALS:
     void filterTextChanged();
     void allowEmptyChanged();
@@ -49,4 +64,9 @@ Q_SIGNALS:
 private:
     QString m_filterText;
     bool m_allowEmpty = false;
+
+    // The members matching m_filterText, as of revision m_matchesRevision of the index of m_matchesRoom.
+    mutable QSet<QString> m_matches;
+    mutable QPointer<NeoChatRoom> m_matchesRoom;
+    mutable quint64 m_matchesRevision = 0;
 };
@@ -3,16 +3,35 @@
 
 #include "userlistmodel.h"
 
+#include <QCollator>
 #include <QGuiApplication>
 
+#include <algorithm>
+#include <iterator>
+
 #include <Quotient/avatar.h>
-#include <Quotient/events/roompowerlevelsevent.h>
 
 #include "enums/powerlevel.h"
 #include "neochatroom.h"
 
 using namespace Quotient;
 
+namespace
+{
+// Above this many members joining at once, the list is rebuilt instead of shifting it for every one of them.
+constexpr qsizetype MaxSingleInserts = 100;
+
+QCollator &nameCollator()
+{
+    static QCollator collator = [] {
+        QCollator collator;
+        collator.setCaseSensitivity(Qt::CaseInsensitive);
+        return collator;
+    }();
+    return collator;
+}
+}
+
 UserListModel::UserListModel(QObject *parent)
     : QAbstractListModel(parent)
 {
@@ -33,6 +52,8 @@ void UserListModel::setRoom(NeoChatRoom *room)
         m_currentRoom->connection()->disconnect(this);
         m_currentRoom = nullptr;
         m_members.clear();
+        m_memberKeys.clear();
+        m_pendingJoins.clear();
         endResetModel();
     }
 
@@ -46,6 +67,7 @@ void UserListModel::setRoom(NeoChatRoom *room)
         connect(m_currentRoom, &Room::memberAvatarUpdated, this, [this](RoomMember member) {
             refreshMember(member, {AvatarRole});
         });
+        connect(m_currentRoom, &NeoChatRoom::powerLevelsChanged, this, &UserListModel::refreshPowerLevels);
         connect(m_currentRoom->connection(), &Connection::loggedOut, this, [this]() {
             setRoom(nullptr);
         });
@@ -74,7 +96,7 @@ QVariant UserListModel::data(const QModelIndex &index, int role) const
                     "users.count()";
         return {};
     }
-    const auto &memberId = m_members.at(index.row());
+    const auto &memberId = m_members.at(index.row()).id;
     if (role == DisplayNameRole) {
         return m_currentRoom->member(memberId).disambiguatedName();
     }
@@ -88,28 +110,21 @@ QVariant UserListModel::data(const QModelIndex &index, int role) const
         return QVariant::fromValue(memberId);
     }
     if (role == PowerLevelRole) {
-        if (m_currentRoom->isCreator(memberId)) {
-            return std::numeric_limits<int>::max();
-        }
-        auto plEvent = m_currentRoom->currentState().get<RoomPowerLevelsEvent>();
-        if (!plEvent) {
-            return 0;
-        }
-        return plEvent->powerLevelForUser(memberId);
+        return m_currentRoom->powerLevels().userLevel(memberId);
     }
     if (role == PowerLevelStringRole) {
-        if (m_currentRoom->roomCreatorHasUltimatePowerLevel() && m_currentRoom->isCreator(memberId)) {
+        const auto &powerLevels = m_currentRoom->powerLevels();
+        if (powerLevels.isCreator(memberId)) {
             return i18nc("@info the person that created this room", "Creator");
         }
 
-        auto pl = m_currentRoom->currentState().get<RoomPowerLevelsEvent>();
-        // User might not in the room yet, in this case pl can be nullptr.
+        // User might not in the room yet, in this case there are no power levels.
         // e.g. When invited but user not accepted or denied the invitation.
-        if (!pl) {
+        if (!powerLevels.isValid()) {
             return u"Not Available"_s;
         }
 
-        auto userPl = pl->powerLevelForUser(memberId);
+        auto userPl = powerLevels.userLevel(memberId);
 
         if (PowerLevel::levelForValue(userPl) == PowerLevel::Custom) {
             return i18nc("%1 is the name of the power level, e.g. admin and %2 is the value that represents.",
@@ -121,7 +136,7 @@ QVariant UserListModel::data(const QModelIndex &index, int role) const
         return PowerLevel::nameForLevel(PowerLevel::levelForValue(userPl));
     }
     if (role == IsCreatorRole) {
-        return m_currentRoom->isCreator(memberId);
+        return m_currentRoom->powerLevels().isCreator(memberId);
     }
     if (role == MembershipRole) {
         return QVariant::fromValue(m_currentRoom->member(memberId).membershipState());
@@ -153,42 +168,159 @@ bool UserListModel::eventFilter(QObject *obj, QEvent *event)
 
 void UserListModel::memberJoined(const Quotient::RoomMember &member)
 {
-    if (m_members.contains(member.id())) {
+    // The members are all added when the model is activated.
+    if (!m_active || m_memberKeys.contains(member.id())) {
         return;
     }
 
-    const int row = m_members.size();
-    beginInsertRows(QModelIndex(), row, row);
-    m_members.append(member.id());
-    endInsertRows();
+    if (m_pendingJoins.isEmpty()) {
+        QMetaObject::invokeMethod(this, &UserListModel::insertPendingMembers, Qt::QueuedConnection);
+    }
+    m_pendingJoins.insert(member.id());
+}
+
+void UserListModel::insertPendingMembers()
+{
+    if (!m_currentRoom || m_pendingJoins.isEmpty()) {
+        m_pendingJoins.clear();
+        return;
+    }
+
+    QList<Member> joined;
+    joined.reserve(m_pendingJoins.size());
+    for (const auto &userId : std::as_const(m_pendingJoins)) {
+        if (!m_memberKeys.contains(userId)) {
+            joined += makeMember(userId);
+        }
+    }
+    m_pendingJoins.clear();
+    std::ranges::sort(joined, &UserListModel::lessThan);
+
+    if (joined.size() > MaxSingleInserts) {
+        beginResetModel();
+        QList<Member> members;
+        members.reserve(m_members.size() + joined.size());
+        std::ranges::merge(m_members, joined, std::back_inserter(members), &UserListModel::lessThan);
+        m_members = std::move(members);
+        for (const auto &member : std::as_const(joined)) {
+            m_memberKeys.insert(member.id, member);
+        }
+        endResetModel();
+        return;
+    }
+
+    for (auto &member : joined) {
+        const int row = std::ranges::lower_bound(std::as_const(m_members), member, &UserListModel::lessThan) - m_members.cbegin();
+        beginInsertRows(QModelIndex(), row, row);
+        m_memberKeys.insert(member.id, member);
+        m_members.insert(row, std::move(member));
+        endInsertRows();
+    }
 }
 
 void UserListModel::refreshMember(const Quotient::RoomMember &member, const QList<int> &roles)
 {
+    if (roles.contains(DisplayNameRole)) {
+        updateMemberPosition(member.id());
+    }
+
     const auto pos = findUserPos(member);
     if (pos >= 0) {
         Q_EMIT dataChanged(index(pos), index(pos), roles);
-    } else {
+    } else if (!m_pendingJoins.contains(member.id())) {
         qWarning() << "Trying to access a room member not in the user list";
     }
 }
 
+void UserListModel::updateMemberPosition(const QString &userId)
+{
+    const auto from = findUserPos(userId);
+    if (from < 0) {
+        return;
+    }
+
+    auto member = makeMember(userId);
+    // Where the member goes once taken out of their current row.
+    int to = std::ranges::lower_bound(std::as_const(m_members), member, &UserListModel::lessThan) - m_members.cbegin();
+    if (to > from) {
+        --to;
+    }
+
+    m_memberKeys[userId] = member;
+    if (to == from) {
+        m_members[from] = std::move(member);
+        return;
+    }
+
+    beginMoveRows(QModelIndex(), from, from, QModelIndex(), to > from ? to + 1 : to);
+    m_members.move(from, to);
+    m_members[to] = std::move(member);
+    endMoveRows();
+}
+
+void UserListModel::refreshPowerLevels()
+{
+    const auto &powerLevels = m_currentRoom->powerLevels();
+    QStringList changed;
+    for (const auto &member : std::as_const(m_members)) {
+        if (powerLevels.userLevel(member.id) != member.powerLevel) {
+            changed += member.id;
+        }
+    }
+
+    for (const auto &userId : std::as_const(changed)) {
+        updateMemberPosition(userId);
+        const auto pos = findUserPos(userId);
+        Q_EMIT dataChanged(index(pos), index(pos), {PowerLevelRole, PowerLevelStringRole, IsCreatorRole});
+    }
+}
+
 void UserListModel::refreshAllMembers()
 {
     beginResetModel();
+    m_members.clear();
+    m_memberKeys.clear();
+    m_pendingJoins.clear();
     if (m_currentRoom != nullptr) {
-        // Only sort members when this model needs to be refreshed.
-        if (m_currentRoom->sortedMemberIds().isEmpty()) {
-            m_currentRoom->sortAllMembers();
+        const auto memberIds = m_currentRoom->memberIds();
+        m_members.reserve(memberIds.size());
+        m_memberKeys.reserve(memberIds.size());
+        for (const auto &memberId : memberIds) {
+            auto member = makeMember(memberId);
+            m_memberKeys.insert(memberId, member);
+            m_members += std::move(member);
         }
-        m_members = m_currentRoom->sortedMemberIds();
-    } else {
-        m_members.clear();
+        std::ranges::sort(m_members, &UserListModel::lessThan);
     }
     endResetModel();
     Q_EMIT usersRefreshed();
 }
 
+bool UserListModel::lessThan(const Member &left, const Member &right)
+{
+    if (left.powerLevel != right.powerLevel) {
+        return left.powerLevel > right.powerLevel;
+    }
+    if (const auto result = left.name->compare(*right.name); result != 0) {
+        return result < 0;
+    }
+    return left.id < right.id;
+}
+
+UserListModel::Member UserListModel::makeMember(const QString &userId) const
+{
+    auto name = m_currentRoom->member(userId).disambiguatedName();
+    // Like Quotient's MemberSorter, so that members without a display name aren't all placed first.
+    if (name.startsWith(u'@')) {
+        name.remove(0, 1);
+    }
+    return {
+        .id = userId,
+        .powerLevel = m_currentRoom->powerLevels().userLevel(userId),
+        .name = nameCollator().sortKey(name),
+    };
+}
+
 int UserListModel::findUserPos(const RoomMember &member) const
 {
     return findUserPos(member.id());
@@ -196,10 +328,12 @@ int UserListModel::findUserPos(const RoomMember &member) const
 
 int UserListModel::findUserPos(const QString &userId) const
 {
-    if (!m_currentRoom) {
+    const auto key = m_memberKeys.constFind(userId);
+    if (!m_currentRoom || key == m_memberKeys.cend()) {
         return -1;
     }
-    return m_members.indexOf(userId);
+    const auto it = std::ranges::lower_bound(m_members, *key, &UserListModel::lessThan);
+    return it != m_members.cend() && it->id == userId ? it - m_members.cbegin() : -1;
 }
 
 QHash<int, QByteArray> UserListModel::roleNames() const
@@ -6,9 +6,13 @@
 #include <Quotient/room.h>
 
 #include <QAbstractListModel>
+#include <QCollatorSortKey>
 #include <QObject>
 #include <QPointer>
 #include <QQmlEngine>
+#include <QSet>
+
+#include <optional>
 
 class NeoChatRoom;
 
@@ -23,7 +27,13 @@ class User;
  * This class defines the model for listing the users in a room.
  *
  * As well as gathering all the users from a room, the model ensures that they are
- * sorted in alphabetical order.
+ * sorted by power level, highest first, and then in alphabetical order of their
+ * display names. Members without a display name are placed by their id, ignoring
+ * the leading '@'.
+ *
+ * Members joining are inserted at their sorted position and renamed members are
+ * moved to theirs. Joins are collected until control returns to the event loop,
+ * so a sync with many joins is applied at once.
  *
  * @sa NeoChatRoom
  */
@@ -93,13 +103,31 @@ private Q_SLOTS:
     void memberJoined(const Quotient::RoomMember &member);
     void refreshMember(const Quotient::RoomMember &member, const QList<int> &roles = {});
     void refreshAllMembers();
+    void refreshPowerLevels();
 
 private:
+    struct Member {
+        QString id;
+        int powerLevel = 0;
+        std::optional<QCollatorSortKey> name;
+    };
+
+    static bool lessThan(const Member &left, const Member &right);
+    Member makeMember(const QString &userId) const;
+
     QPointer<NeoChatRoom> m_currentRoom;
-    QList<QString> m_members;
+    // In row order.
+    QList<Member> m_members;
+    // The sort key each member in m_members was placed with, to find their row.
+    QHash<QString, Member> m_memberKeys;
+    // Members that joined since the last insertPendingMembers().
+    QSet<QString> m_pendingJoins;
 
     bool m_active = false;
 
+    void insertPendingMembers();
+    void updateMemberPosition(const QString &userId);
+
     int findUserPos(const Quotient::RoomMember &member) const;
     [[nodiscard]] int findUserPos(const QString &username) const;
 };
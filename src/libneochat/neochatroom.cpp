@@ -4,13 +4,12 @@
 #include "neochatroom.h"
 #include "chatbartype.h"
 
+#include <QFile>
 #include <QFileInfo>
-#include <QMediaMetaData>
-#include <QMediaPlayer>
+#include <QFutureWatcher>
 #include <QMimeDatabase>
+#include <QPointer>
 #include <QTemporaryFile>
-#include <QVideoFrame>
-#include <QVideoSink>
 
 #include <Quotient/events/eventcontent.h>
 #include <Quotient/events/eventrelation.h>
@@ -19,7 +18,9 @@
 #include <Quotient/jobs/basejob.h>
 #include <Quotient/quotient_common.h>
 #include <memory>
+#include <qcoro/qcorofuture.h>
 #include <qcoro/qcorosignal.h>
+#include <QtConcurrent>
 
 #include <Quotient/avatar.h>
 #include <Quotient/connection.h>
@@ -44,12 +45,16 @@
 #include <Quotient/thread.h>
 
 #include "clipboard.h"
+#include "downloadindex.h"
+#include "draftstore.h"
 #include "eventhandler.h"
 #include "filetransferpseudojob.h"
 #include "neochatconnection.h"
 #include "roomlastmessageprovider.h"
 #include "spacehierarchycache.h"
+#include "uploadpreparation.h"
 #include "urlhelper.h"
+#include "videothumbnailextractor.h"
 #include "jobs/neochatreportroomjob.h"
 
 #if Quotient_VERSION_MINOR < 10
@@ -69,6 +74,7 @@ using namespace Quotient;
 using namespace std::ranges::views;
 
 bool NeoChatRoom::m_typingNotificationActive = true;
+int NeoChatRoom::m_uploadImageMaxDimension = 0;
 
 std::function<bool(const Quotient::RoomEvent *)> NeoChatRoom::m_hiddenFilter = [](const Quotient::RoomEvent *) -> bool {
     return false;
@@ -105,15 +111,30 @@ NeoChatRoom::NeoChatRoom(Connection *c, QString roomId, JoinState joinState)
             if (mxcUrl.isEmpty()) {
                 return;
             }
-            KSharedConfig::openStateConfig(u"neochatdownloads"_s)
-                ->group(u"downloads"_s)
-                .writePathEntry(mxcUrl.mid(6), fileTransferInfo(eventId).localPath.toLocalFile());
+            DownloadIndex::instance().insert(mxcUrl.mid(6), fileTransferInfo(eventId).localPath.toLocalFile());
         }
     });
 
     connect(this, &Room::addedMessages, this, &NeoChatRoom::readMarkerLoadedChanged);
     connect(this, &Room::aboutToAddHistoricalMessages, this, &NeoChatRoom::cleanupExtraEventRange);
     connect(this, &Room::aboutToAddNewMessages, this, &NeoChatRoom::cleanupExtraEventRange);
+    connect(this, &Room::aboutToAddHistoricalMessages, this, &NeoChatRoom::updateMemberActivity);
+    connect(this, &Room::aboutToAddNewMessages, this, &NeoChatRoom::updateMemberActivity);
+    connect(this, &Room::memberJoined, this, [this](const RoomMember &member) {
+        if (m_memberSearchIndex) {
+            m_memberSearchIndex->insert(member.id(), member.displayName());
+        }
+    });
+    connect(this, &Room::memberNameUpdated, this, [this](const RoomMember &member) {
+        if (m_memberSearchIndex && m_memberSearchIndex->contains(member.id())) {
+            m_memberSearchIndex->insert(member.id(), member.displayName());
+        }
+    });
+    connect(this, &Room::memberLeft, this, [this](const RoomMember &member) {
+        if (m_memberSearchIndex) {
+            m_memberSearchIndex->remove(member.id());
+        }
+    });
 
     if (RoomLastMessageProvider::self().hasKey(id())) {
         if (auto eventJson = QJsonDocument::fromJson(RoomLastMessageProvider::self().read(id())).object(); !eventJson.isEmpty()) {
@@ -123,6 +144,8 @@ NeoChatRoom::NeoChatRoom(Connection *c, QString roomId, JoinState joinState)
         }
     }
     connect(this, &Room::addedMessages, this, &NeoChatRoom::cacheLastEvent);
+    // Encrypted events only become messages once they are decrypted.
+    connect(this, &Room::replacedEvent, this, &NeoChatRoom::updateLastMessageEvent);
 
     connect(this, &Room::eventsHistoryJobChanged, this, &NeoChatRoom::lastActiveTimeChanged);
 
@@ -163,6 +186,12 @@ NeoChatRoom::NeoChatRoom(Connection *c, QString roomId, JoinState joinState)
     connect(this, &Room::changed, this, [this]() {
         Q_EMIT defaultUrlPreviewStateChanged();
     });
+    connect(this, &Room::changed, this, [this]() {
+        if (const auto version = powerLevels().version(); version != m_notifiedPowerLevelsVersion) {
+            m_notifiedPowerLevelsVersion = version;
+            Q_EMIT powerLevelsChanged();
+        }
+    });
     connect(this, &Room::accountDataChanged, this, [this](const QString &type) {
         if (type == "org.matrix.room.preview_urls"_L1) {
             Q_EMIT urlPreviewEnabledChanged();
@@ -185,17 +214,14 @@ NeoChatRoom::NeoChatRoom(Connection *c, QString roomId, JoinState joinState)
 
     connect(connection, &NeoChatConnection::globalUrlPreviewEnabledChanged, this, &NeoChatRoom::urlPreviewEnabledChanged);
     connect(this, &Room::fullyReadMarkerMoved, this, &NeoChatRoom::invalidateLastUnreadHighlightId);
+}
 
-    // This may look weird, but this is actually for performance.
-    // We only want to listen to new member joining *when* the initial member list was loaded.
-    connect(
-        this,
-        &Room::memberListChanged,
-        this,
-        [this] {
-            connect(this, &Room::memberJoined, this, &NeoChatRoom::insertMemberSorted);
-        },
-        Qt::SingleShotConnection);
+NeoChatRoom::~NeoChatRoom()
+{
+    // The rooms are destroyed before the store, which can't read the caches after this.
+    if (m_draftStore) {
+        m_draftStore->untrack(id());
+    }
 }
 
 bool NeoChatRoom::visible() const
@@ -271,62 +297,109 @@ QCoro::Task<void> NeoChatRoom::doUploadFile(QUrl url, QString body, std::optiona
     QFileInfo fileInfo(url.isLocalFile() ? url.toLocalFile() : url.toString());
 
     const auto mime = QMimeDatabase().mimeTypeForUrl(url);
+#ifndef Q_OS_ANDROID
+    QPointer<FileTransferPseudoJob> job;
+#endif
+    QString temporaryFilePath;
     EventContent::FileContentBase *content = nullptr;
     if (mime.name().startsWith("image/"_L1)) {
-        const QImage image(url.toLocalFile());
-        content = new EventContent::ImageContent(url, fileInfo.size(), mime, image.size(), fileInfo.fileName());
+        const auto future = QtConcurrent::run(&UploadPreparation::prepareImage, url.toLocalFile(), m_uploadImageMaxDimension);
+        setHasFileUploading(true);
+#ifndef Q_OS_ANDROID
+        job = new FileTransferPseudoJob(FileTransferPseudoJob::Upload, url.toLocalFile(), {});
+        KIO::getJobTracker()->registerJob(job);
+        job->start();
+        QFutureWatcher<PreparedImage> watcher;
+        connect(&watcher, &QFutureWatcherBase::progressValueChanged, job, [job = job.data()](int progress) {
+            job->setPreparationProgress(progress, UploadPreparation::imageSteps);
+        });
+        watcher.setFuture(future);
+#endif
+        const auto prepared = co_await future;
+
+#ifndef Q_OS_ANDROID
+        // The job is gone if the upload was cancelled while it was being prepared.
+        if (!job) {
+            if (prepared.temporaryFile) {
+                QFile::remove(prepared.filePath);
+            }
+            if (!prepared.thumbnailPath.isEmpty()) {
+                QFile::remove(prepared.thumbnailPath);
+            }
+            setHasFileUploading(false);
+            co_return;
+        }
+#endif
+        if (prepared.temporaryFile) {
+            temporaryFilePath = prepared.filePath;
+            url = QUrl::fromLocalFile(prepared.filePath);
+        }
+
+        const auto imageContent = new UploadPreparation::BlurhashContent<EventContent::ImageContent>(url,
+                                                                                                    prepared.fileSize,
+                                                                                                    prepared.mimeType.isValid() ? prepared.mimeType : mime,
+                                                                                                    prepared.size,
+                                                                                                    fileInfo.fileName());
+        if (!prepared.thumbnailPath.isEmpty()) {
+            // The thumbnail would be uploaded unencrypted, giving the image away in encrypted rooms.
+            if (!usesEncryption()) {
+                const auto thumbnailJob = connection()->uploadFile(prepared.thumbnailPath);
+                co_await qCoro(thumbnailJob.get(), &BaseJob::finished);
+                if (thumbnailJob->status() == BaseJob::Success) {
+                    imageContent->thumbnail = EventContent::Thumbnail(thumbnailJob->contentUri(),
+                                                                      prepared.thumbnailFileSize,
+                                                                      QMimeDatabase().mimeTypeForName(u"image/jpeg"_s),
+                                                                      prepared.thumbnailSize);
+                }
+            }
+            QFile::remove(prepared.thumbnailPath);
+        }
+        imageContent->blurhash = prepared.blurhash;
+        content = imageContent;
     } else if (mime.name().startsWith("audio/"_L1)) {
         content = new EventContent::AudioContent(url, fileInfo.size(), mime, fileInfo.fileName());
     } else if (mime.name().startsWith("video/"_L1)) {
-        QVideoSink sink;
-        QMediaPlayer player;
-        player.setSource(url);
-        player.setVideoSink(&sink);
-        co_await qCoro(&player, &QMediaPlayer::mediaStatusChanged);
-
-        // Get the first video frame to use as a thumbnail.
-        player.play();
-        co_await qCoro(&player, &QMediaPlayer::positionChanged);
-
-        QTemporaryFile file;
-        file.setFileTemplate(QStringLiteral("XXXXXX.jpg"));
-        auto ok = file.open();
-        if (!ok) {
-            qWarning() << "Failed to open" << file.fileName() << file.errorString();
+        setHasFileUploading(true);
+        const auto extracted = co_await VideoThumbnailExtractor::instance().extract(url);
+
+        const auto videoContent =
+            new UploadPreparation::BlurhashContent<EventContent::VideoContent>(url, fileInfo.size(), mime, extracted.videoSize, fileInfo.fileName());
+        if (const auto &thumbnail = extracted.thumbnail; !thumbnail.path.isEmpty()) {
+            // The thumbnail would be uploaded unencrypted, giving the video away in encrypted rooms.
+            if (!usesEncryption()) {
+                const auto thumbnailJob = connection()->uploadFile(thumbnail.path);
+                co_await qCoro(thumbnailJob.get(), &BaseJob::finished);
+                if (thumbnailJob->status() == BaseJob::Success) {
+                    videoContent->thumbnail =
+                        EventContent::Thumbnail(thumbnailJob->contentUri(), thumbnail.fileSize, QMimeDatabase().mimeTypeForName(u"image/jpeg"_s), thumbnail.size);
+                }
+            }
+            QFile::remove(thumbnail.path);
+            videoContent->blurhash = thumbnail.blurhash;
         }
-
-        const auto thumbnailImage = sink.videoFrame().toImage();
-        Q_UNUSED(thumbnailImage.save(file.fileName()))
-        player.stop(); // We have to delay the stop() because it will invalidate our image
-
-        const auto thumbnailFileInfo = QFileInfo(file.fileName());
-
-        // Upload the thumbnail
-        const auto job = connection()->uploadFile(thumbnailFileInfo.absoluteFilePath());
-        co_await qCoro(job.get(), &BaseJob::finished);
-
-        const auto resolution = player.metaData().value(QMediaMetaData::Resolution).toSize();
-        content = new EventContent::VideoContent(url, fileInfo.size(), mime, resolution, fileInfo.fileName());
-        content->thumbnail = EventContent::Thumbnail(job->contentUri(),
-                                                     thumbnailFileInfo.size(),
-                                                     QMimeDatabase().mimeTypeForName(QStringLiteral("image/jpeg")),
-                                                     thumbnailImage.size());
+        content = videoContent;
     } else {
         content = new EventContent::FileContent(url, fileInfo.size(), mime, fileInfo.fileName());
     }
 
-    const auto txnId = postFile(body.isEmpty() ? url.fileName() : body, std::unique_ptr<EventContent::FileContentBase>(content), relatesTo);
+    const auto txnId = postFile(body.isEmpty() ? fileInfo.fileName() : body, std::unique_ptr<EventContent::FileContentBase>(content), relatesTo);
     setHasFileUploading(true);
-    connect(this, &Room::fileTransferCompleted, [this, txnId](const QString &id, FileSourceInfo) {
+    connect(this, &Room::fileTransferCompleted, [this, txnId, temporaryFilePath](const QString &id, FileSourceInfo) {
         if (id == txnId) {
             setFileUploadingProgress(0);
             setHasFileUploading(false);
+            if (!temporaryFilePath.isEmpty()) {
+                QFile::remove(temporaryFilePath);
+            }
         }
     });
-    connect(this, &Room::fileTransferFailed, [this, txnId](const QString &id, const QString & /*error*/) {
+    connect(this, &Room::fileTransferFailed, [this, txnId, temporaryFilePath](const QString &id, const QString & /*error*/) {
         if (id == txnId) {
             setFileUploadingProgress(0);
             setHasFileUploading(false);
+            if (!temporaryFilePath.isEmpty()) {
+                QFile::remove(temporaryFilePath);
+            }
         }
     });
     connect(this, &Room::fileTransferProgress, [this, txnId](const QString &id, qint64 progress, qint64 total) {
@@ -335,7 +408,11 @@ QCoro::Task<void> NeoChatRoom::doUploadFile(QUrl url, QString body, std::optiona
         }
     });
 #ifndef Q_OS_ANDROID
-    auto job = new FileTransferPseudoJob(FileTransferPseudoJob::Upload, url.toLocalFile(), txnId);
+    if (job) {
+        job->setEventId(txnId);
+    } else {
+        job = new FileTransferPseudoJob(FileTransferPseudoJob::Upload, url.toLocalFile(), txnId);
+    }
     connect(this, &Room::fileTransferProgress, job, &FileTransferPseudoJob::fileTransferProgress);
     connect(this, &Room::fileTransferCompleted, job, &FileTransferPseudoJob::fileTransferCompleted);
     connect(this, &Room::fileTransferFailed, job, [this, job, txnId] {
@@ -346,8 +423,10 @@ QCoro::Task<void> NeoChatRoom::doUploadFile(QUrl url, QString body, std::optiona
         }
     });
     connect(job, &FileTransferPseudoJob::cancelRequested, this, &Room::cancelFileTransfer);
-    KIO::getJobTracker()->registerJob(job);
-    job->start();
+    if (!mime.name().startsWith("image/"_L1)) {
+        KIO::getJobTracker()->registerJob(job);
+        job->start();
+    }
 #endif
 }
 
@@ -380,6 +459,11 @@ void NeoChatRoom::setTypingNotificationsActive(bool typingNotificationActive)
     m_typingNotificationActive = typingNotificationActive;
 }
 
+void NeoChatRoom::setUploadImageMaxDimension(int maxDimension)
+{
+    m_uploadImageMaxDimension = maxDimension;
+}
+
 void NeoChatRoom::sendTypingNotification(bool isTyping)
 {
     // During the chatbar setup sequence, this may get called while we're still initializing
@@ -489,6 +573,7 @@ void NeoChatRoom::onAddNewTimelineEvents(timeline_iter_t from)
 {
     std::for_each(from, messageEvents().cend(), [this](const TimelineItem &ti) {
         checkForHighlights(ti);
+        updateLastMessageEvent(ti.get());
     });
 }
 
@@ -496,9 +581,26 @@ void NeoChatRoom::onAddHistoricalTimelineEvents(rev_iter_t from)
 {
     std::for_each(from, messageEvents().crend(), [this](const TimelineItem &ti) {
         checkForHighlights(ti);
+        updateLastMessageEvent(ti.get());
     });
 }
 
+void NeoChatRoom::updateLastMessageEvent(const RoomEvent *event)
+{
+    const auto roomMessageEvent = eventCast<const RoomMessageEvent>(event);
+    if (!roomMessageEvent || (!roomMessageEvent->replacedEvent().isEmpty() && roomMessageEvent->replacedEvent() != roomMessageEvent->id())) {
+        return;
+    }
+    if (!m_lastMessageEventId.isEmpty()) {
+        // Newer events are closer to the start of the reversed timeline.
+        const auto it = findInTimeline(roomMessageEvent->id());
+        if (it == historyEdge() || it >= findInTimeline(m_lastMessageEventId)) {
+            return;
+        }
+    }
+    m_lastMessageEventId = roomMessageEvent->id();
+}
+
 void NeoChatRoom::onRedaction(const RoomEvent &prevEvent, const RoomEvent & /*after*/)
 {
     if (const auto &reactionEvent = eventCast<const ReactionEvent>(&prevEvent)) {
@@ -582,34 +684,70 @@ bool NeoChatRoom::containsUser(const QString &userID) const
     return memberState(userID) != Membership::Leave;
 }
 
-bool NeoChatRoom::canSendEvent(const QString &eventType) const
+const PowerLevelTable &NeoChatRoom::powerLevels() const
 {
-    if (roomCreatorHasUltimatePowerLevel() && isCreator(localMember().id())) {
-        return true;
+    const auto powerLevelsEvent = currentState().get<RoomPowerLevelsEvent>();
+    const auto createEvent = currentState().get<RoomCreateEvent>();
+    const auto powerLevelsEventId = powerLevelsEvent ? powerLevelsEvent->id() : QString();
+    if (m_powerLevels.version() > 0 && powerLevelsEvent == m_powerLevelsEvent && powerLevelsEventId == m_powerLevelsEventId && createEvent == m_createEvent) {
+        return m_powerLevels;
     }
-    auto plEvent = currentState().get<RoomPowerLevelsEvent>();
-    if (!plEvent) {
-        return false;
+
+    QStringList creators;
+    if (createEvent && roomCreatorHasUltimatePowerLevel()) {
+        creators = createEvent->contentPart<QStringList>(u"additional_creators"_s);
+        creators.prepend(createEvent->senderId());
+    }
+    m_powerLevelsEvent = powerLevelsEvent;
+    m_powerLevelsEventId = powerLevelsEventId;
+    m_createEvent = createEvent;
+    m_powerLevels = PowerLevelTable(powerLevelsEvent, creators, m_powerLevels.version() + 1);
+    return m_powerLevels;
+}
+
+const MemberSearchIndex &NeoChatRoom::memberSearchIndex() const
+{
+    if (m_memberSearchIndex) {
+        return *m_memberSearchIndex;
     }
-    auto pl = plEvent->powerLevelForEvent(eventType);
-    auto currentPl = plEvent->powerLevelForUser(localMember().id());
 
-    return currentPl >= pl;
+    m_memberSearchIndex = std::make_unique<MemberSearchIndex>();
+    for (const auto &memberId : joinedMemberIds()) {
+        m_memberSearchIndex->insert(memberId, member(memberId).displayName());
+    }
+    for (const auto &item : messageEvents()) {
+        m_memberSearchIndex->setLastActive(item->senderId(), item->originTimestamp().toMSecsSinceEpoch());
+    }
+    return *m_memberSearchIndex;
 }
 
-bool NeoChatRoom::canSendState(const QString &eventType) const
+const RoomMessageEvent *NeoChatRoom::lastMessageEvent() const
 {
-    if (roomCreatorHasUltimatePowerLevel() && isCreator(localMember().id())) {
-        return true;
+    if (m_lastMessageEventId.isEmpty()) {
+        return nullptr;
     }
-    auto plEvent = currentState().get<RoomPowerLevelsEvent>();
-    if (!plEvent) {
-        return false;
+    const auto it = findInTimeline(m_lastMessageEventId);
+    return it != historyEdge() ? it->viewAs<RoomMessageEvent>() : nullptr;
+}
+
+void NeoChatRoom::updateMemberActivity(Quotient::RoomEventsRange events)
+{
+    if (!m_memberSearchIndex) {
+        return;
     }
-    auto pl = plEvent->powerLevelForState(eventType);
-    auto currentPl = plEvent->powerLevelForUser(localMember().id());
+    for (const auto &event : events) {
+        m_memberSearchIndex->setLastActive(event->senderId(), event->originTimestamp().toMSecsSinceEpoch());
+    }
+}
 
-    return currentPl >= pl;
+bool NeoChatRoom::canSendEvent(const QString &eventType) const
+{
+    return powerLevels().canSendEvent(localMember().id(), eventType);
+}
+
+bool NeoChatRoom::canSendState(const QString &eventType) const
+{
+    return powerLevels().canSendState(localMember().id(), eventType);
 }
 
 bool NeoChatRoom::readMarkerLoaded() const
@@ -1418,15 +1556,11 @@ FileTransferInfo NeoChatRoom::cachedFileTransferInfo(const Quotient::RoomEvent *
         return transferInfo;
     }
 
-    auto config = KSharedConfig::openStateConfig(u"neochatdownloads"_s)->group(u"downloads"_s);
-    if (!config.hasKey(mxcUrl.mid(6))) {
+    if (mxcUrl.isEmpty()) {
         return transferInfo;
     }
-
-    const auto path = config.readPathEntry(mxcUrl.mid(6), QString());
-    QFileInfo info(path);
-    if (!info.isFile()) {
-        config.deleteEntry(mxcUrl);
+    const auto download = DownloadIndex::instance().find(mxcUrl.mid(6));
+    if (!download) {
         return transferInfo;
     }
     // TODO: we could check the hash here
@@ -1435,26 +1569,49 @@ FileTransferInfo NeoChatRoom::cachedFileTransferInfo(const Quotient::RoomEvent *
         .isUpload = false,
         .progress = total,
         .total = total,
-        .localDir = QUrl(info.dir().path()),
-        .localPath = QUrl::fromLocalFile(path),
+        .localDir = QUrl(download->directory),
+        .localPath = QUrl::fromLocalFile(download->path),
     };
 }
 
 Blocks::Cache *NeoChatRoom::mainCache() const
 {
+    loadDrafts();
     return m_mainCache.get();
 }
 
 Blocks::Cache *NeoChatRoom::editCache() const
 {
+    loadDrafts();
     return m_editCache.get();
 }
 
 Blocks::Cache *NeoChatRoom::threadCache() const
 {
+    loadDrafts();
     return m_threadCache.get();
 }
 
+void NeoChatRoom::loadDrafts() const
+{
+    if (m_draftsLoaded) {
+        return;
+    }
+    m_draftsLoaded = true;
+    // The drafts are written to the disk in the clear.
+    if (usesEncryption()) {
+        return;
+    }
+    m_draftStore = DraftStore::forConnection(connection());
+    if (m_draftStore) {
+        m_draftStore->track(id(), m_mainCache.get(), m_editCache.get(), m_threadCache.get());
+        connect(this, &Room::encryption, m_draftStore.data(), [this] {
+            m_draftStore->remove(id());
+            m_draftStore.clear();
+        });
+    }
+}
+
 QString NeoChatRoom::lastMessageId()
 {
     const auto &timelineBottom = messageEvents().rbegin();
@@ -1847,9 +2004,7 @@ bool NeoChatRoom::roomCreatorHasUltimatePowerLevel() const
 
 bool NeoChatRoom::isCreator(const QString &userId) const
 {
-    auto createEvent = currentState().get<RoomCreateEvent>();
-    return roomCreatorHasUltimatePowerLevel() && createEvent
-        && (createEvent->senderId() == userId || createEvent->contentPart<QStringList>(u"additional_creators"_s).contains(userId));
+    return powerLevels().isCreator(userId);
 }
 
 QString NeoChatRoom::pinnedMessage() const
@@ -1910,41 +2065,6 @@ void NeoChatRoom::invalidateLastUnreadHighlightId(const QString &fromEventId, co
     }
 }
 
-void NeoChatRoom::sortAllMembers()
-{
-    m_sortedMemberIds = memberIds();
-
-    // Build up a temporary cache, because we may be checking the same member over and over while sorting.
-    QHash<QString, int> effectivePowerLevels;
-    effectivePowerLevels.reserve(m_sortedMemberIds.size());
-    for (const auto &member : std::as_const(m_sortedMemberIds)) {
-        effectivePowerLevels[member] = memberEffectivePowerLevel(member);
-    }
-
-    MemberSorter sorter;
-    std::ranges::sort(m_sortedMemberIds, [&sorter, &effectivePowerLevels](const auto &left, const auto &right) {
-        const auto leftPl = effectivePowerLevels[left];
-        const auto rightPl = effectivePowerLevels[right];
-        if (leftPl > rightPl) {
-            return true;
-        }
-        if (rightPl > leftPl) {
-            return false;
-        }
-
-        return sorter(left, right);
-    });
-}
-
-void NeoChatRoom::insertMemberSorted(const Quotient::RoomMember member)
-{
-    if (m_sortedMemberIds.contains(member.id())) {
-        return;
-    }
-
-    m_sortedMemberIds.append(member.id());
-}
-
 bool NeoChatRoom::spaceHasUnreadMessages() const
 {
     if (!isSpace()) {
@@ -1971,11 +2091,6 @@ void NeoChatRoom::markAllMessagesAsRead(bool sendPublicReceipts)
 #endif
 }
 
-QList<QString> NeoChatRoom::sortedMemberIds() const
-{
-    return m_sortedMemberIds;
-}
-
 QString NeoChatRoom::joinRuleString() const
 {
 #if Quotient_VERSION_MINOR < 10
@@ -2041,16 +2156,15 @@ QList<QString> NeoChatRoom::allowIds() const
 
 bool NeoChatRoom::isLowerEffectivePowerLevelThanLocalUser(const QString &userId) const
 {
-    if (isCreator(localMember().id()) && !isCreator(userId)) {
+    const auto &table = powerLevels();
+    const auto localUserId = localMember().id();
+    if (table.isCreator(localUserId) && !table.isCreator(userId)) {
         return true;
     }
-
-    const auto powerLevelsEvent = currentState().get<RoomPowerLevelsEvent>();
-    if (!powerLevelsEvent) {
+    if (!table.isValid()) {
         return false;
     }
-
-    return powerLevelsEvent->powerLevelForUser(userId) < powerLevelsEvent->powerLevelForUser(localMember().id());
+    return table.userLevel(userId) < table.userLevel(localUserId);
 }
 
 QString NeoChatRoom::forwardMessage(NeoChatRoom *targetRoom, const QString &eventId)
@@ -7,6 +7,7 @@
 #include <Quotient/room.h>
 
 #include <QObject>
+#include <QPointer>
 #include <QQmlEngine>
 
 #include <QCoroTask>
@@ -15,13 +16,17 @@
 #include "enums/messagetype.h"
 #include "enums/pushrule.h"
 #include "events/pollevent.h"
+#include "membersearchindex.h"
 #include "neochatroommember.h"
+#include "powerleveltable.h"
 
 namespace Quotient
 {
 class User;
 }
 
+class DraftStore;
+
 /**
  * @class NeoChatRoom
  *
@@ -237,6 +242,7 @@ class NeoChatRoom : public Quotient::Room
 
 public:
     explicit NeoChatRoom(Quotient::Connection *connection, QString roomId, Quotient::JoinState joinState = {});
+    ~NeoChatRoom() override;
 
     bool visible() const;
     void setVisible(bool visible);
@@ -314,6 +320,33 @@ public:
      */
     Q_INVOKABLE [[nodiscard]] bool isUserBanned(const QString &user) const;
 
+    /**
+     * @brief The power levels of the room.
+     *
+     * The table is parsed from the power levels event again only after the power
+     * levels or the creators of the room changed.
+     *
+     * @sa powerLevelsChanged()
+     */
+    [[nodiscard]] const PowerLevelTable &powerLevels() const;
+
+    /**
+     * @brief The search index over the joined members of the room.
+     *
+     * The index is built on first use and then kept up to date with the members
+     * joining, leaving and changing their name, and with the activity of the
+     * members in the timeline.
+     */
+    [[nodiscard]] const MemberSearchIndex &memberSearchIndex() const;
+
+    /**
+     * @brief The newest message event in the loaded timeline, or nullptr if there is none.
+     *
+     * Edits aren't counted as messages of their own. The id of the event is tracked as
+     * events are added to the timeline or decrypted, so this never walks the timeline.
+     */
+    [[nodiscard]] const Quotient::RoomMessageEvent *lastMessageEvent() const;
+
     /**
      * @brief True if the local user can send the given event type.
      */
@@ -579,7 +612,7 @@ public:
      * @brief Return the cached file transfer information for the event.
      *
      * If we downloaded the file previously, return a struct with Completed status
-     * and the local file path stored in KSharedConfig
+     * and the local file path recorded in the DownloadIndex
      */
     Quotient::FileTransferInfo cachedFileTransferInfo(const QString &eventId) const;
 
@@ -587,7 +620,7 @@ public:
      * @brief Return the cached file transfer information for the event.
      *
      * If we downloaded the file previously, return a struct with Completed status
-     * and the local file path stored in KSharedConfig
+     * and the local file path recorded in the DownloadIndex
      */
     Quotient::FileTransferInfo cachedFileTransferInfo(const Quotient::RoomEvent *event) const;
 
@@ -684,20 +717,6 @@ public:
      */
     Q_INVOKABLE void markAllMessagesAsRead(bool sendPublicReceipts = true);
 
-    /**
-     * @return List of members in this room, sorted by power level and then by name.
-     *
-     * This list is only populated after sortAllMembers() is called.
-     */
-    QList<QString> sortedMemberIds() const;
-
-    /**
-     * @brief Sort all members based on their display name, and power level.
-     *
-     * @note This is a very expensive operation, and should only be done when truly needed.
-     */
-    void sortAllMembers();
-
     [[nodiscard]] QString joinRuleString() const;
 
     /**
@@ -732,10 +751,19 @@ public:
 
     static void setTypingNotificationsActive(bool typingNotificationActive);
 
+    /**
+     * @brief Set the largest width or height of uploaded images.
+     *
+     * Larger images are downscaled before they are uploaded. 0 uploads images as they are.
+     */
+    static void setUploadImageMaxDimension(int maxDimension);
+
 private:
     bool m_visible = false;
 
     QSet<const Quotient::RoomEvent *> highlights;
+    QString m_lastMessageEventId;
+    void updateLastMessageEvent(const Quotient::RoomEvent *event);
 
     bool m_hasFileUploading = false;
     int m_fileUploadingProgress = 0;
@@ -756,20 +784,35 @@ private:
     std::unique_ptr<Blocks::Cache> m_mainCache;
     std::unique_ptr<Blocks::Cache> m_editCache;
     std::unique_ptr<Blocks::Cache> m_threadCache;
+    // The caches are filled from the DraftStore when one of them is first used.
+    mutable bool m_draftsLoaded = false;
+    mutable QPointer<DraftStore> m_draftStore;
+    void loadDrafts() const;
 
     std::vector<Quotient::event_ptr_tt<Quotient::RoomEvent>> m_extraEvents;
     void cleanupExtraEventRange(Quotient::RoomEventsRange events);
     void cleanupExtraEvent(const QString &eventId);
 
+    // Empty until memberSearchIndex() is first called.
+    mutable std::unique_ptr<MemberSearchIndex> m_memberSearchIndex;
+    void updateMemberActivity(Quotient::RoomEventsRange events);
+
     std::unordered_map<QString, std::unique_ptr<NeochatRoomMember>> m_memberObjects;
     static std::function<bool(const Quotient::RoomEvent *)> m_hiddenFilter;
     QString m_pinnedMessage;
     void loadPinnedMessage();
 
     QString m_lastUnreadHighlightId;
-    QList<QString> m_sortedMemberIds;
+
+    // The state events m_powerLevels was built from. The id guards against a new event at the same address.
+    mutable const Quotient::StateEvent *m_powerLevelsEvent = nullptr;
+    mutable QString m_powerLevelsEventId;
+    mutable const Quotient::StateEvent *m_createEvent = nullptr;
+    mutable PowerLevelTable m_powerLevels;
+    quint64 m_notifiedPowerLevelsVersion = 0;
 
     static bool m_typingNotificationActive;
+    static int m_uploadImageMaxDimension;
     QTimer *m_typingTimer;
 
 private Q_SLOTS:
@@ -779,9 +822,14 @@ private Q_SLOTS:
 
     void invalidateLastUnreadHighlightId(const QString &fromEventId, const QString &toEventId);
 
-    void insertMemberSorted(Quotient::RoomMember member);
-
 Q_SIGNALS:
+    /**
+     * @brief The power levels of the room have changed.
+     *
+     * @sa powerLevels()
+     */
+    void powerLevelsChanged();
+
     void cachedInputChanged();
     void busyChanged();
     void hasFileUploadingChanged();
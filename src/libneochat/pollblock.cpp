@@ -8,7 +8,6 @@
 #include "neochatroom.h"
 
 #include <Quotient/csapi/relations.h>
-#include <Quotient/events/roompowerlevelsevent.h>
 
 using namespace Quotient;
 using namespace Blocks;
@@ -74,12 +73,11 @@ void PollBlock::handleEvent(Quotient::RoomEvent *event)
             return;
         }
 
-        auto plEvent = m_room->currentState().get<RoomPowerLevelsEvent>();
-        if (!plEvent) {
+        const auto &powerLevels = m_room->powerLevels();
+        if (!powerLevels.isValid()) {
             return;
         }
-        auto userPl = plEvent->powerLevelForUser(event->senderId());
-        if (event->senderId() == pollStartEvent->senderId() || userPl >= plEvent->redact()) {
+        if (event->senderId() == pollStartEvent->senderId() || powerLevels.canPerform(event->senderId(), PowerLevelTable::Redact)) {
             m_hasEnded = true;
             m_endedTimestamp = event->originTimestamp();
             Q_EMIT hasEndedChanged();
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "powerleveltable.h"
+
+#include <Quotient/events/roompowerlevelsevent.h>
+
+#include <limits>
+
+PowerLevelTable::PowerLevelTable(const Quotient::RoomPowerLevelsEvent *event, const QStringList &creators, quint64 version)
+    : m_valid(event != nullptr)
+    , m_version(version)
+    , m_creators(creators)
+{
+    if (!event) {
+        return;
+    }
+    m_users = event->users();
+    m_events = event->events();
+    m_usersDefault = event->usersDefault();
+    m_eventsDefault = event->eventsDefault();
+    m_stateDefault = event->stateDefault();
+    m_ban = event->ban();
+    m_kick = event->kick();
+    m_invite = event->invite();
+    m_redact = event->redact();
+}
+
+bool PowerLevelTable::isValid() const
+{
+    return m_valid;
+}
+
+quint64 PowerLevelTable::version() const
+{
+    return m_version;
+}
+
+bool PowerLevelTable::isCreator(const QString &userId) const
+{
+    // There are at most a handful.
+    return m_creators.contains(userId);
+}
+
+int PowerLevelTable::userLevel(const QString &userId) const
+{
+    if (isCreator(userId)) {
+        return std::numeric_limits<int>::max();
+    }
+    return m_users.value(userId, m_usersDefault);
+}
+
+int PowerLevelTable::eventLevel(const QString &eventType) const
+{
+    return m_events.value(eventType, m_eventsDefault);
+}
+
+int PowerLevelTable::stateLevel(const QString &eventType) const
+{
+    return m_events.value(eventType, m_stateDefault);
+}
+
+int PowerLevelTable::actionLevel(Action action) const
+{
+    switch (action) {
+    case Ban:
+        return m_ban;
+    case Kick:
+        return m_kick;
+    case Invite:
+        return m_invite;
+    case Redact:
+        return m_redact;
+    }
+    return 0;
+}
+
+int PowerLevelTable::usersDefault() const
+{
+    return m_usersDefault;
+}
+
+int PowerLevelTable::eventsDefault() const
+{
+    return m_eventsDefault;
+}
+
+int PowerLevelTable::stateDefault() const
+{
+    return m_stateDefault;
+}
+
+QStringList PowerLevelTable::eventTypes() const
+{
+    return m_events.keys();
+}
+
+bool PowerLevelTable::canSendEvent(const QString &userId, const QString &eventType) const
+{
+    return isCreator(userId) || (m_valid && userLevel(userId) >= eventLevel(eventType));
+}
+
+bool PowerLevelTable::canSendState(const QString &userId, const QString &eventType) const
+{
+    return isCreator(userId) || (m_valid && userLevel(userId) >= stateLevel(eventType));
+}
+
+bool PowerLevelTable::canPerform(const QString &userId, Action action) const
+{
+    return isCreator(userId) || (m_valid && userLevel(userId) >= actionLevel(action));
+}
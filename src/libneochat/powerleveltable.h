@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+namespace Quotient
+{
+class RoomPowerLevelsEvent;
+}
+
+/**
+ * @class PowerLevelTable
+ *
+ * The power levels of a room, parsed from its m.room.power_levels event.
+ *
+ * Every query is a hash lookup at most, so models can use it for every row.
+ * NeoChatRoom keeps one per room and only rebuilds it when the power levels or
+ * the creators of the room change.
+ *
+ * @sa NeoChatRoom::powerLevels()
+ */
+class PowerLevelTable
+{
+public:
+    /**
+     * @brief The actions that have their own level in the power levels event.
+     */
+    enum Action {
+        Ban,
+        Kick,
+        Invite,
+        Redact,
+    };
+
+    /**
+     * @brief A table for a room without power levels event, in which only creators can do anything.
+     */
+    PowerLevelTable() = default;
+
+    /**
+     * @brief Create a table from @p event.
+     *
+     * @param creators The users that have an infinite power level, for room versions where
+     *                 creators have one.
+     * @param version Distinguishes this table from the earlier ones of the same room.
+     */
+    PowerLevelTable(const Quotient::RoomPowerLevelsEvent *event, const QStringList &creators, quint64 version);
+
+    /**
+     * @brief Whether the room has a power levels event.
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Incremented every time the table of a room is rebuilt.
+     */
+    quint64 version() const;
+
+    /**
+     * @brief Whether @p userId is a creator with an infinite power level.
+     */
+    bool isCreator(const QString &userId) const;
+
+    /**
+     * @brief The power level of @p userId.
+     *
+     * This is std::numeric_limits<int>::max() for creators.
+     */
+    int userLevel(const QString &userId) const;
+
+    /**
+     * @brief The level required to send message events of the given type.
+     */
+    int eventLevel(const QString &eventType) const;
+
+    /**
+     * @brief The level required to send state events of the given type.
+     */
+    int stateLevel(const QString &eventType) const;
+
+    /**
+     * @brief The level required for @p action.
+     */
+    int actionLevel(Action action) const;
+
+    int usersDefault() const;
+    int eventsDefault() const;
+    int stateDefault() const;
+
+    /**
+     * @brief The event types that have their own level.
+     */
+    QStringList eventTypes() const;
+
+    /**
+     * @brief Whether @p userId may send message events of the given type.
+     */
+    bool canSendEvent(const QString &userId, const QString &eventType) const;
+
+    /**
+     * @brief Whether @p userId may send state events of the given type.
+     */
+    bool canSendState(const QString &userId, const QString &eventType) const;
+
+    /**
+     * @brief Whether @p userId may perform @p action.
+     */
+    bool canPerform(const QString &userId, Action action) const;
+
+private:
+    bool m_valid = false;
+    quint64 m_version = 0;
+    QStringList m_creators;
+    QHash<QString, int> m_users;
+    QHash<QString, int> m_events;
+    int m_usersDefault = 0;
+    int m_eventsDefault = 0;
+    int m_stateDefault = 0;
+    int m_ban = 0;
+    int m_kick = 0;
+    int m_invite = 0;
+    int m_redact = 0;
+};
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "roomchangecoalescer.h"
+
+#include <map>
+
+#include "neochatconnection.h"
+
+namespace
+{
+void mergeRoles(QList<int> &roles, const QList<int> &newRoles)
+{
+    if (roles.isEmpty()) {
+        return;
+    }
+    if (newRoles.isEmpty()) {
+        roles.clear();
+        return;
+    }
+    for (const auto role : newRoles) {
+        if (!roles.contains(role)) {
+            roles += role;
+        }
+    }
+}
+}
+
+RoomChangeCoalescer::RoomChangeCoalescer(IndexResolver indexForRoom, RangeEmitter emitDataChanged, QObject *parent)
+    : QObject(parent)
+    , m_indexForRoom(std::move(indexForRoom))
+    , m_emitDataChanged(std::move(emitDataChanged))
+{
+    m_timer.setSingleShot(true);
+    m_timer.setInterval(0);
+    connect(&m_timer, &QTimer::timeout, this, &RoomChangeCoalescer::flush);
+}
+
+void RoomChangeCoalescer::setConnection(NeoChatConnection *connection)
+{
+    if (m_connection == connection) {
+        return;
+    }
+    if (m_connection) {
+        m_connection->disconnect(this);
+    }
+    clear();
+    m_connection = connection;
+    if (m_connection) {
+        connect(m_connection, &NeoChatConnection::syncDone, this, &RoomChangeCoalescer::flush);
+    }
+}
+
+void RoomChangeCoalescer::add(NeoChatRoom *room, const QList<int> &roles)
+{
+    if (room == nullptr) {
+        return;
+    }
+    const auto it = m_pending.find(room);
+    if (it == m_pending.end()) {
+        m_pending.insert(room, roles);
+    } else {
+        mergeRoles(*it, roles);
+    }
+    if (!m_timer.isActive()) {
+        m_timer.start();
+    }
+}
+
+void RoomChangeCoalescer::remove(NeoChatRoom *room)
+{
+    m_pending.remove(room);
+}
+
+void RoomChangeCoalescer::clear()
+{
+    m_pending.clear();
+    m_timer.stop();
+}
+
+void RoomChangeCoalescer::flush()
+{
+    m_timer.stop();
+    if (m_pending.isEmpty()) {
+        return;
+    }
+    const auto pending = std::exchange(m_pending, {});
+
+    // Group by parent, keeping the rows sorted so that adjacent ones can be merged.
+    QHash<QModelIndex, std::map<int, QList<int>>> rowsByParent;
+    for (auto it = pending.constBegin(); it != pending.constEnd(); ++it) {
+        const auto index = m_indexForRoom(it.key());
+        if (!index.isValid()) {
+            continue;
+        }
+        rowsByParent[index.parent()][index.row()] = it.value();
+    }
+
+    for (auto it = rowsByParent.constBegin(); it != rowsByParent.constEnd(); ++it) {
+        const auto &parent = it.key();
+        const auto &rows = it.value();
+        auto rangeStart = rows.cbegin();
+        auto rangeRoles = rangeStart->second;
+        for (auto rowIt = rows.cbegin(); rowIt != rows.cend(); ++rowIt) {
+            const auto next = std::next(rowIt);
+            if (next != rows.cend() && next->first == rowIt->first + 1) {
+                mergeRoles(rangeRoles, next->second);
+                continue;
+            }
+            m_emitDataChanged(rangeStart->first, rowIt->first, parent, rangeRoles);
+            if (next != rows.cend()) {
+                rangeStart = next;
+                rangeRoles = next->second;
+            }
+        }
+    }
+}
+
+#include "moc_roomchangecoalescer.cpp"
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QModelIndex>
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+
+#include <functional>
+
+class NeoChatConnection;
+class NeoChatRoom;
+
+/**
+ * @class RoomChangeCoalescer
+ *
+ * Collects the roles changed for each room and emits them in batches.
+ *
+ * During a sync a single room emits many change signals (unread counts, highlights,
+ * display name, avatar, new messages...) and a sync can touch hundreds of rooms.
+ * Emitting dataChanged for each of them makes every proxy model re-sort and re-filter
+ * once per signal. Instead, the changes are merged per room and flushed once when the
+ * connection finishes the sync, or at the next event loop iteration for changes that
+ * happen outside of a sync.
+ *
+ * On flush the rooms are resolved to their current model index and adjacent rows with
+ * the same parent are reported as a single range with the union of their roles.
+ */
+class RoomChangeCoalescer : public QObject
+{
+    Q_OBJECT
+
+public:
+    using IndexResolver = std::function<QModelIndex(NeoChatRoom *)>;
+    using RangeEmitter = std::function<void(int firstRow, int lastRow, const QModelIndex &parent, const QList<int> &roles)>;
+
+    RoomChangeCoalescer(IndexResolver indexForRoom, RangeEmitter emitDataChanged, QObject *parent = nullptr);
+
+    /**
+     * @brief Set the connection whose syncs trigger a flush.
+     */
+    void setConnection(NeoChatConnection *connection);
+
+    /**
+     * @brief Queue the given roles of the room as changed.
+     *
+     * An empty list of roles means that all roles have changed.
+     */
+    void add(NeoChatRoom *room, const QList<int> &roles = {});
+
+    /**
+     * @brief Drop any pending changes for the room, e.g. because it was removed from the model.
+     */
+    void remove(NeoChatRoom *room);
+
+    /**
+     * @brief Drop all pending changes, e.g. because the model was reset.
+     */
+    void clear();
+
+    /**
+     * @brief Emit all pending changes now.
+     */
+    void flush();
+
+private:
+    IndexResolver m_indexForRoom;
+    RangeEmitter m_emitDataChanged;
+    QPointer<NeoChatConnection> m_connection;
+    // An empty list means all roles.
+    QHash<NeoChatRoom *, QList<int>> m_pending;
+    QTimer m_timer;
+};
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "roomsearchindex.h"
+
+#include "neochatroom.h"
+
+namespace
+{
+constexpr auto trigramLength = 3;
+
+QSet<QString> trigrams(const QString &key)
+{
+    QSet<QString> result;
+    for (qsizetype i = 0; i + trigramLength <= key.size(); i++) {
+        result.insert(key.mid(i, trigramLength));
+    }
+    return result;
+}
+}
+
+QString RoomSearchIndex::normalize(const QString &text)
+{
+    const auto decomposed = text.normalized(QString::NormalizationForm_KD);
+    QString result;
+    result.reserve(decomposed.size());
+    for (const auto &c : decomposed) {
+        if (c.category() != QChar::Mark_NonSpacing) {
+            result += c;
+        }
+    }
+    return result.toCaseFolded();
+}
+
+void RoomSearchIndex::update(const NeoChatRoom *room)
+{
+    // The separator can't be part of a search, so the name and alias are matched separately.
+    const auto key = normalize(room->displayName()) + u'\n' + normalize(room->canonicalAlias());
+    const auto it = m_keys.find(room);
+    if (it != m_keys.end()) {
+        if (*it == key) {
+            return;
+        }
+        removeTrigrams(room, *it);
+        *it = key;
+    } else {
+        m_keys.insert(room, key);
+    }
+    for (const auto &trigram : trigrams(key)) {
+        m_trigrams[trigram].insert(room);
+    }
+
+    // Keep the cached result valid so that it can still be narrowed down.
+    if (m_lastMatchesValid) {
+        if (key.contains(m_lastQuery)) {
+            m_lastMatches.insert(room);
+        } else {
+            m_lastMatches.remove(room);
+        }
+    }
+}
+
+void RoomSearchIndex::remove(const NeoChatRoom *room)
+{
+    const auto it = m_keys.find(room);
+    if (it == m_keys.end()) {
+        return;
+    }
+    removeTrigrams(room, *it);
+    m_keys.erase(it);
+    m_lastMatches.remove(room);
+}
+
+void RoomSearchIndex::clear()
+{
+    m_keys.clear();
+    m_trigrams.clear();
+    m_lastMatches.clear();
+    m_lastMatchesValid = false;
+}
+
+void RoomSearchIndex::removeTrigrams(const NeoChatRoom *room, const QString &key)
+{
+    for (const auto &trigram : trigrams(key)) {
+        const auto it = m_trigrams.find(trigram);
+        if (it == m_trigrams.end()) {
+            continue;
+        }
+        it->remove(room);
+        if (it->isEmpty()) {
+            m_trigrams.erase(it);
+        }
+    }
+}
+
+bool RoomSearchIndex::matches(const NeoChatRoom *room, const QString &text)
+{
+    if (text.isEmpty()) {
+        return true;
+    }
+    if (!m_lastMatchesValid || text != m_lastText) {
+        search(text);
+    }
+    return m_lastMatches.contains(room);
+}
+
+void RoomSearchIndex::search(const QString &text)
+{
+    const auto query = normalize(text);
+
+    // Typing another character can only remove matches.
+    if (m_lastMatchesValid && query.startsWith(m_lastQuery)) {
+        m_lastMatches.removeIf([this, &query](const NeoChatRoom *room) {
+            return !m_keys.value(room).contains(query);
+        });
+    } else if (query.size() >= trigramLength) {
+        // Start with the smallest set of rooms that contain one of the trigrams.
+        const QSet<const NeoChatRoom *> *candidates = nullptr;
+        for (const auto &trigram : trigrams(query)) {
+            const auto it = m_trigrams.constFind(trigram);
+            if (it == m_trigrams.constEnd()) {
+                candidates = nullptr;
+                m_lastMatches.clear();
+                break;
+            }
+            if (candidates == nullptr || it->size() < candidates->size()) {
+                candidates = &*it;
+            }
+        }
+        if (candidates) {
+            m_lastMatches.clear();
+            for (const auto room : *candidates) {
+                if (m_keys.value(room).contains(query)) {
+                    m_lastMatches.insert(room);
+                }
+            }
+        }
+    } else {
+        m_lastMatches.clear();
+        for (auto it = m_keys.constBegin(); it != m_keys.constEnd(); ++it) {
+            if (it->contains(query)) {
+                m_lastMatches.insert(it.key());
+            }
+        }
+    }
+
+    m_lastText = text;
+    m_lastQuery = query;
+    m_lastMatchesValid = true;
+}
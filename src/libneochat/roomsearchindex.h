@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QSet>
+#include <QString>
+
+class NeoChatRoom;
+
+/**
+ * @class RoomSearchIndex
+ *
+ * An index to quickly find the rooms matching a search string.
+ *
+ * For each room a normalized search key is stored, made from the display name and
+ * the canonical alias, case folded and with diacritics removed. The keys are indexed
+ * by their trigrams, so that a search only has to check the rooms that contain all the
+ * trigrams of the search string.
+ *
+ * The result of the last search is cached. When the search string is extended, e.g.
+ * because the user typed another character, only the previous matches are checked.
+ */
+class RoomSearchIndex
+{
+public:
+    /**
+     * @brief Normalize the given text for searching.
+     */
+    static QString normalize(const QString &text);
+
+    /**
+     * @brief Add or update the search key of the given room.
+     */
+    void update(const NeoChatRoom *room);
+
+    /**
+     * @brief Remove the given room from the index.
+     */
+    void remove(const NeoChatRoom *room);
+
+    /**
+     * @brief Remove all rooms from the index.
+     */
+    void clear();
+
+    /**
+     * @brief Whether the room's search key contains the given search text.
+     *
+     * The first call with a new search text calculates all matches, after that this is
+     * a hash lookup.
+     */
+    bool matches(const NeoChatRoom *room, const QString &text);
+
+private:
+    QHash<const NeoChatRoom *, QString> m_keys;
+    QHash<QString, QSet<const NeoChatRoom *>> m_trigrams;
+
+    QString m_lastText;
+    QString m_lastQuery;
+    QSet<const NeoChatRoom *> m_lastMatches;
+    bool m_lastMatchesValid = false;
+
+    void search(const QString &text);
+    void removeTrigrams(const NeoChatRoom *room, const QString &key);
+};
@@ -178,8 +178,7 @@ bool SpaceHierarchyCache::spaceHasHighlightNotifications(const QString &spaceId)
 
 bool SpaceHierarchyCache::isChild(const QString &roomId) const
 {
-    const auto childrens = m_spaceHierarchy.values();
-    for (const auto &children : childrens) {
+    for (const auto &children : m_spaceHierarchy) {
         if (children.contains(roomId)) {
             return true;
         }
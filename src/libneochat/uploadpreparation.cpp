@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "uploadpreparation.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QImageReader>
+#include <QImageWriter>
+#include <QMimeDatabase>
+#include <QTemporaryFile>
+
+#include "blurhash.h"
+
+using namespace Qt::StringLiterals;
+
+namespace
+{
+// Writes the image to a file in the temporary directory that outlives this call, returning its path.
+QString writeTemporaryImage(const QImage &image, const QByteArray &format, int quality)
+{
+    QTemporaryFile file(QDir::tempPath() + u"/neochat-upload-XXXXXX."_s + QString::fromLatin1(format));
+    file.setAutoRemove(false);
+    if (!file.open()) {
+        qWarning() << "Failed to open" << file.fileName() << file.errorString();
+        return {};
+    }
+
+    QImageWriter writer(&file, format);
+    writer.setQuality(quality);
+    if (!writer.write(image)) {
+        qWarning() << "Failed to write" << file.fileName() << writer.errorString();
+        file.remove();
+        return {};
+    }
+    return file.fileName();
+}
+}
+
+void UploadPreparation::prepareImage(QPromise<PreparedImage> &promise, const QString &path, int maxDimension)
+{
+    promise.setProgressRange(0, imageSteps);
+
+    PreparedImage result;
+    result.filePath = path;
+    result.mimeType = QMimeDatabase().mimeTypeForFile(path);
+    result.fileSize = QFileInfo(path).size();
+
+    QImageReader reader(path);
+    reader.setAutoTransform(true);
+    const auto rawSize = reader.size();
+    // The scaled size is applied before the orientation, so boxes have to be turned with the image.
+    const bool rotated = reader.transformation() & QImageIOHandler::TransformationRotate90;
+    result.size = rotated ? rawSize.transposed() : rawSize;
+    const auto thumbnailBox = rotated ? UploadPreparation::thumbnailBox.transposed() : UploadPreparation::thumbnailBox;
+    const auto format = reader.format();
+    const bool animated = reader.supportsAnimation();
+    promise.setProgressValue(1);
+
+    if (!rawSize.isValid() || promise.isCanceled()) {
+        promise.addResult(result);
+        return;
+    }
+
+    QImage image;
+    if (maxDimension > 0 && !animated && (rawSize.width() > maxDimension || rawSize.height() > maxDimension)) {
+        reader.setScaledSize(rawSize.scaled(maxDimension, maxDimension, Qt::KeepAspectRatio));
+        image = reader.read();
+        promise.setProgressValue(2);
+
+        // Keep the original format where possible so that the file name still fits.
+        const auto writeFormat = QImageWriter::supportedImageFormats().contains(format) ? format : "jpg"_ba;
+        const auto scaledPath = image.isNull() ? QString() : writeTemporaryImage(image, writeFormat, 90);
+        if (!scaledPath.isEmpty()) {
+            result.filePath = scaledPath;
+            result.temporaryFile = true;
+            result.mimeType = QMimeDatabase().mimeTypeForFile(scaledPath);
+            result.fileSize = QFileInfo(scaledPath).size();
+            result.size = image.size();
+        }
+    } else {
+        // Only the thumbnail and the blurhash need pixels, so never decode more than the thumbnail.
+        if (rawSize.width() > thumbnailBox.width() || rawSize.height() > thumbnailBox.height()) {
+            reader.setScaledSize(rawSize.scaled(thumbnailBox, Qt::KeepAspectRatio));
+        }
+        image = reader.read();
+        promise.setProgressValue(2);
+    }
+
+    if (image.isNull() || promise.isCanceled()) {
+        promise.addResult(result);
+        return;
+    }
+
+    QImage thumbnail = image;
+    if (image.width() > UploadPreparation::thumbnailBox.width() || image.height() > UploadPreparation::thumbnailBox.height()) {
+        thumbnail = image.scaled(UploadPreparation::thumbnailBox, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    }
+    if (thumbnail.size() != result.size) {
+        result.thumbnailPath = writeTemporaryImage(thumbnail.convertToFormat(QImage::Format_RGB888), "jpg"_ba, 80);
+        if (!result.thumbnailPath.isEmpty()) {
+            result.thumbnailFileSize = QFileInfo(result.thumbnailPath).size();
+            result.thumbnailSize = thumbnail.size();
+        }
+    }
+    promise.setProgressValue(3);
+
+    result.blurhash = Quotient::BlurHash::encode(thumbnail, 4, 3);
+    promise.setProgressValue(4);
+
+    promise.addResult(result);
+}
+
+PreparedThumbnail UploadPreparation::prepareThumbnail(const QImage &image)
+{
+    if (image.isNull()) {
+        return {};
+    }
+
+    QImage thumbnail = image;
+    if (image.width() > UploadPreparation::thumbnailBox.width() || image.height() > UploadPreparation::thumbnailBox.height()) {
+        thumbnail = image.scaled(UploadPreparation::thumbnailBox, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    }
+
+    PreparedThumbnail result;
+    result.path = writeTemporaryImage(thumbnail.convertToFormat(QImage::Format_RGB888), "jpg"_ba, 80);
+    if (result.path.isEmpty()) {
+        return {};
+    }
+    result.fileSize = QFileInfo(result.path).size();
+    result.size = thumbnail.size();
+    result.blurhash = Quotient::BlurHash::encode(thumbnail, 4, 3);
+    return result;
+}
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QImage>
+#include <QJsonObject>
+#include <QMimeType>
+#include <QPromise>
+#include <QSize>
+#include <QString>
+
+#include <Quotient/events/eventcontent.h>
+
+/**
+ * @brief Everything needed to post an image, worked out away from the GUI thread.
+ */
+struct PreparedImage {
+    /**
+     * @brief The file to upload.
+     *
+     * Either the original file or a downscaled copy in the temporary directory.
+     */
+    QString filePath;
+    QMimeType mimeType;
+    qint64 fileSize = 0;
+
+    /**
+     * @brief The dimensions of the image as displayed, with the EXIF orientation applied.
+     */
+    QSize size;
+
+    /**
+     * @brief Path of a JPEG thumbnail in the temporary directory.
+     *
+     * Empty if the image is small enough to be its own thumbnail.
+     */
+    QString thumbnailPath;
+    qint64 thumbnailFileSize = 0;
+    QSize thumbnailSize;
+
+    QString blurhash;
+
+    /**
+     * @brief Whether filePath is a temporary file that should be removed once uploaded.
+     */
+    bool temporaryFile = false;
+};
+
+/**
+ * @brief A thumbnail written to the temporary directory, to be removed once uploaded.
+ */
+struct PreparedThumbnail {
+    QString path;
+    qint64 fileSize = 0;
+    QSize size;
+    QString blurhash;
+};
+
+namespace UploadPreparation
+{
+/**
+ * @brief The largest thumbnail generated, following the sizes servers use for their own.
+ */
+inline constexpr QSize thumbnailBox{800, 600};
+
+/**
+ * @brief The number of steps reported through the progress of @p promise in prepareImage().
+ */
+inline constexpr int imageSteps = 4;
+
+/**
+ * @brief Prepare the image at @p path for upload.
+ *
+ * Meant to be run with QtConcurrent::run. The dimensions come from the image header
+ * and the image is only ever decoded at the size that is needed, using the decoder's
+ * own scaling where it has it.
+ *
+ * @param maxDimension Images larger than this in either direction are replaced by a
+ *                     downscaled copy. 0 uploads the original.
+ */
+void prepareImage(QPromise<PreparedImage> &promise, const QString &path, int maxDimension);
+
+/**
+ * @brief Write a JPEG thumbnail of @p image, no larger than thumbnailBox, and its blurhash.
+ *
+ * Meant to be run away from the GUI thread. The path is empty if the thumbnail could
+ * not be written.
+ */
+PreparedThumbnail prepareThumbnail(const QImage &image);
+
+/**
+ * @brief File content that sends a blurhash in the info of the event.
+ *
+ * Quotient only reads the blurhash of received events, the info it sends is made from
+ * the known fields of @p ContentT.
+ */
+template<typename ContentT>
+class BlurhashContent : public ContentT
+{
+public:
+    using ContentT::ContentT;
+
+    QString blurhash;
+
+protected:
+    void fillJson(QJsonObject &json) const override
+    {
+        using namespace Qt::StringLiterals;
+        ContentT::fillJson(json);
+        if (!blurhash.isEmpty()) {
+            auto info = json["info"_L1].toObject();
+            info.insert("xyz.amorgan.blurhash"_L1, blurhash);
+            json.insert("info"_L1, info);
+        }
+    }
+};
+}
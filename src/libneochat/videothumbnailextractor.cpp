@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "videothumbnailextractor.h"
+
+#include <QMediaMetaData>
+#include <QMediaPlayer>
+#include <QTimer>
+#include <QVideoFrame>
+#include <QVideoSink>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// Frames decoded before the seek lands may arrive first, accept anything this close to the target.
+// Short videos use half of the target instead, so that the very first frames are still skipped.
+constexpr qint64 positionTolerance = 500;
+
+struct ExtractionState {
+    qint64 target = -1;
+    QVideoFrame lastFrame;
+    bool done = false;
+};
+
+// Runs on the extraction thread, with everything created as children of @p context.
+void grabFrame(QObject *context, const QUrl &url, std::chrono::milliseconds timeout, const std::shared_ptr<QPromise<VideoThumbnail>> &promise)
+{
+    const auto player = new QMediaPlayer(context);
+    const auto sink = new QVideoSink(context);
+    const auto timer = new QTimer(context);
+    const auto state = std::make_shared<ExtractionState>();
+    player->setVideoSink(sink);
+    timer->setSingleShot(true);
+
+    const auto finish = [context, player, timer, state, promise](const QVideoFrame &frame) {
+        if (state->done) {
+            return;
+        }
+        state->done = true;
+        timer->stop();
+
+        VideoThumbnail result;
+        result.videoSize = player->metaData().value(QMediaMetaData::Resolution).toSize();
+        result.duration = player->duration();
+        if (frame.isValid()) {
+            const auto image = frame.toImage();
+            if (!result.videoSize.isValid()) {
+                result.videoSize = image.size();
+            }
+            result.thumbnail = UploadPreparation::prepareThumbnail(image);
+        }
+        player->stop();
+
+        promise->addResult(result);
+        promise->finish();
+        context->thread()->quit();
+    };
+
+    QObject::connect(player, &QMediaPlayer::mediaStatusChanged, context, [player, state, finish](QMediaPlayer::MediaStatus status) {
+        if (status == QMediaPlayer::LoadedMedia && state->target < 0) {
+            // Pausing decodes the frame at the position without starting playback.
+            state->target = VideoThumbnailExtractor::representativePosition(player->duration());
+            player->setPosition(state->target);
+            player->pause();
+        } else if (status == QMediaPlayer::InvalidMedia) {
+            finish({});
+        }
+    });
+    QObject::connect(player, &QMediaPlayer::errorOccurred, context, [state, finish]() {
+        finish(state->lastFrame);
+    });
+    QObject::connect(sink, &QVideoSink::videoFrameChanged, context, [state, finish](const QVideoFrame &frame) {
+        if (!frame.isValid() || state->target < 0) {
+            return;
+        }
+        state->lastFrame = frame;
+        const auto tolerance = std::min(positionTolerance, state->target / 2);
+        if (frame.startTime() < 0 || frame.startTime() / 1000 >= state->target - tolerance) {
+            finish(frame);
+        }
+    });
+    QObject::connect(timer, &QTimer::timeout, context, [state, finish]() {
+        finish(state->lastFrame);
+    });
+
+    timer->start(timeout);
+    player->setSource(url);
+}
+}
+
+VideoThumbnailExtractor &VideoThumbnailExtractor::instance()
+{
+    static VideoThumbnailExtractor _instance;
+    return _instance;
+}
+
+VideoThumbnailExtractor::VideoThumbnailExtractor(QObject *parent)
+    : QObject(parent)
+{
+}
+
+VideoThumbnailExtractor::~VideoThumbnailExtractor()
+{
+    for (const auto thread : std::as_const(m_threads)) {
+        thread->quit();
+        thread->wait();
+    }
+}
+
+int VideoThumbnailExtractor::maxConcurrent() const
+{
+    return m_maxConcurrent;
+}
+
+void VideoThumbnailExtractor::setMaxConcurrent(int maxConcurrent)
+{
+    m_maxConcurrent = std::max(1, maxConcurrent);
+    startNext();
+}
+
+int VideoThumbnailExtractor::runningCount() const
+{
+    return m_running;
+}
+
+int VideoThumbnailExtractor::queuedCount() const
+{
+    return m_queue.size();
+}
+
+std::chrono::milliseconds VideoThumbnailExtractor::timeout() const
+{
+    return m_timeout;
+}
+
+void VideoThumbnailExtractor::setTimeout(std::chrono::milliseconds timeout)
+{
+    m_timeout = timeout;
+}
+
+qint64 VideoThumbnailExtractor::representativePosition(qint64 duration)
+{
+    return std::clamp<qint64>(duration / 10, 0, 3000);
+}
+
+QFuture<VideoThumbnail> VideoThumbnailExtractor::extract(const QUrl &url)
+{
+    const auto promise = std::make_shared<QPromise<VideoThumbnail>>();
+    promise->start();
+    m_queue.enqueue({url, promise});
+    startNext();
+    return promise->future();
+}
+
+void VideoThumbnailExtractor::startNext()
+{
+    while (m_running < m_maxConcurrent && !m_queue.isEmpty()) {
+        const auto request = m_queue.dequeue();
+        ++m_running;
+
+        const auto thread = new QThread;
+        const auto context = new QObject;
+        context->moveToThread(thread);
+        m_threads += thread;
+
+        connect(thread, &QThread::started, context, [context, request, timeout = m_timeout]() {
+            grabFrame(context, request.url, timeout, request.promise);
+        });
+        connect(thread, &QThread::finished, context, &QObject::deleteLater);
+        connect(thread, &QThread::finished, this, [this, thread]() {
+            m_threads.removeOne(thread);
+            thread->deleteLater();
+            --m_running;
+            startNext();
+        });
+        thread->start();
+    }
+}
+
+#include "moc_videothumbnailextractor.cpp"
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2026 NeoChat contributors
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QFuture>
+#include <QObject>
+#include <QPromise>
+#include <QQueue>
+#include <QSize>
+#include <QThread>
+#include <QUrl>
+
+#include <chrono>
+#include <memory>
+
+#include "uploadpreparation.h"
+
+/**
+ * @brief What VideoThumbnailExtractor found out about a video.
+ */
+struct VideoThumbnail {
+    QSize videoSize;
+    qint64 duration = 0;
+
+    /**
+     * @brief The thumbnail, with an empty path if no frame could be decoded.
+     */
+    PreparedThumbnail thumbnail;
+};
+
+/**
+ * @class VideoThumbnailExtractor
+ *
+ * Grabs a thumbnail from local video files for uploads.
+ *
+ * Every extraction runs on its own thread, with a QMediaPlayer that is paused and
+ * seeked to a representative frame rather than played. The frame is written to a
+ * JPEG in the temporary directory and its blurhash computed on the same thread.
+ * No more than maxConcurrent() extractions run at the same time; the rest are queued.
+ *
+ * @note Not thread safe, use it from the GUI thread only.
+ */
+class VideoThumbnailExtractor : public QObject
+{
+    Q_OBJECT
+
+public:
+    static VideoThumbnailExtractor &instance();
+
+    explicit VideoThumbnailExtractor(QObject *parent = nullptr);
+    ~VideoThumbnailExtractor() override;
+
+    /**
+     * @brief The maximum number of videos being decoded at the same time.
+     */
+    int maxConcurrent() const;
+    void setMaxConcurrent(int maxConcurrent);
+
+    /**
+     * @brief The number of videos currently being decoded.
+     */
+    int runningCount() const;
+
+    /**
+     * @brief The number of videos waiting for a free thread.
+     */
+    int queuedCount() const;
+
+    /**
+     * @brief How long to wait for a frame before giving up on a video.
+     */
+    std::chrono::milliseconds timeout() const;
+    void setTimeout(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief The position of the frame used for a video of @p duration milliseconds.
+     *
+     * A tenth into the video, but no later than three seconds, to skip black or
+     * fading in first frames.
+     */
+    static qint64 representativePosition(qint64 duration);
+
+    /**
+     * @brief Extract a thumbnail from the video at @p url, which must be a local file.
+     */
+    QFuture<VideoThumbnail> extract(const QUrl &url);
+
+private:
+    using PromisePtr = std::shared_ptr<QPromise<VideoThumbnail>>;
+
+    struct Request {
+        QUrl url;
+        PromisePtr promise;
+    };
+
+    void startNext();
+
+    int m_maxConcurrent = 2;
+    int m_running = 0;
+    std::chrono::milliseconds m_timeout = std::chrono::seconds(10);
+    QQueue<Request> m_queue;
+    QList<QThread *> m_threads;
+};
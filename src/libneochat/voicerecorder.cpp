@@ -3,18 +3,24 @@
 
 #include "voicerecorder.h"
 
+#include <QDir>
 #include <QFile>
-#include <QTemporaryFile>
+#include <QtConcurrentRun>
 
 #include <KFormat>
 
 #include <Quotient/events/filesourceinfo.h>
+#include <Quotient/jobs/basejob.h>
+
+#include <qcoro/qcorofuture.h>
+#include <qcoro/qcorosignal.h>
+
+#include "fileencryption.h"
 
 using namespace Qt::Literals::StringLiterals;
 
 VoiceRecorder::VoiceRecorder(QObject *parent)
     : QObject(parent)
-    , m_buffer(new QBuffer)
     , m_format(QMediaFormat::FileFormat::Ogg)
 {
     m_session.setAudioInput(&m_input);
@@ -23,25 +29,43 @@ VoiceRecorder::VoiceRecorder(QObject *parent)
     m_format.setAudioCodec(QMediaFormat::AudioCodec::Opus);
     m_recorder.setAudioChannelCount(1);
     m_recorder.setMediaFormat(m_format);
-    m_buffer->open(QIODevice::ReadWrite);
-    m_recorder.setOutputDevice(m_buffer);
     m_session.setRecorder(&m_recorder);
 }
 
 VoiceRecorder::~VoiceRecorder()
 {
-    delete m_buffer;
+    m_recorder.stop();
+    m_recorder.setOutputDevice(nullptr);
 }
 
 void VoiceRecorder::startRecording()
 {
-    m_buffer->setData({});
+    m_file = std::make_unique<QTemporaryFile>(QDir::tempPath() + u"/neochat-voice-XXXXXX.ogg"_s);
+    if (!m_file->open()) {
+        qWarning() << "Failed to create a file for the voice message" << m_file->errorString();
+        m_file.reset();
+        return;
+    }
+    m_recorder.setOutputDevice(m_file.get());
+
+    // The recorder only gives us the encoded file, so read the raw input alongside it for the waveform.
+    m_waveform.reset();
+    const auto device = m_input.device();
+    const auto format = device.preferredFormat();
+    m_source = std::make_unique<QAudioSource>(device, format);
+    if (const auto input = m_source->start()) {
+        connect(input, &QIODevice::readyRead, this, [this, input, format]() {
+            m_waveform.addData(input->readAll(), format);
+        });
+    }
+
     m_recorder.record();
 }
 
 void VoiceRecorder::stopRecording()
 {
     m_recorder.stop();
+    m_source.reset();
 }
 
 QMediaRecorder *VoiceRecorder::recorder()
@@ -51,60 +75,86 @@ QMediaRecorder *VoiceRecorder::recorder()
 
 void VoiceRecorder::send()
 {
-    Quotient::FileSourceInfo fileMetadata;
-    QByteArray data;
-    m_buffer->seek(0);
-
-    if (m_room->usesEncryption()) {
-        std::tie(fileMetadata, data) = Quotient::encryptFile(m_buffer->data());
-        m_buffer->close();
-        m_buffer->setData(data);
-        m_buffer->open(QIODevice::ReadOnly);
+    if (!m_room || !m_file) {
+        return;
     }
+    m_recorder.setOutputDevice(nullptr);
+    doSend(m_room, std::move(m_file), m_recorder.duration(), m_waveform.summary());
+}
+
+QCoro::Task<void> VoiceRecorder::doSend(QPointer<NeoChatRoom> room, std::unique_ptr<QTemporaryFile> file, qint64 duration, QList<int> waveform)
+{
+    file->close();
+    const auto size = file->size();
 
-    auto room = m_room;
-    auto buffer = m_buffer;
-    auto duration = m_recorder.duration();
-    m_buffer = nullptr;
-    m_room->connection()->uploadContent(buffer, {}, u"audio/ogg"_s).then(this, [fileMetadata, room, buffer, duration](const auto &job) mutable {
-        QJsonObject mscFile{
-            {u"mimetype"_s, u"audio/ogg"_s},
-            {u"name"_s, u"Voice Message"_s},
-            {u"size"_s, buffer->size()},
-        };
-
-        if (room->usesEncryption()) {
-            mscFile[u"file"_s] = toJson(fileMetadata);
-        } else {
-            mscFile[u"url"_s] = job->contentUri().toString();
+    Quotient::FileSourceInfo fileMetadata;
+    if (room->usesEncryption()) {
+        auto encrypted = std::make_unique<QTemporaryFile>(QDir::tempPath() + u"/neochat-voice-XXXXXX"_s);
+        if (!encrypted->open()) {
+            qWarning() << "Failed to create a file for the encrypted voice message" << encrypted->errorString();
+            co_return;
         }
+        encrypted->close();
 
-        Quotient::setUrlInSourceInfo(fileMetadata, job->contentUri());
-        QJsonObject content{
-            {u"body"_s, u"Voice message"_s},
-            {u"msgtype"_s, u"m.audio"_s},
-            {u"org.matrix.msc1767.text"_s,
-             QJsonObject{{u"body"_s, u"Voice Message (%1, %2)"_s.arg(KFormat().formatDuration(duration), KFormat().formatByteSize(buffer->size()))}}},
-            {u"org.matrix.msc1767.file"_s, mscFile},
-            {u"info"_s,
-             QJsonObject{
-                 {u"mimetype"_s, u"audio/ogg"_s},
-                 {u"size"_s, buffer->size()},
-                 {u"duration"_s, duration},
-             }},
-            {u"org.matrix.msc1767.audio"_s,
-             QJsonObject{
-                 {u"duration"_s, duration},
-                 {u"waveform"_s, QJsonArray{}}, // TODO
-             }},
-            {u"org.matrix.msc3245.voice"_s, QJsonObject{}}};
-        if (room->usesEncryption()) {
-            content[u"file"_s] = toJson(fileMetadata);
-        } else {
-            content[u"url"_s] = job->contentUri().toString();
+        const auto encryptedFile = co_await QtConcurrent::run(&FileEncryption::encryptFile, file->fileName(), encrypted->fileName());
+        if (!encryptedFile) {
+            qWarning() << "Failed to encrypt the voice message";
+            co_return;
         }
-        room->postJson(u"m.room.message"_s, content);
-    });
+        fileMetadata = *encryptedFile;
+        file = std::move(encrypted);
+    }
+
+    if (!room || !file->open()) {
+        co_return;
+    }
+    const auto job = room->connection()->uploadContent(file.get(), {}, u"audio/ogg"_s);
+    co_await qCoro(job.get(), &Quotient::BaseJob::finished);
+    if (!room || job->status() != Quotient::BaseJob::Success) {
+        co_return;
+    }
+
+    QJsonObject mscFile{
+        {u"mimetype"_s, u"audio/ogg"_s},
+        {u"name"_s, u"Voice Message"_s},
+        {u"size"_s, size},
+    };
+
+    if (room->usesEncryption()) {
+        Quotient::setUrlInSourceInfo(fileMetadata, job->contentUri());
+        mscFile[u"file"_s] = toJson(fileMetadata);
+    } else {
+        mscFile[u"url"_s] = job->contentUri().toString();
+    }
+
+    QJsonArray waveformJson;
+    for (const auto value : std::as_const(waveform)) {
+        waveformJson += value;
+    }
+
+    QJsonObject content{
+        {u"body"_s, u"Voice message"_s},
+        {u"msgtype"_s, u"m.audio"_s},
+        {u"org.matrix.msc1767.text"_s, QJsonObject{{u"body"_s, u"Voice Message (%1, %2)"_s.arg(KFormat().formatDuration(duration), KFormat().formatByteSize(size))}}},
+        {u"org.matrix.msc1767.file"_s, mscFile},
+        {u"info"_s,
+         QJsonObject{
+             {u"mimetype"_s, u"audio/ogg"_s},
+             {u"size"_s, size},
+             {u"duration"_s, duration},
+         }},
+        {u"org.matrix.msc1767.audio"_s,
+         QJsonObject{
+             {u"duration"_s, duration},
+             {u"waveform"_s, waveformJson},
+         }},
+        {u"org.matrix.msc3245.voice"_s, QJsonObject{}}};
+    if (room->usesEncryption()) {
+        content[u"file"_s] = toJson(fileMetadata);
+    } else {
+        content[u"url"_s] = job->contentUri().toString();
+    }
+    room->postJson(u"m.room.message"_s, content);
 }
 
 void VoiceRecorder::setRoom(NeoChatRoom *room)
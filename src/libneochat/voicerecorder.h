@@ -6,13 +6,28 @@
 #include <QObject>
 #include <qqmlintegration.h>
 
+#include "audiowaveform.h"
 #include "neochatroom.h"
 #include <QAudioInput>
-#include <QBuffer>
+#include <QAudioSource>
 #include <QMediaCaptureSession>
 #include <QMediaFormat>
 #include <QMediaRecorder>
+#include <QTemporaryFile>
 
+#include <QCoroTask>
+
+#include <memory>
+
+/**
+ * @class VoiceRecorder
+ *
+ * Records a voice message and sends it to a room.
+ *
+ * The recording is written to a temporary file rather than kept in memory. At the
+ * same time the raw input is read to build the waveform, and in encrypted rooms
+ * the file is encrypted on a worker thread before it is uploaded.
+ */
 class VoiceRecorder : public QObject
 {
     Q_OBJECT
@@ -44,7 +59,13 @@ private:
     QAudioInput m_input;
     QMediaCaptureSession m_session;
     QMediaRecorder m_recorder;
-    QBuffer *m_buffer;
+    std::unique_ptr<QTemporaryFile> m_file;
     QPointer<NeoChatRoom> m_room;
     QMediaFormat m_format;
+
+    std::unique_ptr<QAudioSource> m_source;
+    AudioWaveform m_waveform;
+
+    // Doesn't use the recorder, which may be gone before the upload finishes.
+    static QCoro::Task<void> doSend(QPointer<NeoChatRoom> room, std::unique_ptr<QTemporaryFile> file, qint64 duration, QList<int> waveform);
 };
@@ -111,7 +111,7 @@ QQC2.Control {
 
             SyntaxHighlighter {
                 property string definitionName: Repository.definitionForName(root.block.language).name
-                textEdit: definitionName == "None" ? null : codeText
+                textEdit: definitionName == "None" || root.block.highlighted ? null : codeText
                 definition: definitionName
             }
             ColumnLayout {
@@ -37,6 +37,7 @@ ChatBarMessageContentModel::ChatBarMessageContentModel(QObject *parent)
         m_markdownHelper->setTextItem(focusedTextItem());
         m_keyHelper->setTextItem(focusedTextItem());
     });
+    connect(this, &ChatBarMessageContentModel::focusRowChanged, this, &ChatBarMessageContentModel::updateCacheCursor);
     connect(m_markdownHelper, &ChatMarkdownHelper::unhandledBlockFormat, this, &ChatBarMessageContentModel::insertStyleAtCursor);
     connect(this, &ChatBarMessageContentModel::modelReset, this, &ChatBarMessageContentModel::contentChanged);
     connect(this, &ChatBarMessageContentModel::rowsInserted, this, &ChatBarMessageContentModel::contentChanged);
@@ -70,13 +71,21 @@ void ChatBarMessageContentModel::initializeFromCache()
         return;
     }
 
+    const auto cachedFocusRow = m_cache->focusRow();
+    const auto cachedCursorPosition = m_cache->cursorPosition();
+
     beginResetModel();
     std::ranges::for_each(m_cache->cbegin(), m_cache->cend(), [this](std::unique_ptr<Blocks::CacheItem> const &cacheItem) {
         insertComponentFromCache(cacheItem.get());
     });
     endResetModel();
 
-    m_currentFocusComponent = QPersistentModelIndex(index(rowCount() - 1));
+    // Put the cursor back where it was when the cache was last updated.
+    const auto focusRow = cachedFocusRow >= 0 && cachedFocusRow < rowCount() ? int(cachedFocusRow) : rowCount() - 1;
+    m_currentFocusComponent = QPersistentModelIndex(index(focusRow));
+    if (const auto textItem = focusedTextItem(); textItem && cachedCursorPosition >= 0) {
+        textItem->setInitialCursorPosition(cachedCursorPosition);
+    }
     Q_EMIT focusRowChanged();
 }
 
@@ -225,6 +234,7 @@ ChatTextItemHelper *ChatBarMessageContentModel::focusedTextItem() const
 void ChatBarMessageContentModel::connectTextItem(ChatTextItemHelper *chattextitemhelper)
 {
     connect(chattextitemhelper, &ChatTextItemHelper::contentsChanged, this, &ChatBarMessageContentModel::updateCache);
+    connect(chattextitemhelper, &ChatTextItemHelper::cursorPositionChanged, this, &ChatBarMessageContentModel::updateCacheCursor);
     connect(chattextitemhelper, &ChatTextItemHelper::contentsChanged, this, &ChatBarMessageContentModel::hasRichFormattingChanged);
     connect(chattextitemhelper, &ChatTextItemHelper::charFormatChanged, this, &ChatBarMessageContentModel::hasRichFormattingChanged);
     connect(chattextitemhelper, &ChatTextItemHelper::styleChanged, this, &ChatBarMessageContentModel::hasRichFormattingChanged);
@@ -668,6 +678,22 @@ void ChatBarMessageContentModel::updateCache() const
     std::ranges::for_each(m_components, [this](Blocks::Block *component) {
         m_cache->append(component->toCacheItem());
     });
+    updateCacheCursor();
+}
+
+void ChatBarMessageContentModel::updateCacheCursor() const
+{
+    if (!m_cache) {
+        return;
+    }
+
+    // Keep the cached position until the text item is shown.
+    const auto textItem = focusedTextItem();
+    const auto position = textItem ? textItem->cursorPosition() : std::nullopt;
+    if (!position) {
+        return;
+    }
+    m_cache->setCursor(focusRow(), *position);
 }
 
 void ChatBarMessageContentModel::resetModel()
@@ -172,6 +172,7 @@ private:
     void handleBlockTransition(bool up);
 
     void updateCache() const;
+    void updateCacheCursor() const;
 
     bool m_sendMessageWithEnter = true;
 
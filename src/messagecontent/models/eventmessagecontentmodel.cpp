@@ -500,6 +500,14 @@ void EventMessageContentModel::fillEditCache()
         return;
     }
 
+    // Resume an unfinished edit of this event, e.g. one restored after a restart.
+    const auto editCache = m_room->editCache();
+    if (editCache->eventId() == m_eventId && !editCache->empty()) {
+        return;
+    }
+    editCache->clear();
+    editCache->setEventId(m_eventId);
+
     if (!richTextActive) {
         auto doc = QTextDocument();
         doc.setHtml(EventHandler::rawMessageBody(*event).replace(u'\n', u""_s));
@@ -560,6 +568,7 @@ void EventMessageContentModel::cancelEventEdit()
     }
     m_isEditing = false;
     m_room->editCache()->clear();
+    m_room->editCache()->setEventId({});
     resetContent();
 }
 
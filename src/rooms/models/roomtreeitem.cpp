@@ -37,24 +37,35 @@ bool RoomTreeItem::insertChild(std::unique_ptr<RoomTreeItem> newChild)
         return false;
     }
 
-    for (auto it = m_children.begin(), end = m_children.end(); it != end; ++it) {
-        if (*it == newChild) {
-            *it = std::move(newChild);
-            return true;
-        }
-    }
-
+    newChild->m_parentItem = this;
+    newChild->m_row = childCount();
     m_children.push_back(std::move(newChild));
     return true;
 }
 
 bool RoomTreeItem::removeChild(int row)
+{
+    return takeChild(row) != nullptr;
+}
+
+std::unique_ptr<RoomTreeItem> RoomTreeItem::takeChild(int row)
 {
     if (row < 0 || row >= childCount()) {
-        return false;
+        return nullptr;
     }
+    auto child = std::move(m_children[row]);
     m_children.erase(m_children.begin() + row);
-    return true;
+    updateRows(row);
+    child->m_parentItem = nullptr;
+    child->m_row = 0;
+    return child;
+}
+
+void RoomTreeItem::updateRows(int from)
+{
+    for (auto i = from; i < childCount(); i++) {
+        m_children[i]->m_row = i;
+    }
 }
 
 int RoomTreeItem::row() const
@@ -62,16 +73,8 @@ int RoomTreeItem::row() const
     if (m_parentItem == nullptr) {
         return 0;
     }
-
-    const auto it = std::find_if(m_parentItem->m_children.cbegin(), m_parentItem->m_children.cend(), [this](const std::unique_ptr<RoomTreeItem> &treeItem) {
-        return treeItem.get() == this;
-    });
-
-    if (it != m_parentItem->m_children.cend()) {
-        return std::distance(m_parentItem->m_children.cbegin(), it);
-    }
-    Q_ASSERT(false); // should not happen
-    return -1;
+    Q_ASSERT(m_parentItem->m_children[m_row].get() == this);
+    return m_row;
 }
 
 RoomTreeItem *RoomTreeItem::parentItem() const
@@ -83,18 +86,3 @@ RoomTreeItem::TreeData RoomTreeItem::data() const
 {
     return m_data;
 }
-
-std::optional<int> RoomTreeItem::rowForRoom(Quotient::Room *room) const
-{
-    Q_ASSERT_X(std::holds_alternative<NeoChatRoomType::Types>(m_data), __FUNCTION__, "rowForRoom only works items for rooms not categories");
-
-    int i = 0;
-    for (const auto &child : m_children) {
-        if (std::get<NeoChatRoom *>(child->data()) == room) {
-            return i;
-        }
-        i++;
-    }
-
-    return std::nullopt;
-}
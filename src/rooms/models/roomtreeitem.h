@@ -40,7 +40,9 @@ public:
     int childCount() const;
 
     /**
-     * @brief Insert the given child.
+     * @brief Insert the given child at the end.
+     *
+     * The child's parent is set to this item.
      */
     bool insertChild(std::unique_ptr<RoomTreeItem> newChild);
 
@@ -51,6 +53,13 @@ public:
      */
     bool removeChild(int row);
 
+    /**
+     * @brief Remove the child at the given row number and return it.
+     *
+     * @return The child, nullptr if the given row isn't valid.
+     */
+    std::unique_ptr<RoomTreeItem> takeChild(int row);
+
     /**
      * @brief Return this item's parent.
      */
@@ -59,6 +68,8 @@ public:
     /**
      * @brief Return the row number for this child relative to the parent.
      *
+     * The row is stored in the item and kept up to date by the parent, so this is O(1).
+     *
      * @return The row value if the child has a parent, 0 otherwise.
      */
     int row() const;
@@ -68,11 +79,12 @@ public:
      */
     TreeData data() const;
 
-    std::optional<int> rowForRoom(Quotient::Room *room) const;
-
 private:
     std::vector<std::unique_ptr<RoomTreeItem>> m_children;
     RoomTreeItem *m_parentItem;
+    int m_row = 0;
+
+    void updateRows(int from);
 
     TreeData m_data;
 };
@@ -22,6 +22,13 @@ std::function<bool(const Quotient::RoomEvent *)> RoomTreeModel::m_hiddenFilter =
 RoomTreeModel::RoomTreeModel(QObject *parent)
     : QAbstractItemModel(parent)
     , m_rootItem(new RoomTreeItem(nullptr))
+    , m_changeCoalescer(
+          [this](NeoChatRoom *room) {
+              return indexForRoom(room);
+          },
+          [this](int firstRow, int lastRow, const QModelIndex &parent, const QList<int> &roles) {
+              Q_EMIT dataChanged(index(firstRow, 0, parent), index(lastRow, 0, parent), roles);
+          })
 {
 }
 
@@ -38,6 +45,10 @@ RoomTreeItem *RoomTreeModel::getItem(const QModelIndex &index) const
 
 void RoomTreeModel::resetModel()
 {
+    m_changeCoalescer.clear();
+    m_sortKeys.clear();
+    m_roomItems.clear();
+    m_searchIndex.clear();
     if (m_connection == nullptr) {
         beginResetModel();
         m_rootItem.reset();
@@ -56,10 +67,15 @@ void RoomTreeModel::resetModel()
     for (const auto &r : rooms) {
         const auto room = dynamic_cast<NeoChatRoom *>(r);
         const auto type = NeoChatRoomType::typeForRoom(room);
-        const auto categoryItem = m_rootItem->child(type);
-        if (categoryItem->insertChild(std::make_unique<RoomTreeItem>(room, categoryItem))) {
-            connectRoomSignals(room);
+        if (m_roomItems.contains(room)) {
+            continue;
         }
+        const auto categoryItem = m_rootItem->child(type);
+        auto item = std::make_unique<RoomTreeItem>(room, categoryItem);
+        m_roomItems[room] = item.get();
+        categoryItem->insertChild(std::move(item));
+        m_searchIndex.update(room);
+        connectRoomSignals(room);
     }
 
     endResetModel();
@@ -74,6 +90,7 @@ void RoomTreeModel::setConnection(NeoChatConnection *connection)
         disconnect(m_connection.get(), nullptr, this, nullptr);
     }
     m_connection = connection;
+    m_changeCoalescer.setConnection(connection);
 
     resetModel();
 
@@ -100,7 +117,10 @@ void RoomTreeModel::newRoom(Room *r)
 
     const auto parentItem = m_rootItem->child(type);
     beginInsertRows(index(parentItem->row(), 0), parentItem->childCount(), parentItem->childCount());
-    parentItem->insertChild(std::make_unique<RoomTreeItem>(room, parentItem));
+    auto item = std::make_unique<RoomTreeItem>(room, parentItem);
+    m_roomItems[room] = item.get();
+    parentItem->insertChild(std::move(item));
+    m_searchIndex.update(room);
     connectRoomSignals(room);
     endInsertRows();
 }
@@ -116,7 +136,11 @@ void RoomTreeModel::leftRoom(Room *r)
     const auto parentItem = getItem(index.parent());
     Q_ASSERT(parentItem);
 
+    m_changeCoalescer.remove(room);
+    m_sortKeys.remove(room);
     beginRemoveRows(index.parent(), index.row(), index.row());
+    m_roomItems.remove(room);
+    m_searchIndex.remove(room);
     parentItem->removeChild(index.row());
     room->disconnect(this);
     endRemoveRows();
@@ -124,46 +148,33 @@ void RoomTreeModel::leftRoom(Room *r)
 
 void RoomTreeModel::moveRoom(Quotient::Room *room)
 {
+    auto neochatRoom = dynamic_cast<NeoChatRoom *>(room);
     // We can't assume the type as it has changed so currently the return of
-    // NeoChatRoomType::typeForRoom doesn't match it's current location. So find the room.
-    NeoChatRoomType::Types oldType;
-    int oldRow = -1;
-    for (int i = 0; i < NeoChatRoomType::TypesCount; i++) {
-        const auto categoryItem = m_rootItem->child(i);
-        const auto row = categoryItem->rowForRoom(room);
-        if (row) {
-            oldType = static_cast<NeoChatRoomType::Types>(i);
-            oldRow = *row;
-        }
-    }
-
-    if (oldRow == -1) {
+    // NeoChatRoomType::typeForRoom doesn't match it's current location.
+    const auto item = m_roomItems.value(neochatRoom);
+    if (item == nullptr) {
         return;
     }
-    auto neochatRoom = dynamic_cast<NeoChatRoom *>(room);
+    const auto oldParentItem = item->parentItem();
+    Q_ASSERT(oldParentItem);
+    const auto oldType = std::get<NeoChatRoomType::Types>(oldParentItem->data());
     const auto newType = NeoChatRoomType::typeForRoom(neochatRoom);
     if (newType == oldType) {
         return;
     }
 
     const auto oldParent = index(oldType, 0, {});
-    auto oldParentItem = getItem(oldParent);
-    Q_ASSERT(oldParentItem);
-
     const auto newParent = index(newType, 0, {});
     auto newParentItem = getItem(newParent);
     Q_ASSERT(newParentItem);
 
-    // HACK: We're doing this as a remove then insert because  moving doesn't work
-    // properly with DelegateChooser for whatever reason.
+    const auto oldRow = item->row();
     Q_ASSERT(checkIndex(index(oldRow, 0, oldParent), QAbstractItemModel::CheckIndexOption::IndexIsValid));
-    beginRemoveRows(oldParent, oldRow, oldRow);
-    const bool success = oldParentItem->removeChild(oldRow);
-    Q_ASSERT(success);
-    endRemoveRows();
-    beginInsertRows(newParent, newParentItem->childCount(), newParentItem->childCount());
-    newParentItem->insertChild(std::make_unique<RoomTreeItem>(neochatRoom, newParentItem));
-    endInsertRows();
+    if (!beginMoveRows(oldParent, oldRow, oldRow, newParent, newParentItem->childCount())) {
+        return;
+    }
+    newParentItem->insertChild(oldParentItem->takeChild(oldRow));
+    endMoveRows();
 
     // The room list needs to be re-sorted when this happens, of course.
     Q_EMIT invalidateSort();
@@ -172,8 +183,13 @@ void RoomTreeModel::moveRoom(Quotient::Room *room)
 void RoomTreeModel::connectRoomSignals(NeoChatRoom *room)
 {
     connect(room, &Room::displaynameChanged, this, [this, room] {
+        m_searchIndex.update(room);
         refreshRoomRoles(room, {DisplayNameRole});
     });
+    connect(room, &Room::namesChanged, this, [this, room] {
+        m_searchIndex.update(room);
+        refreshRoomRoles(room, {CanonicalAliasRole});
+    });
     connect(room, &Room::changed, this, [this, room](Room::Changes changes) {
         if (changes & (Room::Change::UnreadStats | Room::Change::Highlights)) {
             refreshRoomRoles(room, {ContextNotificationCountRole, HasHighlightNotificationsRole, NotificationCountRole});
@@ -189,6 +205,7 @@ void RoomTreeModel::connectRoomSignals(NeoChatRoom *room)
         moveRoom(room);
     });
     connect(room, &Room::joinStateChanged, this, [this, room] {
+        m_searchIndex.update(room);
         refreshRoomRoles(room);
     });
     connect(room, &Room::addedMessages, this, [this, room] {
@@ -200,16 +217,59 @@ void RoomTreeModel::connectRoomSignals(NeoChatRoom *room)
     connect(room, &NeoChatRoom::pushNotificationStateChanged, this, [this, room] {
         refreshRoomRoles(room, {ContextNotificationCountRole, HasHighlightNotificationsRole});
     });
+    connect(room, &NeoChatRoom::lastActiveTimeChanged, this, [this, room] {
+        refreshRoomRoles(room, {SubtitleTextRole});
+    });
 }
 
-void RoomTreeModel::refreshRoomRoles(NeoChatRoom *room, const QList<int> &roles)
+void RoomTreeModel::invalidateSortKey(NeoChatRoom *room, const QList<int> &roles)
 {
-    const auto index = indexForRoom(room);
-    if (!index.isValid()) {
-        qCritical() << "Room" << room->id() << "not found in the room list";
+    const auto it = m_sortKeys.find(room);
+    if (it == m_sortKeys.end()) {
         return;
     }
-    Q_EMIT dataChanged(index, index, roles);
+    if (roles.isEmpty() || roles.contains(DisplayNameRole)) {
+        it->nameDirty = true;
+    }
+    if (roles.isEmpty() || roles.contains(ContextNotificationCountRole) || roles.contains(HasHighlightNotificationsRole)
+        || roles.contains(NotificationCountRole) || roles.contains(SubtitleTextRole)) {
+        it->dirty = true;
+    }
+}
+
+RoomSortParameter::SortKey RoomTreeModel::sortKey(NeoChatRoom *room) const
+{
+    auto &cached = m_sortKeys[room];
+    if (cached.dirty || cached.nameDirty) {
+        RoomSortParameter::updateSortKey(cached.key, room, cached.nameDirty);
+        cached.dirty = false;
+        cached.nameDirty = false;
+    }
+    return cached.key;
+}
+
+bool RoomTreeModel::roomMatches(NeoChatRoom *room, const QString &text) const
+{
+    return m_searchIndex.matches(room, text);
+}
+
+NeoChatRoom *RoomTreeModel::roomForIndex(const QModelIndex &index) const
+{
+    if (!index.isValid()) {
+        return nullptr;
+    }
+    const auto item = getItem(index);
+    if (!std::holds_alternative<NeoChatRoom *>(item->data())) {
+        return nullptr;
+    }
+    return std::get<NeoChatRoom *>(item->data());
+}
+
+void RoomTreeModel::refreshRoomRoles(NeoChatRoom *room, const QList<int> &roles)
+{
+    invalidateSortKey(room, roles);
+    // Emitted in batches so that the proxy models only re-sort once per sync.
+    m_changeCoalescer.add(room, roles);
 }
 
 NeoChatConnection *RoomTreeModel::connection() const
@@ -416,23 +476,11 @@ QModelIndex RoomTreeModel::indexForRoom(NeoChatRoom *room) const
         return {};
     }
 
-    // Try and find by checking type.
-    const auto type = NeoChatRoomType::typeForRoom(room);
-    const auto parentItem = m_rootItem->child(type);
-    const auto row = parentItem->rowForRoom(room);
-    if (row) {
-        return index(*row, 0, index(type, 0));
-    }
-    // Double check that the room isn't in the wrong category.
-    for (int i = 0; i < NeoChatRoomType::TypesCount; i++) {
-        const auto parentItem = m_rootItem->child(i);
-        const auto row = parentItem->rowForRoom(room);
-        if (row) {
-            return index(*row, 0, index(i, 0));
-        }
+    const auto item = m_roomItems.value(room);
+    if (item == nullptr) {
+        return {};
     }
-
-    return {};
+    return createIndex(item->row(), 0, item);
 }
 
 void RoomTreeModel::setHiddenFilter(std::function<bool(const Quotient::RoomEvent *)> hiddenFilter)
@@ -6,6 +6,9 @@
 #include <QAbstractItemModel>
 #include <QPointer>
 
+#include "enums/roomsortparameter.h"
+#include "roomchangecoalescer.h"
+#include "roomsearchindex.h"
 #include "roomtreeitem.h"
 
 namespace Quotient
@@ -77,6 +80,31 @@ public:
 
     Q_INVOKABLE QModelIndex indexForRoom(NeoChatRoom *room) const;
 
+    /**
+     * @brief Return the room at the given index, or nullptr if the index is a category.
+     */
+    NeoChatRoom *roomForIndex(const QModelIndex &index) const;
+
+    /**
+     * @brief Return the sort key for the given room.
+     *
+     * The key is cached and only recalculated after the room has signalled a change
+     * to one of the values it contains. It is returned by value as looking up another
+     * room may rehash the cache.
+     *
+     * @sa RoomSortParameter::SortKey
+     */
+    RoomSortParameter::SortKey sortKey(NeoChatRoom *room) const;
+
+    /**
+     * @brief Whether the room's name or canonical alias contains the given text.
+     *
+     * The comparison ignores case and diacritics.
+     *
+     * @sa RoomSearchIndex
+     */
+    bool roomMatches(NeoChatRoom *room, const QString &text) const;
+
     static void setHiddenFilter(std::function<bool(const Quotient::RoomEvent *)> hiddenFilter);
 
 Q_SIGNALS:
@@ -86,6 +114,18 @@ Q_SIGNALS:
 private:
     QPointer<NeoChatConnection> m_connection;
     std::unique_ptr<RoomTreeItem> m_rootItem;
+    // The item of every room in the tree, so that indexForRoom doesn't have to search.
+    QHash<const NeoChatRoom *, RoomTreeItem *> m_roomItems;
+    RoomChangeCoalescer m_changeCoalescer;
+
+    struct CachedSortKey {
+        RoomSortParameter::SortKey key;
+        bool nameDirty = true;
+        bool dirty = true;
+    };
+    mutable QHash<const NeoChatRoom *, CachedSortKey> m_sortKeys;
+    mutable RoomSearchIndex m_searchIndex;
+    void invalidateSortKey(NeoChatRoom *room, const QList<int> &roles);
 
     RoomTreeItem *getItem(const QModelIndex &index) const;
 
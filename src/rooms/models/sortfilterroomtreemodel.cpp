@@ -23,18 +23,25 @@ SortFilterRoomTreeModel::SortFilterRoomTreeModel(RoomTreeModel *sourceModel, QOb
     setRecursiveFilteringEnabled(true);
     sort(0);
     connect(sourceModel, &RoomTreeModel::invalidateSort, this, &SortFilterRoomTreeModel::invalidate);
+    connect(&SpaceHierarchyCache::instance(), &SpaceHierarchyCache::spaceHierarchyChanged, this, [this]() {
+        if (!m_activeSpaceId.isEmpty()) {
+            beginFilterChange();
+            updateActiveSpaceRooms();
+            endFilterChange();
+        }
+    });
 }
 
 bool SortFilterRoomTreeModel::lessThan(const QModelIndex &source_left, const QModelIndex &source_right) const
 {
-    const auto treeModel = dynamic_cast<RoomTreeModel *>(sourceModel());
+    const auto treeModel = static_cast<RoomTreeModel *>(sourceModel());
     if (treeModel == nullptr) {
         return false;
     }
 
     // Ensure "Find your friends" is at the top where its discoverable
-    if (sourceModel()->data(source_left, RoomTreeModel::CategoryRole).toInt() == NeoChatRoomType::AddDirect && m_mode == DirectChats
-        && sourceModel()->rowCount(sourceModel()->index(NeoChatRoomType::Direct, 0)) > 0) {
+    if (!source_left.parent().isValid() && source_left.row() == NeoChatRoomType::AddDirect && m_mode == DirectChats
+        && treeModel->rowCount(treeModel->index(NeoChatRoomType::Direct, 0)) > 0) {
         return true;
     }
 
@@ -42,7 +49,7 @@ bool SortFilterRoomTreeModel::lessThan(const QModelIndex &source_left, const QMo
     if (!source_left.parent().isValid() || !source_right.parent().isValid()) {
         if (source_left.row() == NeoChatRoomType::ServerNotice) {
             for (int i = 0; i < treeModel->rowCount(source_left); i++) {
-                auto room = treeModel->connection()->room(treeModel->index(i, 0, source_left).data(RoomTreeModel::RoomIdRole).toString());
+                const auto room = treeModel->roomForIndex(treeModel->index(i, 0, source_left));
                 if (room && room->unreadStats().notableCount > 0) {
                     return true;
                 }
@@ -51,15 +58,16 @@ bool SortFilterRoomTreeModel::lessThan(const QModelIndex &source_left, const QMo
         return false;
     }
 
-    const auto leftRoom = dynamic_cast<NeoChatRoom *>(treeModel->connection()->room(source_left.data(RoomTreeModel::RoomIdRole).toString()));
-    const auto rightRoom = dynamic_cast<NeoChatRoom *>(treeModel->connection()->room(source_right.data(RoomTreeModel::RoomIdRole).toString()));
+    const auto leftRoom = treeModel->roomForIndex(source_left);
+    const auto rightRoom = treeModel->roomForIndex(source_right);
     if (leftRoom == nullptr || rightRoom == nullptr) {
         return false;
     }
 
-    const auto parameters = RoomSortParameter::currentParameterList();
-    for (const auto sortRole : parameters) {
-        auto result = RoomSortParameter::compareParameter(sortRole, leftRoom, rightRoom);
+    const auto leftKey = treeModel->sortKey(leftRoom);
+    const auto rightKey = treeModel->sortKey(rightRoom);
+    for (const auto sortRole : RoomSortParameter::currentParameterList()) {
+        auto result = RoomSortParameter::compareParameter(sortRole, leftKey, rightKey);
 
         if (result != 0) {
             return result > 0;
@@ -83,23 +91,23 @@ QString SortFilterRoomTreeModel::filterText() const
 
 bool SortFilterRoomTreeModel::filterAcceptsRow(int source_row, const QModelIndex &source_parent) const
 {
+    const auto treeModel = static_cast<RoomTreeModel *>(sourceModel());
     if (!source_parent.isValid()) {
-        if (sourceModel()->data(sourceModel()->index(source_row, 0), RoomTreeModel::CategoryRole).toInt() == NeoChatRoomType::AddDirect && m_mode == DirectChats
-            && sourceModel()->rowCount(sourceModel()->index(NeoChatRoomType::Direct, 0)) > 0) {
+        if (source_row == NeoChatRoomType::AddDirect && m_mode == DirectChats && treeModel->rowCount(treeModel->index(NeoChatRoomType::Direct, 0)) > 0) {
             return true;
         }
         return false;
     }
 
-    QModelIndex index = sourceModel()->index(source_row, 0, source_parent);
-
-    bool acceptRoom = sourceModel()->data(index, RoomTreeModel::DisplayNameRole).toString().contains(m_filterText, Qt::CaseInsensitive)
-        && sourceModel()->data(index, RoomTreeModel::IsSpaceRole).toBool() == false;
+    const auto room = treeModel->roomForIndex(treeModel->index(source_row, 0, source_parent));
+    if (room == nullptr || room->isSpace()) {
+        return false;
+    }
 
-    bool isDirectChat = sourceModel()->data(index, RoomTreeModel::IsDirectChat).toBool();
+    bool isDirectChat = room->isDirectChat();
     // In `show direct chats` mode we only care about whether or not it's a direct chat or if the filter string matches.'
     if (m_mode == DirectChats) {
-        return isDirectChat && acceptRoom;
+        return isDirectChat && treeModel->roomMatches(room, m_filterText);
     }
 
     // When not in `show direct chats` mode, filter them out.
@@ -107,29 +115,26 @@ bool SortFilterRoomTreeModel::filterAcceptsRow(int source_row, const QModelIndex
         return false;
     }
 
-    if (sourceModel()->data(index, RoomTreeModel::JoinStateRole).toString() == u"upgraded"_s
-        && dynamic_cast<RoomTreeModel *>(sourceModel())->connection()->room(sourceModel()->data(index, RoomTreeModel::ReplacementIdRole).toString())) {
+    if (!room->successorId().isEmpty() && treeModel->connection()->room(room->successorId())) {
         return false;
     }
 
     // Hide rooms with defined types, assuming that data-holding rooms have a defined type
-    if (!sourceModel()->data(index, RoomTreeModel::RoomTypeRole).toString().isEmpty()) {
+    if (room->creation() && !room->creation()->contentPart<QString>("type"_L1).isEmpty()) {
         return false;
     }
 
-    if (m_showAllRoomsInHome && m_activeSpaceId.isEmpty()) {
-        return acceptRoom;
-    }
-
-    if (m_activeSpaceId.isEmpty()) {
-        if (!SpaceHierarchyCache::instance().isChild(sourceModel()->data(index, RoomTreeModel::RoomIdRole).toString())) {
-            return acceptRoom;
+    if (!(m_showAllRoomsInHome && m_activeSpaceId.isEmpty())) {
+        if (m_activeSpaceId.isEmpty()) {
+            if (SpaceHierarchyCache::instance().isChild(room->id())) {
+                return false;
+            }
+        } else if (!m_activeSpaceRooms.contains(room->id())) {
+            return false;
         }
-        return false;
-    } else {
-        const auto &rooms = SpaceHierarchyCache::instance().getRoomListForSpace(m_activeSpaceId, false);
-        return std::find(rooms.begin(), rooms.end(), sourceModel()->data(index, RoomTreeModel::RoomIdRole).toString()) != rooms.end() && acceptRoom;
     }
+
+    return treeModel->roomMatches(room, m_filterText);
 }
 
 QString SortFilterRoomTreeModel::activeSpaceId() const
@@ -140,10 +145,21 @@ QString SortFilterRoomTreeModel::activeSpaceId() const
 void SortFilterRoomTreeModel::setActiveSpaceId(const QString &spaceId)
 {
     m_activeSpaceId = spaceId;
+    updateActiveSpaceRooms();
     Q_EMIT activeSpaceIdChanged();
     invalidate();
 }
 
+void SortFilterRoomTreeModel::updateActiveSpaceRooms()
+{
+    if (m_activeSpaceId.isEmpty()) {
+        m_activeSpaceRooms.clear();
+        return;
+    }
+    const auto &rooms = SpaceHierarchyCache::instance().getRoomListForSpace(m_activeSpaceId, false);
+    m_activeSpaceRooms = QSet<QString>(rooms.constBegin(), rooms.constEnd());
+}
+
 void SortFilterRoomTreeModel::setCurrentRoom(NeoChatRoom *room)
 {
     m_currentRoom = room;
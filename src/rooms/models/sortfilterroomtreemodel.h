@@ -110,6 +110,9 @@ private:
     Mode m_mode = All;
     QString m_filterText;
     QString m_activeSpaceId;
+    // The ids of the rooms in the active space, for fast lookup while filtering.
+    QSet<QString> m_activeSpaceRooms;
+    void updateActiveSpaceRooms();
 
     QPointer<NeoChatRoom> m_currentRoom;
 
@@ -258,6 +258,40 @@ FormCard.FormCardPage {
                 NeoChatConfig.save();
             }
         }
+        FormCard.FormDelegateSeparator {
+            above: quickEditCheckbox
+            below: uploadImageSizeCombo
+        }
+        FormCard.FormComboBoxDelegate {
+            id: uploadImageSizeCombo
+            text: i18nc("@label:listbox", "Resize images before sending:")
+            textRole: "name"
+            valueRole: "value"
+            enabled: !NeoChatConfig.isUploadImageMaxDimensionImmutable
+            model: [
+                {
+                    name: i18nc("@item:inlistbox Send images without resizing them", "Never"),
+                    value: 0
+                },
+                {
+                    name: i18nc("@item:inlistbox Resize images larger than this", "Larger than %1 pixels", 4096),
+                    value: 4096
+                },
+                {
+                    name: i18nc("@item:inlistbox Resize images larger than this", "Larger than %1 pixels", 2048),
+                    value: 2048
+                },
+                {
+                    name: i18nc("@item:inlistbox Resize images larger than this", "Larger than %1 pixels", 1280),
+                    value: 1280
+                }
+            ]
+            Component.onCompleted: currentIndex = Math.max(0, indexOfValue(NeoChatConfig.uploadImageMaxDimension))
+            onActivated: {
+                NeoChatConfig.uploadImageMaxDimension = currentValue;
+                NeoChatConfig.save();
+            }
+        }
     }
     FormCard.FormHeader {
         title: i18n("Developer Settings")
@@ -3,6 +3,8 @@
 
 #include "permissionsmodel.h"
 
+#include <algorithm>
+
 #include <Quotient/events/roompowerlevelsevent.h>
 
 #include <KLazyLocalizedString>
@@ -144,7 +146,23 @@ void PermissionsModel::setRoom(NeoChatRoom *room)
     if (room == m_room) {
         return;
     }
+    if (m_room) {
+        m_room->disconnect(this);
+    }
     m_room = room;
+    if (m_room) {
+        connect(m_room, &NeoChatRoom::powerLevelsChanged, this, [this]() {
+            // A new event type might have gotten its own level.
+            const auto eventTypes = m_room->powerLevels().eventTypes();
+            if (m_permissions.isEmpty() || std::ranges::any_of(eventTypes, [this](const QString &type) {
+                    return !m_permissions.contains(type);
+                })) {
+                initializeModel();
+                return;
+            }
+            Q_EMIT dataChanged(index(0), index(rowCount() - 1), {LevelRole, LevelNameRole});
+        });
+    }
     Q_EMIT roomChanged();
 
     initializeModel();
@@ -161,8 +179,9 @@ void PermissionsModel::initializeModel()
         return;
     }
 
-    const auto currentPowerLevelEvent = m_room->currentState().get<Quotient::RoomPowerLevelsEvent>();
-    if (currentPowerLevelEvent == nullptr) {
+    const auto &powerLevels = m_room->powerLevels();
+    if (!powerLevels.isValid()) {
+        endResetModel();
         return;
     }
 
@@ -170,7 +189,7 @@ void PermissionsModel::initializeModel()
     m_permissions.append(basicPermissions);
     m_permissions.append(knownPermissions);
 
-    for (const auto &event : currentPowerLevelEvent->events().keys()) {
+    for (const auto &event : powerLevels.eventTypes()) {
         if (!m_permissions.contains(event)) {
             m_permissions += event;
         }
@@ -267,28 +286,29 @@ std::optional<int> PermissionsModel::powerLevel(const QString &permission) const
         return std::nullopt;
     }
 
-    if (const auto currentPowerLevelEvent = m_room->currentState().get<Quotient::RoomPowerLevelsEvent>()) {
-        if (permission == BanKey) {
-            return currentPowerLevelEvent->ban();
-        } else if (permission == KickKey) {
-            return currentPowerLevelEvent->kick();
-        } else if (permission == InviteKey) {
-            return currentPowerLevelEvent->invite();
-        } else if (permission == RedactKey) {
-            return currentPowerLevelEvent->redact();
-        } else if (permission == UsersDefaultKey) {
-            return currentPowerLevelEvent->usersDefault();
-        } else if (permission == StateDefaultKey) {
-            return currentPowerLevelEvent->stateDefault();
-        } else if (permission == EventsDefaultKey) {
-            return currentPowerLevelEvent->eventsDefault();
-        } else if (eventPermissions.contains(permission)) {
-            return currentPowerLevelEvent->powerLevelForEvent(permission);
-        } else {
-            return currentPowerLevelEvent->powerLevelForState(permission);
-        }
+    const auto &powerLevels = m_room->powerLevels();
+    if (!powerLevels.isValid()) {
+        return std::nullopt;
+    }
+
+    if (permission == BanKey) {
+        return powerLevels.actionLevel(PowerLevelTable::Ban);
+    } else if (permission == KickKey) {
+        return powerLevels.actionLevel(PowerLevelTable::Kick);
+    } else if (permission == InviteKey) {
+        return powerLevels.actionLevel(PowerLevelTable::Invite);
+    } else if (permission == RedactKey) {
+        return powerLevels.actionLevel(PowerLevelTable::Redact);
+    } else if (permission == UsersDefaultKey) {
+        return powerLevels.usersDefault();
+    } else if (permission == StateDefaultKey) {
+        return powerLevels.stateDefault();
+    } else if (permission == EventsDefaultKey) {
+        return powerLevels.eventsDefault();
+    } else if (eventPermissions.contains(permission)) {
+        return powerLevels.eventLevel(permission);
     }
-    return std::nullopt;
+    return powerLevels.stateLevel(permission);
 }
 
 void PermissionsModel::setPowerLevel(const QString &permission, const int &newPowerLevel)
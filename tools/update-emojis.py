@@ -28,6 +28,8 @@ for (shortcode, props) in gemojione_json.items():
 
 response = requests.get('https://unicode.org/Public/emoji/14.0/emoji-test.txt')
 group = ""
+written_groups = []
+tones = []
 file = open("../src/libneochat/emojis.h", "w")
 # REUSE-IgnoreStart
 file.write("// SPDX-FileCopyrightText: None\n")
@@ -94,8 +96,18 @@ for line in response.text.split("\n"):
         emoji_args = 'u8"{0}", u8"{1}", u8"{2}"'.format(escaped_sequence, shortcode, description)
 
         if is_skin_tone:
-            tones_file.write("{u8\"" + description.split(":")[0] + "\", " + emoji_args + "},\n")
+            tones.append((description.split(":")[0], emoji_args))
             continue
+        # EmojiModel serves each category as one slice of the table
+        if group != (written_groups[-1] if written_groups else None):
+            if group in written_groups:
+                raise RuntimeError("Emojis of group " + group + " are not contiguous")
+            written_groups.append(group)
         file.write("{EmojiModel::" + group + ", " + emoji_args + "},\n")
 file.close()
+
+# EmojiTones looks the tones up by binary search, so sort them by name. The sort is stable,
+# which keeps the tones of each emoji in order.
+for (name, emoji_args) in sorted(tones, key=lambda tone: tone[0].encode("utf-8")):
+    tones_file.write("{u8\"" + name + "\", " + emoji_args + "},\n")
 tones_file.close()